@@ -0,0 +1,226 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   indexedPriorityQueue.hpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:44:18 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:49:51 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef INDEXED_PRIORITY_QUEUE_HPP
+# define INDEXED_PRIORITY_QUEUE_HPP
+
+# include <cstddef>
+# include <vector>
+# include <stdexcept>
+# include <functional>
+
+# include "../utils/heap.hpp"
+
+/*
+
+	SYNOPSIS : indexed_priority_queue is a d-ary heap (Arity children per node, see utils/heap.hpp) of
+	priorities, each one attached to an id (a timer, a vertex of a graph...) in [0, n). The ids can be
+	found in the heap : the priority of an id can be changed, or the id removed, in O(log n).
+
+	=>	void	push(id, val);			// std::invalid_argument if id is already in the queue
+	=>	void	decrease_key(id, val);	// val moves the id toward the top (comp(old, val) or equal : a lower
+									// key for a min heap with std::greater), std::invalid_argument otherwise
+	=>	void	update(id, val);		// any new priority
+	=>	void	erase(id);
+	=>	top, top_id, pop, contains (id), priority (id)	// priority throws std::out_of_range if id is absent
+
+	The heap keeps the priority and the id side by side (the comparisons of a sift read one array) and
+	a second array gives the position of each id in the heap (npos when absent). It grows to the biggest
+	id pushed.
+*/
+
+namespace ft
+{
+	template <class T, class Compare = std::less<T>, std::size_t Arity = 4>
+	class indexed_priority_queue
+	{
+		/* ALIASES */
+		public:
+
+			typedef T											value_type;
+			typedef Compare										value_compare;
+			typedef std::size_t									size_type;
+			typedef std::size_t									id_type;
+			typedef const T&									const_reference;
+
+			static const size_type	npos = static_cast<size_type>(-1);
+
+		/* CONSTRUCTORS, DESTRUCTOR */
+
+			/* room for the ids [0, ids) */
+			explicit indexed_priority_queue(size_type ids = 0, const Compare& compare = Compare())
+			: _heap(), _pos(ids, npos), _comp(compare)
+			{
+				this->_heap.reserve(ids);
+			}
+
+			virtual ~indexed_priority_queue() {}
+
+		/* CAPACITY */
+
+			bool		empty(void) const { return (this->_heap.empty()); };
+			size_type	size(void) const { return (this->_heap.size()); };
+
+		/* ELEMENT ACCESS */
+
+			const_reference	top(void) const { return (this->_heap.front().val); };
+			id_type			top_id(void) const { return (this->_heap.front().id); };
+
+			bool	contains(id_type id) const { return (id < this->_pos.size() && this->_pos[id] != npos); };
+
+			const_reference	priority(id_type id) const
+			{
+				if (this->contains(id) == false)
+					throw std::out_of_range("indexed_priority_queue");
+				return (this->_heap[this->_pos[id]].val);
+			}
+
+		/* MODIFIERS */
+
+			void	push(id_type id, const value_type& val)
+			{
+				if (this->contains(id))
+					throw std::invalid_argument("indexed_priority_queue");
+				if (id >= this->_pos.size())
+					this->_pos.resize(id + 1, npos);
+				this->_heap.push_back(_entry(val, id));
+				this->_pos[id] = this->_heap.size() - 1;
+				this->_sift_up(this->_heap.size() - 1);
+			}
+
+			/* undefined behaviour if the queue is empty */
+			void	pop(void)
+			{
+				this->_remove(0);
+			}
+
+			void	erase(id_type id)
+			{
+				if (this->contains(id))
+					this->_remove(this->_pos[id]);
+			}
+
+			void	decrease_key(id_type id, const value_type& val)
+			{
+				if (this->contains(id) == false || this->_comp(val, this->_heap[this->_pos[id]].val))
+					throw std::invalid_argument("indexed_priority_queue");
+				this->_heap[this->_pos[id]].val = val;
+				this->_sift_up(this->_pos[id]);
+			}
+
+			void	update(id_type id, const value_type& val)
+			{
+				size_type	hole;
+
+				if (this->contains(id) == false)
+				{
+					this->push(id, val);
+					return ;
+				}
+				hole = this->_pos[id];
+				this->_heap[hole].val = val;
+				if (this->_sift_up(hole) == hole)
+					this->_sift_down(hole);
+			}
+
+			void	clear(void)
+			{
+				for (size_type i = 0; i < this->_heap.size(); i++)
+					this->_pos[this->_heap[i].id] = npos;
+				this->_heap.clear();
+			}
+
+		private: // private member data
+
+			struct _entry
+			{
+				value_type		val;
+				id_type			id;
+
+				_entry(const value_type& v, id_type i) : val(v), id(i) {}
+			};
+
+			std::vector<_entry>		_heap;
+			std::vector<size_type>	_pos; // position of each id in _heap
+			value_compare			_comp;
+
+		private: // private member methods (helpers)
+
+			/* the last entry fills the hole, then goes up or down */
+			void	_remove(size_type hole)
+			{
+				this->_pos[this->_heap[hole].id] = npos;
+				if (hole + 1 < this->_heap.size())
+				{
+					this->_heap[hole] = this->_heap.back();
+					this->_pos[this->_heap[hole].id] = hole;
+					this->_heap.pop_back();
+					if (this->_sift_up(hole) == hole)
+						this->_sift_down(hole);
+				}
+				else
+					this->_heap.pop_back();
+			}
+
+			/* as ft::dary_sift_up and ft::dary_sift_down, updating the position of every moved id */
+			size_type	_sift_up(size_type hole)
+			{
+				_entry		moved = this->_heap[hole];
+				size_type	parent;
+
+				while (hole > 0)
+				{
+					parent = (hole - 1) / Arity;
+					if (this->_comp(this->_heap[parent].val, moved.val) == false)
+						break ;
+					this->_heap[hole] = this->_heap[parent];
+					this->_pos[this->_heap[hole].id] = hole;
+					hole = parent;
+				}
+				this->_heap[hole] = moved;
+				this->_pos[moved.id] = hole;
+				return (hole);
+			}
+
+			size_type	_sift_down(size_type hole)
+			{
+				_entry		moved = this->_heap[hole];
+				size_type	len = this->_heap.size();
+				size_type	child;
+				size_type	best;
+				size_type	end;
+
+				while ((child = Arity * hole + 1) < len)
+				{
+					ft::dary_prefetch_grandchildren<Arity>(this->_heap.begin(), child, len);
+					end = (len - child > Arity ? child + Arity : len);
+					best = child;
+					for (++child; child < end; ++child)
+						if (this->_comp(this->_heap[best].val, this->_heap[child].val))
+							best = child;
+					if (this->_comp(moved.val, this->_heap[best].val) == false)
+						break ;
+					this->_heap[hole] = this->_heap[best];
+					this->_pos[this->_heap[hole].id] = hole;
+					hole = best;
+				}
+				this->_heap[hole] = moved;
+				this->_pos[moved.id] = hole;
+				return (hole);
+			}
+	};
+
+	template <class T, class Compare, std::size_t Arity>
+	const typename indexed_priority_queue<T, Compare, Arity>::size_type	indexed_priority_queue<T, Compare, Arity>::npos;
+}
+
+#endif
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   priorityQueue.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:40:25 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:49:51 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PRIORITY_QUEUE_HPP
+# define PRIORITY_QUEUE_HPP
+
+# include <cstddef>
+# include <algorithm>
+# include <functional>
+
+# include "../vector/vector.hpp"
+# include "../utils/heap.hpp"
+
+/*
+
+	SYNOPSIS : priority_queue is a heap adapter over a container with random access iterators, front,
+	push_back and pop_back (ft::vector by default, ft::deque). top is the greatest element for Compare
+	(std::less : the max). The container and the comparison are the protected members c and comp.
+
+	The heap is a d-ary heap of Arity children per node (see utils/heap.hpp) : 4 by default, 8 for the
+	big heaps of small keys, 2 for the binary heap of std::priority_queue. The constructors build the heap
+	in O(n) with make_dary_heap, from the elements of ctnr (an ft::vector of events...) and the range.
+	The bulk operations :
+	- push_range (first, last) appends the range to c in one insert. A batch at least half as big as the
+	heap rebuilds the whole heap in O(n + k), a smaller one sifts each new element up in O(k log n).
+	- pop_n (n) pops min(n, size ()) elements and returns their number. pop_n (n, out) copies them to out
+	first, in the order pop would give them (greatest first).
+*/
+
+namespace ft
+{
+	template <class T, class Container = ft::vector<T>, class Compare = std::less<typename Container::value_type>,
+		std::size_t Arity = 4>
+	class priority_queue
+	{
+		/* ALIASES */
+		public:
+
+			typedef T											value_type;
+			typedef Container									container_type;
+			typedef Compare										value_compare;
+			typedef typename Container::size_type				size_type;
+			typedef typename Container::reference				reference;
+			typedef typename Container::const_reference			const_reference;
+
+		/* CONSTRUCTORS, DESTRUCTOR */
+
+			explicit priority_queue(const Compare& compare = Compare(), const Container& ctnr = Container())
+			: c(ctnr), comp(compare)
+			{
+				ft::make_dary_heap<Arity>(this->c.begin(), this->c.end(), this->comp);
+			}
+
+			/* the elements of ctnr and the range, heapified once */
+			template <class InputIterator>
+			priority_queue(InputIterator first, InputIterator last, const Compare& compare = Compare(),
+				const Container& ctnr = Container()) : c(ctnr), comp(compare)
+			{
+				this->c.insert(this->c.end(), first, last);
+				ft::make_dary_heap<Arity>(this->c.begin(), this->c.end(), this->comp);
+			}
+
+			virtual ~priority_queue() {}
+
+		/* MEMBER FUNCTIONS */
+
+			bool			empty(void) const { return (this->c.empty()); };
+			size_type		size(void) const { return (this->c.size()); };
+			const_reference	top(void) const { return (this->c.front()); };
+
+			void	push(const value_type& val)
+			{
+				this->c.push_back(val);
+				ft::push_dary_heap<Arity>(this->c.begin(), this->c.end(), this->comp);
+			}
+
+			void	pop(void)
+			{
+				ft::pop_dary_heap<Arity>(this->c.begin(), this->c.end(), this->comp);
+				this->c.pop_back();
+			}
+
+		/* BULK OPERATIONS */
+
+			template <class InputIterator>
+			void	push_range(InputIterator first, InputIterator last)
+			{
+				size_type	old_size = this->c.size();
+
+				this->c.insert(this->c.end(), first, last);
+				if (this->c.size() - old_size >= old_size / 2)
+					ft::make_dary_heap<Arity>(this->c.begin(), this->c.end(), this->comp);
+				else
+					for (size_type i = old_size + 1; i <= this->c.size(); i++)
+						ft::push_dary_heap<Arity>(this->c.begin(), this->c.begin() + i, this->comp);
+			}
+
+			size_type	pop_n(size_type n)
+			{
+				if (n > this->c.size())
+					n = this->c.size();
+				for (size_type i = 0; i < n; i++)
+					ft::pop_dary_heap<Arity>(this->c.begin(), this->c.end() - i, this->comp);
+				this->c.erase(this->c.end() - n, this->c.end());
+				return (n);
+			}
+
+			/* each pop moves the top right after the remaining heap : the popped elements end in
+			reverse order at the end of c */
+			template <class OutputIterator>
+			OutputIterator	pop_n(size_type n, OutputIterator out)
+			{
+				if (n > this->c.size())
+					n = this->c.size();
+				for (size_type i = 0; i < n; i++)
+					ft::pop_dary_heap<Arity>(this->c.begin(), this->c.end() - i, this->comp);
+				out = std::copy(this->c.rbegin(), this->c.rbegin() + n, out);
+				this->c.erase(this->c.end() - n, this->c.end());
+				return (out);
+			}
+
+		protected:
+
+			container_type	c;
+			value_compare	comp;
+	};
+}
+
+#endif
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   queue.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:40:12 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:43:12 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef QUEUE_HPP
+# define QUEUE_HPP
+
+# include <cstddef>
+# include <algorithm>
+
+# include "../deque/deque.hpp"
+
+/*
+
+	SYNOPSIS : queue is a FIFO adapter over a container with front, back, push_back and pop_front
+	(ft::deque by default, std::list...). The container is the protected member c.
+
+	The bulk operations work on the container in one call instead of one per element :
+	- push_range (first, last) pushes the range in its order with one insert at the end of c.
+	- pop_n (n) pops min(n, size ()) elements with one erase at the beginning of c and returns their
+	number. pop_n (n, out) copies them to out first, in the order pop would give them.
+	Both pop_n need random access iterators on the container.
+*/
+
+namespace ft
+{
+	template <class T, class Container = ft::deque<T> >
+	class queue
+	{
+		/* ALIASES */
+		public:
+
+			typedef T											value_type;
+			typedef Container									container_type;
+			typedef typename Container::size_type				size_type;
+			typedef typename Container::reference				reference;
+			typedef typename Container::const_reference			const_reference;
+
+		/* CONSTRUCTORS, DESTRUCTOR */
+
+			explicit queue(const container_type& ctnr = container_type()) : c(ctnr) {}
+
+			virtual ~queue() {}
+
+		/* MEMBER FUNCTIONS */
+
+			bool			empty(void) const { return (this->c.empty()); };
+			size_type		size(void) const { return (this->c.size()); };
+			reference		front(void) { return (this->c.front()); };
+			const_reference	front(void) const { return (this->c.front()); };
+			reference		back(void) { return (this->c.back()); };
+			const_reference	back(void) const { return (this->c.back()); };
+			void			push(const value_type& val) { this->c.push_back(val); };
+			void			pop(void) { this->c.pop_front(); };
+
+		/* BULK OPERATIONS */
+
+			template <class InputIterator>
+			void	push_range(InputIterator first, InputIterator last)
+			{
+				this->c.insert(this->c.end(), first, last);
+			}
+
+			size_type	pop_n(size_type n)
+			{
+				if (n > this->c.size())
+					n = this->c.size();
+				this->c.erase(this->c.begin(), this->c.begin() + n);
+				return (n);
+			}
+
+			template <class OutputIterator>
+			OutputIterator	pop_n(size_type n, OutputIterator out)
+			{
+				if (n > this->c.size())
+					n = this->c.size();
+				out = std::copy(this->c.begin(), this->c.begin() + n, out);
+				this->c.erase(this->c.begin(), this->c.begin() + n);
+				return (out);
+			}
+
+		/* RELATIONAL OPERATORS (on the containers) */
+
+			friend bool	operator==(const queue& lhs, const queue& rhs) { return (lhs.c == rhs.c); };
+			friend bool	operator!=(const queue& lhs, const queue& rhs) { return (lhs.c != rhs.c); };
+			friend bool	operator<(const queue& lhs, const queue& rhs) { return (lhs.c < rhs.c); };
+			friend bool	operator<=(const queue& lhs, const queue& rhs) { return (lhs.c <= rhs.c); };
+			friend bool	operator>(const queue& lhs, const queue& rhs) { return (lhs.c > rhs.c); };
+			friend bool	operator>=(const queue& lhs, const queue& rhs) { return (lhs.c >= rhs.c); };
+
+		protected:
+
+			container_type	c;
+	};
+}
+
+#endif
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:40:12 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:43:12 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STACK_HPP
+# define STACK_HPP
+
+# include <cstddef>
+# include <algorithm>
+
+# include "../deque/deque.hpp"
+
+/*
+
+	SYNOPSIS : stack is a LIFO adapter over a container with back, push_back and pop_back (ft::deque by
+	default, ft::vector, std::list...). The container is the protected member c, so that a derived class
+	can reach it.
+
+	The bulk operations work on the container in one call instead of one per element :
+	- push_range (first, last) pushes the range in its order (the last element ends on top) with one
+	insert at the end of c, which grows the container once when the distance of the range is known.
+	- pop_n (n) pops min(n, size ()) elements with one erase at the end of c and returns their number.
+	pop_n (n, out) copies them to out first, in the order pop would give them (top first).
+	Both pop_n need random access iterators on the container.
+*/
+
+namespace ft
+{
+	template <class T, class Container = ft::deque<T> >
+	class stack
+	{
+		/* ALIASES */
+		public:
+
+			typedef T											value_type;
+			typedef Container									container_type;
+			typedef typename Container::size_type				size_type;
+			typedef typename Container::reference				reference;
+			typedef typename Container::const_reference			const_reference;
+
+		/* CONSTRUCTORS, DESTRUCTOR */
+
+			explicit stack(const container_type& ctnr = container_type()) : c(ctnr) {}
+
+			virtual ~stack() {}
+
+		/* MEMBER FUNCTIONS */
+
+			bool			empty(void) const { return (this->c.empty()); };
+			size_type		size(void) const { return (this->c.size()); };
+			reference		top(void) { return (this->c.back()); };
+			const_reference	top(void) const { return (this->c.back()); };
+			void			push(const value_type& val) { this->c.push_back(val); };
+			void			pop(void) { this->c.pop_back(); };
+
+		/* BULK OPERATIONS */
+
+			template <class InputIterator>
+			void	push_range(InputIterator first, InputIterator last)
+			{
+				this->c.insert(this->c.end(), first, last);
+			}
+
+			size_type	pop_n(size_type n)
+			{
+				if (n > this->c.size())
+					n = this->c.size();
+				this->c.erase(this->c.end() - n, this->c.end());
+				return (n);
+			}
+
+			template <class OutputIterator>
+			OutputIterator	pop_n(size_type n, OutputIterator out)
+			{
+				if (n > this->c.size())
+					n = this->c.size();
+				out = std::copy(this->c.rbegin(), this->c.rbegin() + n, out);
+				this->c.erase(this->c.end() - n, this->c.end());
+				return (out);
+			}
+
+		/* RELATIONAL OPERATORS (on the containers) */
+
+			friend bool	operator==(const stack& lhs, const stack& rhs) { return (lhs.c == rhs.c); };
+			friend bool	operator!=(const stack& lhs, const stack& rhs) { return (lhs.c != rhs.c); };
+			friend bool	operator<(const stack& lhs, const stack& rhs) { return (lhs.c < rhs.c); };
+			friend bool	operator<=(const stack& lhs, const stack& rhs) { return (lhs.c <= rhs.c); };
+			friend bool	operator>(const stack& lhs, const stack& rhs) { return (lhs.c > rhs.c); };
+			friend bool	operator>=(const stack& lhs, const stack& rhs) { return (lhs.c >= rhs.c); };
+
+		protected:
+
+			container_type	c;
+	};
+}
+
+#endif
@@ -0,0 +1,498 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:33:03 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:43:12 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef DEQUE_HPP
+# define DEQUE_HPP
+
+# include <memory>
+# include <cstring>
+# include <cstddef>
+# include <stdexcept>
+# include <algorithm>
+
+# include "./dequeIterator.hpp"
+# include "../utils/reverseIterator.hpp"
+# include "../utils/compare.hpp"
+# include "../utils/isIntegral.hpp"
+# include "../utils/enableIf.hpp"
+# include "../utils/iteratorTraits.hpp"
+
+/*
+
+	SYNOPSIS : deque is a sequence with O(1) amortized insertion and removal at both ends, and random access.
+
+	The elements are stored in blocks of deque_block_size<T>::value elements (4 KiB, 16 elements at
+	least), never moved once constructed. The map is an array of pointers to the blocks : element i is
+	in slot (start + i) / B at offset (start + i) % B. A slot holds a block only while an element lives
+	in it. When an end of the map is reached, the pointers are moved back to the middle of the map, or
+	copied in a map twice bigger : only the pointers move, so references to the elements stay valid
+	across push_back and push_front (iterators do not, as for std::deque).
+
+	A block emptied by pop_front or pop_back goes to a free list (the pointer to the next free block is
+	written in the block itself) and is taken back by the next push before the allocator is called :
+	a queue (push_back, pop_front) cycles through the same few blocks. shrink_to_fit gives the free
+	blocks back to the allocator.
+
+	insert and erase in the middle move the elements on the side of the nearest end (O(min(i, n - i))).
+*/
+
+namespace ft
+{
+	/* elements per block : 4 KiB, and at least 16 for the big types */
+	template <class T>
+	struct deque_block_size
+	{
+		static const std::size_t	value = (sizeof(T) < 256 ? 4096 / sizeof(T) : 16);
+	};
+
+	template <class T, class Alloc = std::allocator<T> >
+	class deque
+	{
+		/* ALIASES */
+		public:
+
+			typedef T																		value_type;
+			typedef Alloc																	allocator_type;
+			typedef typename Alloc::reference												reference;
+			typedef typename Alloc::const_reference											const_reference;
+			typedef typename Alloc::pointer													pointer;
+			typedef typename Alloc::const_pointer											const_pointer;
+			typedef std::size_t																size_type;
+			typedef std::ptrdiff_t															difference_type;
+			typedef typename Alloc::template rebind<pointer>::other							map_allocator_type;
+			/* aliases for iterators */
+			typedef ft::dequeIterator<value_type, ft::deque_block_size<T>::value>			iterator;
+			typedef ft::dequeIterator<value_type, ft::deque_block_size<T>::value, true>		const_iterator;
+			typedef typename ft::reverseIterator<iterator>									reverse_iterator;
+			typedef typename ft::reverseIterator<const_iterator>							const_reverse_iterator;
+
+		/* CONSTRUCTORS, DESTRUCTOR, COPY, OVERLOADING ASSIGNMENT OPERATOR (COPLIEN FORM) */
+
+			explicit deque(const allocator_type& alloc = allocator_type()) : _alloc(alloc), _map_alloc(alloc),
+			_map(nullptr), _map_size(0), _start(0), _size(0), _free(nullptr) {}
+
+			explicit deque(size_type n, const value_type& val = value_type(),
+				const allocator_type& alloc = allocator_type()) : _alloc(alloc), _map_alloc(alloc), _map(nullptr),
+				_map_size(0), _start(0), _size(0), _free(nullptr)
+			{
+				this->assign(n, val);
+			}
+
+			template <class InputIterator>
+			deque(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, int>::type = 0) : _alloc(alloc),
+				_map_alloc(alloc), _map(nullptr), _map_size(0), _start(0), _size(0), _free(nullptr)
+			{
+				this->assign(first, last);
+			}
+
+			deque(const deque& x) : _alloc(x._alloc), _map_alloc(x._map_alloc), _map(nullptr), _map_size(0),
+			_start(0), _size(0), _free(nullptr)
+			{
+				this->assign(x.begin(), x.end());
+			}
+
+			virtual ~deque()
+			{
+				this->clear();
+				this->shrink_to_fit();
+				if (this->_map != nullptr)
+					this->_map_alloc.deallocate(this->_map, this->_map_size);
+			}
+
+			/* the blocks of this deque are kept (in the free list) for the copies */
+			deque& operator=(const deque& x)
+			{
+				if (this != &x)
+					this->assign(x.begin(), x.end());
+				return *this;
+			}
+
+		/* CAPACITY */
+
+			size_type	size(void) const { return (this->_size); };
+			size_type	max_size(void) const { return (this->_alloc.max_size()); };
+			bool		empty(void) const { return (this->_size == 0); };
+
+			void	resize(size_type n, value_type val = value_type())
+			{
+				while (this->_size > n)
+					this->pop_back();
+				while (this->_size < n)
+					this->push_back(val);
+			}
+
+			/* gives the free blocks back to the allocator */
+			void	shrink_to_fit(void)
+			{
+				while (this->_free != nullptr)
+					this->_alloc.deallocate(this->_pop_free(), ft::deque_block_size<T>::value);
+			}
+
+		/* ELEMENT ACCESS */
+
+			reference		operator[](size_type n) { return (*this->_at(this->_start + n)); };
+			const_reference	operator[](size_type n) const { return (*this->_at(this->_start + n)); };
+
+			reference	at(size_type n)
+			{
+				if (n >= this->_size)
+					throw std::out_of_range("deque");
+				return (this->operator[](n));
+			}
+
+			const_reference	at(size_type n) const
+			{
+				if (n >= this->_size)
+					throw std::out_of_range("deque");
+				return (this->operator[](n));
+			}
+
+			reference		front(void) { return (*this->_at(this->_start)); };
+			const_reference	front(void) const { return (*this->_at(this->_start)); };
+			reference		back(void) { return (*this->_at(this->_start + this->_size - 1)); };
+			const_reference	back(void) const { return (*this->_at(this->_start + this->_size - 1)); };
+
+		/* MODIFIERS */
+
+			template <class InputIterator>
+			void	assign(InputIterator first, InputIterator last,
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, int>::type = 0)
+			{
+				this->clear();
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			void	assign(size_type n, const value_type& val)
+			{
+				this->clear();
+				for (size_type i = 0; i < n; i++)
+					this->push_back(val);
+			}
+
+			void	push_back(const value_type& val)
+			{
+				this->_reserve_back(1);
+				this->_construct_back(val);
+			}
+
+			void	push_front(const value_type& val)
+			{
+				this->_reserve_front(1);
+				this->_construct_front(val);
+			}
+
+			/* undefined behaviour if container is empty */
+			void	pop_back(void)
+			{
+				size_type	pos = this->_start + this->_size - 1;
+
+				this->_alloc.destroy(this->_at(pos));
+				this->_size--;
+				if (pos % ft::deque_block_size<T>::value == 0 || this->_size == 0) // last element of its block
+					this->_release(pos);
+			}
+
+			/* undefined behaviour if container is empty */
+			void	pop_front(void)
+			{
+				size_type	pos = this->_start;
+
+				this->_alloc.destroy(this->_at(pos));
+				this->_start++;
+				this->_size--;
+				if (this->_start % ft::deque_block_size<T>::value == 0 || this->_size == 0)
+					this->_release(pos);
+			}
+
+			/* val is added at the nearest end, then rotated to its position */
+			iterator	insert(iterator position, const value_type& val)
+			{
+				return (this->insert(position, 1, val));
+			}
+
+			iterator	insert(iterator position, size_type n, const value_type& val)
+			{
+				size_type	index = position - this->begin();
+
+				if (index < this->_size / 2)
+				{
+					this->_reserve_front(n);
+					for (size_type i = 0; i < n; i++)
+						this->_construct_front(val);
+					std::rotate(this->begin(), this->begin() + n, this->begin() + n + index);
+				}
+				else
+				{
+					this->_reserve_back(n);
+					for (size_type i = 0; i < n; i++)
+						this->_construct_back(val);
+					std::rotate(this->begin() + index, this->end() - n, this->end());
+				}
+				return (this->begin() + index);
+			}
+
+			/* the range is added at the back (the map grows once for forward iterators), then rotated */
+			template <class InputIterator>
+			void	insert(iterator position, InputIterator first, InputIterator last,
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, int>::type = 0)
+			{
+				size_type	index = position - this->begin();
+				size_type	old_size = this->_size;
+
+				this->_append(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+				std::rotate(this->begin() + index, this->begin() + old_size, this->end());
+			}
+
+			iterator	erase(iterator position)
+			{
+				return (this->erase(position, position + 1));
+			}
+
+			/* the elements on the shorter side are moved over the erased ones, then popped */
+			iterator	erase(iterator first, iterator last)
+			{
+				size_type	index = first - this->begin();
+				size_type	n = last - first;
+
+				if (index < (this->_size - n) / 2)
+				{
+					std::copy_backward(this->begin(), first, last);
+					for (size_type i = 0; i < n; i++)
+						this->pop_front();
+				}
+				else
+				{
+					std::copy(last, this->end(), first);
+					for (size_type i = 0; i < n; i++)
+						this->pop_back();
+				}
+				return (this->begin() + index);
+			}
+
+			void	swap(deque& x)
+			{
+				std::swap(this->_alloc, x._alloc);
+				std::swap(this->_map_alloc, x._map_alloc);
+				std::swap(this->_map, x._map);
+				std::swap(this->_map_size, x._map_size);
+				std::swap(this->_start, x._start);
+				std::swap(this->_size, x._size);
+				std::swap(this->_free, x._free);
+			}
+
+			/* the blocks go to the free list, the map is kept */
+			void	clear(void)
+			{
+				while (this->_size > 0)
+					this->pop_back();
+			}
+
+		/* METHOD TO RETURN AN ALLOCATOR */
+
+			allocator_type	get_allocator() const { return (this->_alloc); };
+
+		/* ITERATORS */
+
+			iterator				begin(void) { return (this->_iterator(this->_start)); };
+			const_iterator			begin(void) const { return (this->_iterator(this->_start)); };
+			const_iterator			cbegin(void) const { return (this->_iterator(this->_start)); };
+			iterator				end(void) { return (this->_iterator(this->_start + this->_size)); };
+			const_iterator			end(void) const { return (this->_iterator(this->_start + this->_size)); };
+			const_iterator			cend(void) const { return (this->_iterator(this->_start + this->_size)); };
+			reverse_iterator		rbegin(void) { return (reverse_iterator(this->end())); };
+			const_reverse_iterator	rbegin(void) const { return (const_reverse_iterator(this->end())); };
+			reverse_iterator		rend(void) { return (reverse_iterator(this->begin())); };
+			const_reverse_iterator	rend(void) const { return (const_reverse_iterator(this->begin())); };
+
+		private: // private member data
+
+			allocator_type			_alloc;
+			map_allocator_type		_map_alloc;
+			pointer					*_map;
+			size_type				_map_size; // slots
+			size_type				_start; // position of the first element, counted from the start of slot 0
+			size_type				_size;
+			pointer					_free; // first free block, each one holding the address of the next
+
+		private: // private member methods (helpers)
+
+			/* address of the element at position pos (its block exists) */
+			pointer	_at(size_type pos) const
+			{
+				return (this->_map[pos / ft::deque_block_size<T>::value] + pos % ft::deque_block_size<T>::value);
+			}
+
+			/* address of position pos, taking a block for its slot if it has none */
+			pointer	_slot(size_type pos)
+			{
+				pointer		&block = this->_map[pos / ft::deque_block_size<T>::value];
+
+				if (block == nullptr)
+					block = (this->_free != nullptr ? this->_pop_free()
+						: this->_alloc.allocate(ft::deque_block_size<T>::value));
+				return (block + pos % ft::deque_block_size<T>::value);
+			}
+
+			/* after _reserve_back or _reserve_front */
+			void	_construct_back(const value_type& val)
+			{
+				this->_alloc.construct(this->_slot(this->_start + this->_size), val);
+				this->_size++;
+			}
+
+			void	_construct_front(const value_type& val)
+			{
+				this->_alloc.construct(this->_slot(this->_start - 1), val);
+				this->_start--;
+				this->_size++;
+			}
+
+			template <class InputIterator>
+			void	_append(InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			template <class ForwardIterator>
+			void	_append(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				this->_reserve_back(std::distance(first, last));
+				for (; first != last; ++first)
+					this->_construct_back(*first);
+			}
+
+			iterator	_iterator(size_type pos) const
+			{
+				if (this->_map == nullptr)
+					return (iterator());
+				return (iterator(this->_map + pos / ft::deque_block_size<T>::value,
+					pos % ft::deque_block_size<T>::value));
+			}
+
+			/* the block of position pos has no element anymore : to the free list. An empty deque starts again
+			from the middle of the map */
+			void	_release(size_type pos)
+			{
+				pointer		&block = this->_map[pos / ft::deque_block_size<T>::value];
+
+				std::memcpy(static_cast<void *>(block), &this->_free, sizeof(pointer));
+				this->_free = block;
+				block = nullptr;
+				if (this->_size == 0)
+					this->_start = this->_map_size / 2 * ft::deque_block_size<T>::value;
+			}
+
+			pointer	_pop_free(void)
+			{
+				pointer		block = this->_free;
+
+				std::memcpy(&this->_free, static_cast<void *>(block), sizeof(pointer));
+				return (block);
+			}
+
+			/* room for n elements after the last one, and the slot of the end after them */
+			void	_reserve_back(size_type n)
+			{
+				if (this->_map == nullptr
+					|| (this->_start + this->_size + n) / ft::deque_block_size<T>::value >= this->_map_size)
+					this->_reallocate_map(n, false);
+			}
+
+			/* room for n elements before the first one */
+			void	_reserve_front(size_type n)
+			{
+				if (this->_map == nullptr || this->_start < n)
+					this->_reallocate_map(n, true);
+			}
+
+			/* moves the slots in use (blocks and the slot of the end) to the middle of the map, leaving the
+			slots of n more elements free on the side of at_front. The map is doubled if less than half of it
+			would be free */
+			void	_reallocate_map(size_type n, bool at_front)
+			{
+				const size_type		block = ft::deque_block_size<T>::value;
+				size_type			first = this->_start / block;
+				size_type			used = (this->_map == nullptr ? 1 : (this->_start + this->_size) / block - first + 1);
+				size_type			extra = n / block + 1;
+				size_type			needed = used + extra + 1;
+				size_type			new_size = this->_map_size;
+				size_type			new_first;
+				pointer				*new_map = this->_map;
+
+				if (new_size < 2 * needed)
+				{
+					new_size = std::max(new_size * 2, 2 * needed);
+					if (new_size < 8)
+						new_size = 8;
+					new_map = this->_map_alloc.allocate(new_size);
+				}
+				new_first = (new_size - used - extra) / 2 + (at_front ? extra : 0);
+				if (this->_map != nullptr)
+					std::memmove(new_map + new_first, this->_map + first, used * sizeof(pointer));
+				else
+					new_map[new_first] = nullptr;
+				std::fill(new_map, new_map + new_first, pointer());
+				std::fill(new_map + new_first + used, new_map + new_size, pointer());
+				if (new_map != this->_map && this->_map != nullptr)
+					this->_map_alloc.deallocate(this->_map, this->_map_size);
+				this->_map = new_map;
+				this->_map_size = new_size;
+				this->_start = new_first * block + this->_start % block;
+			}
+	};
+
+	/* OUT OF THE CLASS OVERLOADS FOR OPERATORS */
+
+	template <class T, class Alloc>
+	bool	operator==(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, class Alloc>
+	bool	operator!=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T, class Alloc>
+	bool	operator<(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class T, class Alloc>
+	bool	operator<=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class T, class Alloc>
+	bool	operator>(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class T, class Alloc>
+	bool	operator>=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	template <class T, class Alloc>
+	void	swap(deque<T, Alloc>& x, deque<T, Alloc>& y) { x.swap(y); };
+}
+
+#endif
@@ -0,0 +1,195 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dequeIterator.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:32:01 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:38:00 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef DEQUE_ITERATOR_HPP
+# define DEQUE_ITERATOR_HPP
+
+# include "../utils/iteratorTraits.hpp"
+# include "../utils/enableConst.hpp"
+# include "../utils/enableIf.hpp"
+
+# include <cstddef>
+# include <iterator>
+
+/* random access iterator over the blocks of a deque : the element, the bounds of its block, and the
+slot of the block in the map of the deque. Moving inside a block is moving a pointer, crossing a block
+goes through the map.
+
+The slot after the last block of a deque always exists (maybe without block) : end() is the first
+element of that slot, and an iterator reaching it by ++ gets the same value. */
+
+namespace ft
+{
+	template <typename T, std::size_t BlockSize, bool IsConst = false>
+	class dequeIterator
+	{
+		public:
+
+			/* ALIASES */
+
+			typedef std::random_access_iterator_tag												iterator_category;
+			typedef T																			value_type;
+			typedef std::size_t																	size_type;
+			typedef std::ptrdiff_t																difference_type;
+			typedef typename ft::enable_const<IsConst, value_type*, const value_type*>::type	pointer;
+			typedef typename ft::enable_const<IsConst, value_type&, const value_type&>::type	reference;
+			typedef T**																			map_pointer;
+
+			/* CONSTRUCTOR, DESTRUCTOR, COPY CONSTRUCTOR, OVERLOAD OPERATOR = */
+			dequeIterator(void) : _cur(nullptr), _first(nullptr), _node(nullptr) {};
+
+			/* element number offset of the block in slot node */
+			dequeIterator(map_pointer node, std::size_t offset) : _cur(*node + offset), _first(*node), _node(node) {};
+
+			dequeIterator(const dequeIterator &original) : _cur(original._cur), _first(original._first),
+			_node(original._node) {};
+
+			/* iterator to const_iterator */
+			template <bool OtherConst>
+			dequeIterator(const dequeIterator<T, BlockSize, OtherConst> &original,
+				typename ft::enable_if<IsConst && !OtherConst, int>::type = 0) : _cur(original.base()),
+				_first(original.block()), _node(original.node()) {};
+
+			~dequeIterator() {};
+
+			dequeIterator&	operator=(const dequeIterator &original)
+			{
+				this->_cur = original._cur;
+				this->_first = original._first;
+				this->_node = original._node;
+				return (*this);
+			}
+
+			/* the element, its block and the slot of the block */
+			pointer			base(void) const { return (this->_cur); };
+			pointer			block(void) const { return (this->_first); };
+			map_pointer		node(void) const { return (this->_node); };
+
+			/* ARITHMETICS OPERATORS */
+
+			dequeIterator	operator+(difference_type diff) const { dequeIterator tmp(*this); return (tmp += diff); };
+			dequeIterator	operator-(difference_type diff) const { dequeIterator tmp(*this); return (tmp -= diff); };
+
+			/* INCREMENTATION OPERATORS */
+			dequeIterator&	operator++()
+			{
+				if (++this->_cur == this->_first + BlockSize)
+					this->_set_node(this->_node + 1);
+				return (*this);
+			}
+
+			dequeIterator	operator++(int)
+			{
+				dequeIterator	tmp(*this);
+
+				++(*this);
+				return (tmp);
+			}
+
+			dequeIterator&	operator--()
+			{
+				if (this->_cur == this->_first)
+				{
+					this->_set_node(this->_node - 1);
+					this->_cur = this->_first + BlockSize;
+				}
+				--this->_cur;
+				return (*this);
+			}
+
+			dequeIterator	operator--(int)
+			{
+				dequeIterator	tmp(*this);
+
+				--(*this);
+				return (tmp);
+			}
+
+			/* inside the block, only the pointer moves. Otherwise the slot moves by the quotient (rounded down) */
+			dequeIterator&	operator+=(difference_type diff)
+			{
+				const difference_type	block = static_cast<difference_type>(BlockSize);
+				difference_type			offset = (this->_cur - this->_first) + diff;
+				difference_type			nodes;
+
+				if (offset >= 0 && offset < block)
+				{
+					this->_cur += diff;
+					return (*this);
+				}
+				nodes = (offset >= 0 ? offset / block : -((-offset - 1) / block) - 1);
+				this->_set_node(this->_node + nodes);
+				this->_cur = this->_first + (offset - nodes * block);
+				return (*this);
+			}
+
+			dequeIterator&	operator-=(difference_type diff) { return (*this += -diff); };
+
+			/* OPS WITH POINTERS AND REFERENCES */
+			reference		operator*() const { return (*this->_cur); };
+			reference		operator[](difference_type diff) const { return (*(*this + diff)); };
+			pointer			operator->() const { return (this->_cur); };
+
+		private:
+
+			pointer			_cur;
+			pointer			_first; // first element of the block (nullptr in the slot after the last block)
+			map_pointer		_node;
+
+			void	_set_node(map_pointer node)
+			{
+				this->_node = node;
+				this->_first = *node;
+				this->_cur = this->_first;
+			}
+	};
+
+	/* n + a */
+	template <typename T, std::size_t B, bool IsConst>
+	dequeIterator<T, B, IsConst>	operator+(typename dequeIterator<T, B, IsConst>::difference_type diff,
+		const dequeIterator<T, B, IsConst> &it)
+	{
+		return (it + diff);
+	}
+
+	/* a - b, const and non const mixed */
+	template <typename T, std::size_t B, bool C1, bool C2>
+	std::ptrdiff_t	operator-(const dequeIterator<T, B, C1> &lhs, const dequeIterator<T, B, C2> &rhs)
+	{
+		return ((lhs.node() - rhs.node()) * static_cast<std::ptrdiff_t>(B) + (lhs.base() - lhs.block())
+			- (rhs.base() - rhs.block()));
+	}
+
+	/* EQUIVALENCY OPERATORS, const and non const mixed */
+	template <typename T, std::size_t B, bool C1, bool C2>
+	bool	operator==(const dequeIterator<T, B, C1> &lhs, const dequeIterator<T, B, C2> &rhs)
+	{
+		return (lhs.node() == rhs.node() && lhs.base() == rhs.base());
+	}
+
+	template <typename T, std::size_t B, bool C1, bool C2>
+	bool	operator!=(const dequeIterator<T, B, C1> &lhs, const dequeIterator<T, B, C2> &rhs) { return (!(lhs == rhs)); }
+
+	template <typename T, std::size_t B, bool C1, bool C2>
+	bool	operator<(const dequeIterator<T, B, C1> &lhs, const dequeIterator<T, B, C2> &rhs) { return ((lhs - rhs) < 0); }
+
+	template <typename T, std::size_t B, bool C1, bool C2>
+	bool	operator>(const dequeIterator<T, B, C1> &lhs, const dequeIterator<T, B, C2> &rhs) { return ((lhs - rhs) > 0); }
+
+	template <typename T, std::size_t B, bool C1, bool C2>
+	bool	operator<=(const dequeIterator<T, B, C1> &lhs, const dequeIterator<T, B, C2> &rhs) { return ((lhs - rhs) <= 0); }
+
+	template <typename T, std::size_t B, bool C1, bool C2>
+	bool	operator>=(const dequeIterator<T, B, C1> &lhs, const dequeIterator<T, B, C2> &rhs) { return ((lhs - rhs) >= 0); }
+}
+
+#endif
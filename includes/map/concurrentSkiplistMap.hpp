@@ -0,0 +1,469 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrentSkiplistMap.hpp                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:34:23 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 04:34:23 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_SKIPLIST_MAP_HPP
+# define CONCURRENT_SKIPLIST_MAP_HPP
+
+# include <memory>
+# include <cstddef>
+# include <iterator>
+# include <functional>
+
+# include "../utils/pair.hpp"
+# include "../utils/hash.hpp"
+# include "../utils/epoch.hpp"
+
+/*
+
+	SYNOPSIS : concurrent_skiplist_map is an ordered map shared by several threads, without any lock.
+
+	The keys are stored in a skip list : every node is in the sorted list of level 0, and in the lists
+	of the levels above with a probability 1/4 per level, so that a search skips most of the nodes.
+	The links are only modified with compare-and-swap :
+
+	=>	insert links the new node in level 0 first (the key exists from then on), then in the upper
+		levels one by one.
+	=>	erase marks the links of the node (lowest bit of the pointers), upper levels first. Marking
+		level 0 removes the key. Marked nodes are then unlinked by any thread running into them.
+	=>	find, lower_bound, upper_bound and the iterators never write : they skip the marked nodes, and
+		never wait for other threads.
+
+	An unlinked node can still be read by a thread which reached it before, so it is only freed
+	through the epoch_domain of the map, once no thread can read it anymore.
+
+	Iterators : begin(), find, bounds and insert return iterators to nodes which may be erased and freed
+	by other threads. They can be dereferenced only while the calling thread holds a guard on the map
+	(guard g(map);). Iterating under a guard gives the keys in order, each key present during the whole
+	iteration is visited, keys inserted or erased meanwhile may be visited or not. Values are read-only.
+
+	size() is exact only when no thread is inserting or erasing.
+
+	Contains the following prototypes (public functions only) :
+
+	=>	concurrent_skiplist_map(), ~concurrent_skiplist_map()	// no copy
+	=>	ft::pair<iterator, bool>	insert(const value_type &val);	// does nothing if the key exists
+	=>	size_type				erase(const key_type &k);
+	=>	find, count, lower_bound, upper_bound, begin, end, size, empty
+*/
+
+namespace ft
+{
+	template <
+		class Key,
+		class T,
+		class Compare = std::less<Key>,
+		class Alloc = std::allocator<ft::pair<const Key, T> >
+	>
+	class concurrent_skiplist_map
+	{
+		private:
+
+			/* allocated with room for _level links. _owners : one for the inserting thread and one for
+			the map (released by the erasing thread), the node is retired when both are done with it */
+			struct _node
+			{
+				ft::pair<const Key, T>	_val;
+				int						_level;
+				volatile int			_owners;
+				_node * volatile		_next[1];
+			};
+
+		/* ALIASES */
+		public:
+
+			typedef Key													key_type;
+			typedef T													mapped_type;
+			typedef ft::pair<const Key, T>								value_type;
+			typedef Compare												key_compare;
+			typedef Alloc												allocator_type;
+			typedef typename Alloc::template rebind<char>::other		byte_allocator_type;
+			typedef std::size_t											size_type;
+			typedef std::ptrdiff_t										difference_type;
+			typedef const value_type&									const_reference;
+			typedef const value_type*									const_pointer;
+
+			/* a level is kept with probability 1/4 : 16 levels are enough for 2^32 keys */
+			static const int	max_level = 16;
+
+		/* GUARD : iterators of the map can be used during its lifetime */
+
+			class	guard
+			{
+				public:
+
+					explicit	guard(concurrent_skiplist_map &owner) : _guard(owner._domain) {}
+
+				private:
+
+					guard(const guard &original);
+					guard&	operator=(const guard &original);
+
+					epoch_domain::guard		_guard;
+			};
+
+		/* ITERATOR (read-only, in order, level 0 without the marked nodes) */
+
+			class	const_iterator
+			{
+				public:
+
+					typedef std::forward_iterator_tag		iterator_category;
+					typedef ft::pair<const Key, T>			value_type;
+					typedef std::ptrdiff_t					difference_type;
+					typedef const value_type*				pointer;
+					typedef const value_type&				reference;
+
+					const_iterator(void) : _current(nullptr) {};
+					explicit	const_iterator(_node *current) : _current(current) {};
+
+					reference	operator*(void) const { return (this->_current->_val); };
+					pointer		operator->(void) const { return (&this->_current->_val); };
+
+					const_iterator&	operator++(void)
+					{
+						this->_current = concurrent_skiplist_map::_nextAlive(this->_current, 0);
+						return *this;
+					}
+
+					const_iterator	operator++(int)
+					{
+						const_iterator	tmp(*this);
+
+						++(*this);
+						return (tmp);
+					}
+
+					friend bool	operator==(const const_iterator &alpha, const const_iterator &bravo)
+					{
+						return (alpha._current == bravo._current);
+					}
+
+					friend bool	operator!=(const const_iterator &alpha, const const_iterator &bravo)
+					{
+						return (alpha._current != bravo._current);
+					}
+
+				private:
+
+					_node	*_current;
+			};
+
+			typedef const_iterator										iterator; // values are read-only
+
+		/* CONSTRUCTOR, DESTRUCTOR (no copy). The destructor must run when no other thread uses the map */
+
+			explicit	concurrent_skiplist_map(const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _size(0), _comparator(comp), _alloc(alloc),
+				_byte_alloc(alloc)
+			{
+				this->_head = reinterpret_cast<_node*>(this->_byte_alloc.allocate(_nodeBytes(max_level)));
+				this->_head->_level = max_level;
+				for (int l = 0; l < max_level; l++)
+					this->_head->_next[l] = nullptr;
+			}
+
+			~concurrent_skiplist_map()
+			{
+				_node	*current = _unmarked(this->_head->_next[0]);
+
+				while (current != nullptr)
+				{
+					_node	*next = _unmarked(current->_next[0]);
+
+					this->_freeNode(current);
+					current = next;
+				}
+				this->_byte_alloc.deallocate(reinterpret_cast<char*>(this->_head), _nodeBytes(max_level));
+			}
+
+		/* ITERATORS */
+
+			const_iterator	begin(void) const { return (const_iterator(_nextAlive(this->_head, 0))); };
+			const_iterator	end(void) const { return (const_iterator()); };
+
+		/* CAPACITY */
+
+			size_type	size(void) const { return (this->_size); };
+			bool		empty(void) const { return (this->begin() == this->end()); };
+
+		/* MODIFIERS */
+
+			/* inserts val if its key does not exist yet. The iterator is valid under a guard only */
+			ft::pair<iterator, bool>	insert(const value_type &val)
+			{
+				epoch_domain::guard		guard(this->_domain);
+				_node					*preds[max_level];
+				_node					*succs[max_level];
+				_node					*node = nullptr;
+				int						level = _randomLevel();
+
+				while (true)
+				{
+					if (this->_find(val.first, preds, succs))
+					{
+						if (node != nullptr) // never published
+							this->_freeNode(node);
+						return (ft::make_pair(iterator(succs[0]), false));
+					}
+					if (node == nullptr)
+						node = this->_createNode(val, level);
+					for (int l = 0; l < level; l++)
+						node->_next[l] = succs[l];
+					if (__sync_bool_compare_and_swap(&preds[0]->_next[0], succs[0], node))
+						break ;
+				}
+				__sync_fetch_and_add(&this->_size, 1);
+				this->_linkUpperLevels(node, preds, succs);
+				if (_isMarked(node->_next[0])) // erased meanwhile, maybe linked after its eraser's cleanup
+					this->_find(val.first, preds, succs);
+				this->_release(node);
+				return (ft::make_pair(iterator(node), true));
+			}
+
+			size_type	erase(const key_type &k)
+			{
+				epoch_domain::guard		guard(this->_domain);
+				_node					*preds[max_level];
+				_node					*succs[max_level];
+				_node					*node;
+				_node					*succ;
+
+				if (this->_find(k, preds, succs) == false)
+					return (0);
+				node = succs[0];
+				for (int l = node->_level - 1; l > 0; l--)
+				{
+					succ = node->_next[l];
+					while (_isMarked(succ) == false)
+					{
+						__sync_bool_compare_and_swap(&node->_next[l], succ, _marked(succ));
+						succ = node->_next[l];
+					}
+				}
+				succ = node->_next[0];
+				while (true)
+				{
+					if (_isMarked(succ)) // another thread erased it first
+						return (0);
+					if (__sync_bool_compare_and_swap(&node->_next[0], succ, _marked(succ)))
+						break ;
+					succ = node->_next[0];
+				}
+				__sync_fetch_and_sub(&this->_size, 1);
+				this->_find(k, preds, succs); // unlinks it from every level
+				this->_release(node);
+				return (1);
+			}
+
+		/* OPERATIONS (wait-free, the iterators are valid under a guard only) */
+
+			const_iterator	find(const key_type &k) const
+			{
+				epoch_domain::guard		guard(this->_domain);
+				_node					*node = this->_seek(k, false);
+
+				if (node == nullptr || this->_comparator(k, node->_val.first))
+					return (this->end());
+				return (const_iterator(node));
+			}
+
+			size_type	count(const key_type &k) const
+			{
+				return (this->find(k) != this->end());
+			}
+
+			const_iterator	lower_bound(const key_type &k) const
+			{
+				epoch_domain::guard		guard(this->_domain);
+
+				return (const_iterator(this->_seek(k, false)));
+			}
+
+			const_iterator	upper_bound(const key_type &k) const
+			{
+				epoch_domain::guard		guard(this->_domain);
+
+				return (const_iterator(this->_seek(k, true)));
+			}
+
+		/* OBSERVERS */
+
+			key_compare		key_comp(void) const { return (this->_comparator); };
+			allocator_type	get_allocator(void) const { return (this->_alloc); };
+
+		private:
+
+			concurrent_skiplist_map(const concurrent_skiplist_map &original);
+			concurrent_skiplist_map&	operator=(const concurrent_skiplist_map &original);
+
+			/* marked pointers : the lowest bit of a link tells that its node is erased */
+			static bool		_isMarked(_node *ptr) { return (reinterpret_cast<std::size_t>(ptr) & 1); };
+			static _node	*_marked(_node *ptr) { return (reinterpret_cast<_node*>(reinterpret_cast<std::size_t>(ptr) | 1)); };
+			static _node	*_unmarked(_node *ptr) { return (reinterpret_cast<_node*>(reinterpret_cast<std::size_t>(ptr) & ~static_cast<std::size_t>(1))); };
+
+			/* first node after node at level l whose link is not marked */
+			static _node	*_nextAlive(_node *node, int l)
+			{
+				_node	*next = _unmarked(node->_next[l]);
+
+				while (next != nullptr && _isMarked(next->_next[l]))
+					next = _unmarked(next->_next[l]);
+				return (next);
+			}
+
+			static std::size_t	_nodeBytes(int level)
+			{
+				return (sizeof(_node) + (level - 1) * sizeof(_node*));
+			}
+
+			/* 1 + number of pairs of zero bits of a per-thread xorshift */
+			static int	_randomLevel(void)
+			{
+				static __thread unsigned int	seed = 0;
+				int								level = 1;
+
+				if (seed == 0)
+					seed = static_cast<unsigned int>(ft::hash_mix(reinterpret_cast<std::size_t>(&seed))) | 1;
+				seed ^= seed << 13;
+				seed ^= seed >> 17;
+				seed ^= seed << 5;
+				for (unsigned int bits = seed; level < max_level && (bits & 3) == 0; bits >>= 2)
+					level++;
+				return (level);
+			}
+
+			_node	*_createNode(const value_type &val, int level)
+			{
+				_node	*node = reinterpret_cast<_node*>(this->_byte_alloc.allocate(_nodeBytes(level)));
+
+				this->_alloc.construct(&node->_val, val);
+				node->_level = level;
+				node->_owners = 2;
+				return (node);
+			}
+
+			void	_freeNode(_node *node)
+			{
+				this->_alloc.destroy(&node->_val);
+				this->_byte_alloc.deallocate(reinterpret_cast<char*>(node), _nodeBytes(node->_level));
+			}
+
+			/* called by the epoch domain when nobody can read node anymore */
+			static void	_reclaimNode(void *node, void *map)
+			{
+				static_cast<concurrent_skiplist_map*>(map)->_freeNode(static_cast<_node*>(node));
+			}
+
+			void	_release(_node *node)
+			{
+				if (__sync_sub_and_fetch(&node->_owners, 1) == 0)
+					this->_domain.retire(node, &concurrent_skiplist_map::_reclaimNode, this);
+			}
+
+			/* fills preds and succs with the last node before k and the first node from k at each level,
+			unlinking the marked nodes met on the way. Returns true if k exists */
+			bool	_find(const key_type &k, _node **preds, _node **succs)
+			{
+				while (this->_tryFind(k, preds, succs) == false)
+					;
+				return (succs[0] != nullptr && this->_comparator(k, succs[0]->_val.first) == false);
+			}
+
+			/* false if an unlink failed (the predecessor changed) : the search must restart */
+			bool	_tryFind(const key_type &k, _node **preds, _node **succs)
+			{
+				_node	*pred = this->_head;
+				_node	*curr;
+				_node	*succ;
+
+				for (int l = max_level - 1; l >= 0; l--)
+				{
+					curr = _unmarked(pred->_next[l]);
+					while (curr != nullptr)
+					{
+						succ = curr->_next[l];
+						if (_isMarked(succ))
+						{
+							if (__sync_bool_compare_and_swap(&pred->_next[l], curr, _unmarked(succ)) == false)
+								return (false);
+							curr = _unmarked(succ);
+						}
+						else if (this->_comparator(curr->_val.first, k))
+						{
+							pred = curr;
+							curr = succ;
+						}
+						else
+							break ;
+					}
+					preds[l] = pred;
+					succs[l] = curr;
+				}
+				return (true);
+			}
+
+			/* links node in the levels above 0, stops if it is erased meanwhile */
+			void	_linkUpperLevels(_node *node, _node **preds, _node **succs)
+			{
+				for (int l = 1; l < node->_level; l++)
+				{
+					while (__sync_bool_compare_and_swap(&preds[l]->_next[l], succs[l], node) == false)
+					{
+						_node	*old;
+
+						this->_find(node->_val.first, preds, succs);
+						old = node->_next[l];
+						if (_isMarked(old))
+							return ;
+						if (old != succs[l] && __sync_bool_compare_and_swap(&node->_next[l], old, succs[l]) == false)
+							return ;
+					}
+				}
+			}
+
+			/* first node whose key is not less than k (greater than k if strict), without writing */
+			_node	*_seek(const key_type &k, bool strict) const
+			{
+				_node	*pred = this->_head;
+				_node	*curr = nullptr;
+
+				for (int l = max_level - 1; l >= 0; l--)
+				{
+					curr = _unmarked(pred->_next[l]);
+					while (curr != nullptr)
+					{
+						_node	*succ = curr->_next[l];
+
+						if (_isMarked(succ))
+							curr = _unmarked(succ);
+						else if (strict ? !this->_comparator(k, curr->_val.first) : this->_comparator(curr->_val.first, k))
+						{
+							pred = curr;
+							curr = succ;
+						}
+						else
+							break ;
+					}
+				}
+				return (curr);
+			}
+
+			_node						*_head;
+			volatile long				_size;
+			key_compare					_comparator;
+			allocator_type				_alloc;
+			byte_allocator_type			_byte_alloc;
+			mutable epoch_domain		_domain; // last : destroyed first, frees the retired nodes
+	};
+}
+
+#endif
@@ -0,0 +1,359 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozenMap.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:24:38 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 06:41:32 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FROZEN_MAP_HPP
+# define FROZEN_MAP_HPP
+
+# include <memory>
+# include <cstddef>
+# include <stdexcept>
+# include <functional>
+
+# include "../utils/pair.hpp"
+# include "./map.hpp"
+
+/*
+
+	SYNOPSIS : frozen_map is a read-only copy of a map, built once and then only searched.
+
+	The sorted pairs are stored in a plain array. The keys are copied a second time in a separate
+	array, laid out as an implicit complete binary search tree (no pointer in it : the children of a
+	slot are found by arithmetic). Two layouts are available (frozen_map::layout_type) :
+
+	=>	EYTZINGER : the tree is stored level by level (root at 1, children of i at 2i and 2i + 1).
+		The search is branchless and the keys four levels down are prefetched at each step.
+	=>	VAN_EMDE_BOAS : the tree is cut recursively in a top tree and its bottom trees, each one
+		stored contiguously. Any search path touches O(log_B n) cache lines, whatever the line size B.
+
+	The tree is padded up to 2^h - 1 slots with copies of the greatest key, so that every search
+	runs exactly h steps and ends on the rank of the lower bound in the sorted array.
+
+	Iterators are pointers to the sorted array, and stay valid as long as the frozen_map lives.
+	The input range must be sorted and without duplicate keys (as any range begin(), end() of a map).
+*/
+
+namespace ft
+{
+	template <
+		class Key,
+		class T,
+		class Compare = std::less<Key>,
+		class Alloc = std::allocator<ft::pair<const Key, T> >
+	>
+	class frozen_map
+	{
+		/* ALIASES */
+		public:
+
+			typedef Key														key_type;
+			typedef T														mapped_type;
+			typedef ft::pair<const Key, T>									value_type;
+			typedef Compare													key_compare;
+			typedef Alloc													allocator_type;
+			typedef typename Alloc::template rebind<Key>::other				key_allocator_type;
+			typedef std::size_t												size_type;
+			typedef std::ptrdiff_t											difference_type;
+			typedef const value_type&										const_reference;
+			typedef const value_type*										const_iterator;
+			typedef const_iterator											iterator; // a frozen_map is read-only
+			/* layout of the search keys, chosen at the construction */
+			enum	layout_type { EYTZINGER = 1, VAN_EMDE_BOAS = 2 };
+
+		/* CONSTRUCTORS, DESTRUCTOR, COPY, OVERLOADING ASSIGNMENT OPERATOR (COPLIEN FORM) */
+
+			/* empty frozen_map */
+			explicit	frozen_map(layout_type layout = EYTZINGER, const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _data(nullptr), _keys(nullptr), _size(0),
+				_slots(0), _height(0), _layout(layout), _comparator(comp), _alloc(alloc), _key_alloc(alloc) {}
+
+			/* build from a sorted range of pairs without duplicate keys */
+			template <class InputIterator>
+			frozen_map(InputIterator first, InputIterator last, layout_type layout = EYTZINGER,
+				const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) :
+				_data(nullptr), _keys(nullptr), _size(0), _slots(0), _height(0), _layout(layout),
+				_comparator(comp), _alloc(alloc), _key_alloc(alloc)
+			{
+				this->_build(first, last);
+			}
+
+			/* build from all the elements of a map, in the order of its tree : the const iterators of the
+			map walk it in order (successor links), from its minimum up to and including its maximum */
+			template <class MapAlloc>
+			explicit	frozen_map(const ft::map<Key, T, Compare, MapAlloc> &src, layout_type layout = EYTZINGER) :
+				_data(nullptr), _keys(nullptr), _size(0), _slots(0), _height(0), _layout(layout),
+				_comparator(src.key_comp()), _alloc(allocator_type()), _key_alloc(allocator_type())
+			{
+				typename ft::map<Key, T, Compare, MapAlloc>::const_iterator		first = src.begin();
+				typename ft::map<Key, T, Compare, MapAlloc>::const_iterator		last = src.end();
+
+				this->_build(first, last);
+			}
+
+			frozen_map(const frozen_map &original) : _data(nullptr), _keys(nullptr), _size(0), _slots(0),
+				_height(0), _layout(original._layout), _comparator(original._comparator),
+				_alloc(original._alloc), _key_alloc(original._key_alloc)
+			{
+				this->_build(original.begin(), original.end());
+			}
+
+			~frozen_map() { this->_release(); }
+
+			frozen_map&	operator=(const frozen_map &original)
+			{
+				if (this != &original)
+				{
+					this->_release();
+					this->_layout = original._layout;
+					this->_comparator = original._comparator;
+					this->_build(original.begin(), original.end());
+				}
+				return *this;
+			}
+
+		/* ITERATORS (sorted order) */
+
+			const_iterator	begin(void) const { return (this->_data); };
+			const_iterator	end(void) const { return (this->_data + this->_size); };
+
+		/* CAPACITY */
+
+			bool		empty(void) const { return (this->_size == 0); };
+			size_type	size(void) const { return (this->_size); };
+			layout_type	layout(void) const { return (this->_layout); };
+
+			/* bytes used by the sorted pairs and the search tree (object itself not included) */
+			size_type	footprint(void) const
+			{
+				return (this->_size * sizeof(value_type) + (this->_slots + 1) * sizeof(key_type));
+			}
+
+		/* ELEMENT ACCESS */
+
+			/* returns the value of key if exists, otherwise throw out-of-range exception */
+			const mapped_type&	at(const key_type &k) const
+			{
+				const_iterator		target = this->find(k);
+
+				if (target == this->end())
+					throw std::out_of_range("frozen_map");
+				return (target->second);
+			}
+
+		/* OPERATIONS */
+
+			/* returns an iterator to the element of key k, or end() */
+			const_iterator	find(const key_type &k) const
+			{
+				const_iterator		target = this->lower_bound(k);
+
+				if (target != this->end() && !this->_comparator(k, target->first))
+					return (target);
+				return (this->end());
+			}
+
+			size_type	count(const key_type &k) const
+			{
+				return (this->find(k) != this->end());
+			}
+
+			/* first element whose key is not less than k */
+			const_iterator	lower_bound(const key_type &k) const
+			{
+				return (this->_data + this->_rankOf(k, false));
+			}
+
+			/* first element whose key is greater than k */
+			const_iterator	upper_bound(const key_type &k) const
+			{
+				return (this->_data + this->_rankOf(k, true));
+			}
+
+			ft::pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+			{
+				return (ft::make_pair<const_iterator, const_iterator>(this->lower_bound(k), this->upper_bound(k)));
+			}
+
+		/* OBSERVERS */
+
+			key_compare		key_comp(void) const { return (this->_comparator); };
+			allocator_type	get_allocator(void) const { return (this->_alloc); };
+
+		private:
+
+			value_type				*_data;		// sorted pairs
+			key_type				*_keys;		// search tree, slot 0 unused
+			size_type				_size;
+			size_type				_slots;		// 2^_height - 1
+			size_type				_height;
+			layout_type				_layout;
+			key_compare				_comparator;
+			allocator_type			_alloc;
+			key_allocator_type		_key_alloc;
+			/* van Emde Boas tables, indexed by depth : a node at depth d is the root of a bottom tree
+			of size _vebBottom[d], whose top tree has size _vebTop[d] and is rooted at depth _vebDepth[d] */
+			size_type				_vebTop[64];
+			size_type				_vebBottom[64];
+			size_type				_vebDepth[64];
+
+		private:
+
+			/* BUILD HELPERS */
+
+			template <class InputIterator>
+			void	_build(InputIterator first, InputIterator last)
+			{
+				size_type		n = 0;
+
+				for (InputIterator it = first; it != last; ++it)
+					n++;
+				if (n == 0)
+					return ;
+				this->_data = this->_alloc.allocate(n);
+				for (; first != last; ++first, ++this->_size)
+					this->_alloc.construct(this->_data + this->_size, *first);
+				while (this->_slots < this->_size)
+				{
+					this->_height++;
+					this->_slots = this->_slots * 2 + 1;
+				}
+				if (this->_layout == VAN_EMDE_BOAS)
+					this->_splitVeb(0, this->_height);
+				this->_keys = this->_key_alloc.allocate(this->_slots + 1);
+				this->_key_alloc.construct(this->_keys, this->_data[0].first); // slot 0, never read
+				for (size_type i = 1; i <= this->_slots; i++)
+				{
+					size_type	rank = this->_inOrderRank(i);
+					size_type	slot = (this->_layout == VAN_EMDE_BOAS) ? this->_vebSlot(i) : i;
+
+					if (rank >= this->_size) // padding
+						rank = this->_size - 1;
+					this->_key_alloc.construct(this->_keys + slot, this->_data[rank].first);
+				}
+			}
+
+			void	_release(void)
+			{
+				for (size_type i = 0; i < this->_size; i++)
+					this->_alloc.destroy(this->_data + i);
+				if (this->_data != nullptr)
+					this->_alloc.deallocate(this->_data, this->_size);
+				if (this->_keys != nullptr)
+				{
+					for (size_type i = 0; i <= this->_slots; i++)
+						this->_key_alloc.destroy(this->_keys + i);
+					this->_key_alloc.deallocate(this->_keys, this->_slots + 1);
+				}
+				this->_data = nullptr;
+				this->_keys = nullptr;
+				this->_size = 0;
+				this->_slots = 0;
+				this->_height = 0;
+			}
+
+			/* depth of the node of level-order index i (root is 1, at depth 0) */
+			static size_type	_depthOf(size_type i)
+			{
+				size_type	d = 0;
+
+				while (i >>= 1)
+					d++;
+				return (d);
+			}
+
+			/* rank in sorted order of the node of level-order index i in the complete tree */
+			size_type	_inOrderRank(size_type i) const
+			{
+				size_type	d = _depthOf(i);
+				size_type	first_of_level = (size_type)1 << d;
+
+				return ((2 * (i - first_of_level) + 1) * ((size_type)1 << (this->_height - 1 - d)) - 1);
+			}
+
+			/* cut the subtree of height h rooted at depth top in a top tree of height h / 2
+			and bottom trees of height h - h / 2, then do the same in each part */
+			void	_splitVeb(size_type top, size_type h)
+			{
+				size_type	top_h = h / 2;
+				size_type	bottom_h = h - top_h;
+
+				if (h <= 1)
+					return ;
+				this->_vebDepth[top + top_h] = top;
+				this->_vebTop[top + top_h] = ((size_type)1 << top_h) - 1;
+				this->_vebBottom[top + top_h] = ((size_type)1 << bottom_h) - 1;
+				this->_splitVeb(top, top_h);
+				this->_splitVeb(top + top_h, bottom_h);
+			}
+
+			/* slot of the node of level-order index i in the van Emde Boas layout :
+			its bottom tree comes after the top tree, behind the (i & top size) bottom trees before it */
+			size_type	_vebSlot(size_type i) const
+			{
+				size_type	d = _depthOf(i);
+
+				if (d == 0)
+					return (1);
+				return (this->_vebSlot(i >> (d - this->_vebDepth[d]))
+					+ this->_vebTop[d] + (i & this->_vebTop[d]) * this->_vebBottom[d]);
+			}
+
+			/* SEARCH */
+
+			/* number of keys less than k (or not greater than k if upper is true). The descent goes right
+			when the slot key is before k, which is turned into an index without any branch. After _height
+			steps, i - 2^_height is the number of slots before k in sorted order */
+			size_type	_rankOf(const key_type &k, bool upper) const
+			{
+				size_type	i = 1;
+
+				if (this->_layout == VAN_EMDE_BOAS)
+					return (this->_vebRankOf(k, upper));
+				for (size_type d = 0; d < this->_height; d++)
+				{
+					if (16 * i <= this->_slots)
+						__builtin_prefetch(this->_keys + 16 * i);
+					if (upper)
+						i = 2 * i + !this->_comparator(k, this->_keys[i]);
+					else
+						i = 2 * i + this->_comparator(this->_keys[i], k);
+				}
+				i -= (size_type)1 << this->_height;
+				return ((i < this->_size) ? i : this->_size);
+			}
+
+			/* same descent on the van Emde Boas layout : the slot at depth d is found from the slot of
+			the root of its top tree, kept in slots[] along the path. No prefetch there, a whole bottom
+			tree is already packed in a few cache lines */
+			size_type	_vebRankOf(const key_type &k, bool upper) const
+			{
+				size_type	slots[64];
+				size_type	i = 1;
+
+				for (size_type d = 0; d < this->_height; d++)
+				{
+					if (d == 0)
+						slots[d] = 1;
+					else
+						slots[d] = slots[this->_vebDepth[d]] + this->_vebTop[d]
+							+ (i & this->_vebTop[d]) * this->_vebBottom[d];
+					if (upper)
+						i = 2 * i + !this->_comparator(k, this->_keys[slots[d]]);
+					else
+						i = 2 * i + this->_comparator(this->_keys[slots[d]], k);
+				}
+				i -= (size_type)1 << this->_height;
+				return ((i < this->_size) ? i : this->_size);
+			}
+	};
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/03 15:40:57 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/16 13:41:52 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:54:35 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,8 +20,10 @@
 # include <cstddef>
 # include <sstream>
 # include <functional>
+# include <stdexcept>
 
 # include "../utils/pair.hpp"
+# include "../utils/compare.hpp"
 # include "./mapIterator.hpp"
 # include "../utils/reverseIterator.hpp"
 # include "./trees/binarySearchTree.hpp"
@@ -57,7 +59,7 @@ namespace ft
 			typedef ft::reverseIterator<iterator> 			reverse_iterator;
 			typedef ft::reverseIterator<const_iterator> 	const_reverse_iterator;
 			// tree
-			typedef ft::binarySearchTree<Key, T, Alloc>		binary_tree;
+			typedef ft::binarySearchTree<Key, T, Alloc, Compare>	binary_tree;
 
 		/* CLASS TO COMPARE KEYS */
 
@@ -79,7 +81,7 @@ namespace ft
 
 					bool operator() (const value_type& x, const value_type& y) const
 					{
-						return comp(x._first_type, y._first_type);
+						return comp(x.first, y.first);
 					}
 			};
 
@@ -87,37 +89,33 @@ namespace ft
 
 			/* default constructor, create empty map */
 			explicit	map(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) :
-			 _tree(nullptr), _size(0) , _alloc(alloc), _comparator(comp) {} // to test
+			 _tree(new binary_tree(alloc, comp)), _alloc(alloc) {}
 
 			/* range constructor */
 			template <class InputIterator>
 			map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), 
-					const allocator_type& alloc = allocator_type()) : _tree(nullptr), _size(0),
-					_alloc(alloc), _comparator(comp)  // to test
+					const allocator_type& alloc = allocator_type()) : _tree(new binary_tree(alloc, comp)),
+					_alloc(alloc)
 			{
 				this->insert(first, last);
 			}
 
-			/* copy constructor */
-			map(const map& x) : _tree(x._tree), _size(0), _alloc(x._alloc), _comparator(x._comparator) {}; // to test
+			/* copy constructor : deep copy of the tree of x, cloned node by node (see binarySearchTree). The
+			size is the one of the clone */
+			map(const map& x) : _tree(new binary_tree(*x._tree)), _alloc(x._alloc) {};
 
-			/* destructor */
-			virtual	~map() // to test
+			/* destructor, the tree destroys all its nodes */
+			virtual	~map()
 			{
-				if (this->size() >= 2)
-					this->erase(this->begin(), this->end());
-				else if (this->size() == 1)
-					this->erase(this->begin());
+				delete this->_tree;
 			}
 
-			/* overloading operator = */
-			map&	operator=(const map& x) // to test
+			/* overloading operator = : this map's nodes are destroyed, then the tree of x is cloned */
+			map&	operator=(const map& x)
 			{
 				if (this != &x)
 				{
-					this->_tree = x._tree;
-					this->_size = x._size;
-					this->_comparator = x._comparator;
+					*this->_tree = *x._tree;
 					this->_alloc = x._alloc;
 				}
 				return *this;
@@ -125,75 +123,29 @@ namespace ft
 
 		/* MAP ITERATORS */
 		
-			iterator	begin(void) // to test
-			{
-				iterator	target(this->_tree->getMin());
-
-				return (target);	
-			}
-
-			iterator	end(void) // to test
-			{
-				iterator	target(this->_tree->getMax());
-
-				return (target);
-			}
-
-			const_iterator	cbegin(void) // to test
-			{
-				const_iterator		target(this->_tree->getMin());
-
-				return (target);	
-			}
-
-			const_iterator	cend(void) // to test
-			{
-				const_iterator		target(this->_tree->getMax());
-
-				return (target);
-			}
-
-			reverse_iterator	rbegin(void) // to test
-			{
-				reverse_iterator	target(this->_tree->getMin());
-
-				return (target);	
-			}
-
-			reverse_iterator	rend(void) // to test
-			{
-				reverse_iterator	target(this->_tree->getMax());
-
-				return (target);
-			}
-
-			const_reverse_iterator	crbegin(void) // to test
-			{
-				const_reverse_iterator		target(this->_tree->getMin());
-
-				return (target);
-			}
-
-			const_reverse_iterator	crend(void) // to test
-			{
-				const_reverse_iterator		target(this->_tree->getMax());
-
-				return (target);
-			}
+			iterator		begin(void) { return (iterator(this->_tree->getMin(), this->_tree->getRootAddress())); }
+			const_iterator	begin(void) const { return (const_iterator(this->_tree->getMin(), this->_tree->getRootAddress())); }
+			iterator		end(void) { return (iterator(nullptr, this->_tree->getRootAddress())); }
+			const_iterator	end(void) const { return (const_iterator(nullptr, this->_tree->getRootAddress())); }
+
+			reverse_iterator		rbegin(void) { return (reverse_iterator(this->end())); }
+			const_reverse_iterator	rbegin(void) const { return (const_reverse_iterator(this->end())); }
+			reverse_iterator		rend(void) { return (reverse_iterator(this->begin())); }
+			const_reverse_iterator	rend(void) const { return (const_reverse_iterator(this->begin())); }
 		
 		/* METHODS RELATIVE TO MAP CAPACITY */
 
-			bool	empty(void) const // to test
+			bool	empty(void) const
 			{
 				return (this->_tree->getSize() == 0);
 			}
 
-			size_type	size(void) const // to test
+			size_type	size(void) const
 			{
 				return (this->_tree->getSize());
 			}
 
-			size_type	max_size(void) const // to test
+			size_type	max_size(void) const
 			{
 				return (this->_alloc.max_size());
 			}
@@ -202,115 +154,101 @@ namespace ft
 
 			/* operator[] returns the value of a given key if it exists. Otherwise,
 			it creates it and returns it */
-			mapped_type&	operator[](const key_type& k) // to test
+			mapped_type&	operator[](const key_type& k)
 			{
-				mapped_type		target = this->_tree.getValOfKey(k);
+				mapped_type		*target = this->_tree->getValOfKey(k);
 
 				if (target == nullptr)
-					this->_tree->BinarySearchTreeInsertion(); // change this to RBT
-				return (target);
+					return (this->_tree->binarySearchTreeInsertion(value_type(k, mapped_type()))->_val.second);
+				return (*target);
 			}
 		
 			/* returns the value of key if exists, otherwise throw out-of-range exception */
-			mapped_type&	at(const key_type& k) // to test
+			mapped_type&	at(const key_type& k)
 			{
-				mapped_type		target = this->_tree.getValOfKey(k);
+				mapped_type		*target = this->_tree->getValOfKey(k);
 
 				if (target == nullptr)
 					throw std::out_of_range("map");
-				return (target);
+				return (*target);
 			}
 
 			/* returns the value of key if exists, otherwise throw out-of-range exception */			
-			const mapped_type&	at(const key_type& k) const // to test
+			const mapped_type&	at(const key_type& k) const
 			{
-				const mapped_type		target = this->_tree.getValOfKey(k);
+				const node		*target = this->_tree->lookupNode(k);
 
 				if (target == nullptr)
 					throw std::out_of_range("map");
-				return (target);
+				return (target->_val.second);
 			}
 
 		/* METHODS RELATIVE TO MAP MODIFICATION */
 
-			/* inserts a single element */
-			pair<iterator, bool>	insert(const value_type& val) // to test
+			/* inserts a single element, returns it (or the element of the same key) and whether it was inserted */
+			pair<iterator, bool>	insert(const value_type& val)
 			{
-				iterator	it = this->begin();
+				node	*target = this->_tree->getNode(val.first);
 
-				// verif key does not exists
-				if (this->_tree->IsKeyAlreadyExisting(val.first) == false)
-				{
-					while (it->first != val.first) // while *it is not equal to already existing key
-						it++;
-					return (ft::make_pair<iterator, bool>(it, false));
-				}
-				this->_tree->BinarySearchTreeInsertion(val); // replace by RBT insertion
-				while (it->first != val.first) // while *it is not equal to inserted key
-					it++;
-				return (ft::make_pair<iterator, bool>(it, true));
+				if (target != nullptr)
+					return (ft::make_pair(this->_iterator(target), false));
+				target = this->_tree->binarySearchTreeInsertion(val);
+				return (ft::make_pair(this->_iterator(target), true));
 			}
 
-			/* insert a single value at iterators position */
-			iterator	insert(iterator position, const value_type& val) // pb understanding
+			/* the position is only a hint : the element goes where its key belongs */
+			iterator	insert(iterator position, const value_type& val)
 			{
-				// TODO
+				(void)position;
+				return (this->insert(val).first);
 			}
 
 			/* inserts a range of values */
 			template<class InputIterator>
-			void	insert(InputIterator first, InputIterator last) // to test
+			void	insert(InputIterator first, InputIterator last)
 			{
-				while (first != last)
-				{
-					this->_tree->BinarySearchTreeInsertion(*first); // replace by red black tree insertion	
-					first++;
-				}
+				for (; first != last; ++first)
+					this->insert(*first);
 			}
 
-			/* erase some node at position position */
-			void	erase(iterator position) // to test
+			/* erase the element at position */
+			void	erase(iterator position)
 			{
 				this->_tree->deleteNode(position->first);
 			}
 
-			/* erase a range of size_type iterators */
-			size_type	erase(const key_type& k) // to test
+			/* erase the element of key k, returns the number of elements erased (0 or 1) */
+			size_type	erase(const key_type& k)
 			{
-				if (this->find(k) == this->end())
+				if (this->_tree->getNode(k) == nullptr)
 					return (0);
-				this->erase(this->find(k));
+				this->_tree->deleteNode(k);
 				return (1);
 			}
 
 			/* erase a range of iterators */
-			void	erase(iterator first, iterator last) // to test
+			void	erase(iterator first, iterator last)
 			{
 				while (first != last)
-				{
-					this->erase(first);
-					first++;
-				}
+					this->erase(first++);
 			}
 
-			/* swap all the private attributes of two maps (this and x) */
-			void	swap(map& x) // to test
+			/* swap all the private attributes of two maps (this and x). Only the tree pointers are swapped,
+			no node is copied */
+			void	swap(map& x)
 			{	
-				binary_tree					tmp_tree = x._tree;
+				binary_tree					*tmp_tree = x._tree;
 				allocator_type				tmp_alloc = x._alloc;
-				key_compare					tmp_comparator = x._comparator;
 
 				x._tree = this->_tree;
 				x._alloc = this->_alloc;
-				x._comparator = this->_comparator;
 
 				this->_tree = tmp_tree;
 				this->_alloc = tmp_alloc;
-				this->_comparator = tmp_comparator;
 			}
 
 			/* delete all nodes and values */
-			void	clear(void) // to test
+			void	clear(void)
 			{
 				this->_tree->postOrderTraversalDeletion(this->_tree->getRoot());
 			}
@@ -319,193 +257,334 @@ namespace ft
 
 			key_compare	key_comp(void) const
 			{
-				// TO IMPLEMENT
+				return (this->_tree->key_comp());
 			}
 
 			value_compare	value_comp(void) const
 			{
-				// TO IMPLEMENT
+				return (value_compare(this->_tree->key_comp()));
 			}
 
 		/* METHODS USED FOR OPERATIONS */
 
 			/* Searches the container for an element with a key equivalent to k
 			and returns an iterator to it if found, otherwise it returns an iterator to map::end. */
-			iterator	find(const key_type& k) // to test
+			iterator	find(const key_type& k)
 			{
-				iterator		res = this->begin();
-				
-				while (res != this->end())
-				{
-					if ((*res).first == k)
-						break ;
-					res++;
-				}
-				return (res);
+				return (this->_iterator(this->_tree->getNode(k)));
 			}
 
-			/* Searches the container for an element with a key equivalent to k
-			and returns an iterator to it if found, otherwise it returns an iterator to map::end. */
-			const_iterator	find(const key_type& k) const // to test
+			/* the const lookups only read the tree (their descents are not counted in stats) */
+			const_iterator	find(const key_type& k) const
 			{
-				iterator		res = this->begin();
-				
-				while (res != this->end())
-				{
-					if ((*res).first == k)
-						break ;
-					res++;
-				}
-				
-				const_iterator	const_res(res); // check this
-				
-				return (const_res);
+				return (const_iterator(this->_tree->lookupNode(k), this->_tree->getRootAddress()));
 			}
 
 			/* Searches the container for elements with a key equivalent to k and returns the number of matches.
 			There is no duplicte keys in map, so result is either 0 or 1 */
-			size_type	count(const key_type& k) const // to test
+			size_type	count(const key_type& k) const
 			{
-				if (this->find(k) == this->end())
-					return (0);
-				return (1);
+				return (this->_tree->lookupNode(k) == nullptr ? 0 : 1);
 			}
 
-			/* return either the key if existing or the first elem that is not less than key k */
-			iterator	lower_bound(const key_type& k) // to test
+			/* first element whose key is not less than k */
+			iterator	lower_bound(const key_type& k)
 			{
-				iterator		it = this->begin();
-
-				while (it != this->end())
-				{
-					if (key_comp((*it).first, k) == false)
-						break ;
-					it++;
-				}
-				return (it);
+				return (this->_iterator(this->_tree->getBound(k, false)));
 			}
 
-			const_iterator	lower_bound(const key_type& k) const // to test
+			const_iterator	lower_bound(const key_type& k) const
 			{
-				iterator		it = this->begin();
-
-				while (it != this->end())
-				{
-					if (key_comp((*it).first, k) == false)
-						break ;
-					it++;
-				}
-				
-				const_iterator	it_const(it);
-
-				return (it_const);				
+				return (const_iterator(this->_tree->getBound(k, false), this->_tree->getRootAddress()));
 			}
 
-			/* return either the next if key exists or the element after the first elem that is not less than key k */
-			iterator	upper_bound(const key_type& k) // to test
+			/* first element whose key is greater than k */
+			iterator	upper_bound(const key_type& k)
 			{
-				iterator		it = this->begin();
-
-				while (it != this->end())
-				{
-					if (key_comp((*it).first, k) == false)
-						break ;
-					it++;
-				}
-				it++;
-				return (it);
+				return (this->_iterator(this->_tree->getBound(k, true)));
 			}
 
-			const_iterator	upper_bound(const key_type& k) const // to test
+			const_iterator	upper_bound(const key_type& k) const
 			{
-				iterator		it = this->begin();
-
-				while (it != this->end())
-				{
-					if (key_comp((*it).first, k) == false)
-						break ;
-					it++;
-				}
-				it++;
-				
-				const_iterator	it_const(it);
-
-				return (it_const);	
+				return (const_iterator(this->_tree->getBound(k, true), this->_tree->getRootAddress()));
 			}
 			
 			/* returns a pair with first elem equal to lower_bound and second second elem equal to upper_bound */
-			pair<iterator,iterator>	equal_range(const key_type& k) // to test
+			pair<iterator,iterator>	equal_range(const key_type& k)
 			{
-				iterator		lower = this->lower_bound(k);
-				iterator		upper = this->upper_bound(k);
+				return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
+			}
 
-				return (ft::make_pair<iterator, iterator>(lower, upper));
+			pair<const_iterator,const_iterator>	equal_range(const key_type& k) const
+			{
+				return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
 			}
 
-			pair<const_iterator,const_iterator>	equal_range(const key_type& k) const // to test
+		/* BATCHED OPERATIONS */
+
+			/* looks up every key of the range [first, last) and writes, in the same order, an iterator
+			to the matching element (or map::end) into out. Returns out past the last written iterator.
+			A sorted batch is merge-walked through the tree : the path shared by two consecutive keys
+			is traversed once. An unsorted batch interleaves several descents and prefetches the next
+			node of each of them, so that a cache miss in one descent is hidden behind the others */
+			template <class ForwardIterator, class OutputIterator>
+			OutputIterator	find_many(ForwardIterator first, ForwardIterator last, OutputIterator out)
 			{
-				const_iterator		lower = this->lower_bound(k);
-				const_iterator		upper = this->upper_bound(k);
+				_findSink<OutputIterator>		sink(this->end(), out);
 
-				return (ft::make_pair<const_iterator, const_iterator>(lower, upper));
+				this->_batchSearch(first, last, sink);
+				return (sink.out);
 			}
-		
+
+			/* same as find_many, but writes the number of matches (0 or 1) of each key into out */
+			template <class ForwardIterator, class OutputIterator>
+			OutputIterator	count_many(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+			{
+				_countSink<OutputIterator>		sink(out);
+
+				this->_batchSearch(first, last, sink);
+				return (sink.out);
+			}
+
+		/* INSTRUMENTATION */
+
+			/* counters of the underlying tree (zeros unless built with FT_CONTAINERS_STATS) */
+			tree_stats	stats(void) const
+			{
+				return (this->_tree->stats());
+			}
+
 		/* METHOD FOR GETTING ALLOCATORS */
 		
-			allocator_type	get_allocator(void) const // to test
+			allocator_type	get_allocator(void) const
 			{
 				return (this->_alloc);
 			}
 		
 		private:
 
+			typedef typename binary_tree::node		node;
+
 			binary_tree			*_tree;
-			size_type			_size;
 			allocator_type		_alloc;
-			key_compare			_comparator;
+
+		private:
+
+			/* iterator on a node of the tree, end() for nullptr */
+			iterator	_iterator(node *target) const
+			{
+				return (iterator(target, this->_tree->getRootAddress()));
+			}
+
+			/* number of descents run side by side by the unsorted batch search */
+			static const std::size_t	_batch_lanes = 8;
+
+			/* BATCH HELPERS */
+
+			/* receives the node found for each key of a batch (nullptr if the key is missing) */
+			template <class OutputIterator>
+			struct _findSink
+			{
+				iterator		end;
+				OutputIterator	out;
+
+				_findSink(iterator e, OutputIterator o) : end(e), out(o) {};
+
+				void	operator()(node *target)
+				{
+					*this->out = iterator(target, this->end.root());
+					++this->out;
+				}
+			};
+
+			template <class OutputIterator>
+			struct _countSink
+			{
+				OutputIterator	out;
+
+				_countSink(OutputIterator o) : out(o) {};
+
+				void	operator()(node *target)
+				{
+					*this->out = (target == nullptr) ? 0 : 1;
+					++this->out;
+				}
+			};
+
+			/* dispatch a batch to the merge walk if keys are sorted, to the interleaved search otherwise.
+			All of them compare with the comparator of the tree, which ordered the nodes */
+			template <class ForwardIterator, class Sink>
+			void	_batchSearch(ForwardIterator first, ForwardIterator last, Sink &sink) const
+			{
+				node			*root = (this->_tree == nullptr) ? nullptr : this->_tree->getRoot();
+				key_compare		comp = (this->_tree == nullptr) ? key_compare() : this->_tree->key_comp();
+
+				if (root == nullptr) // empty map : every key is missing
+				{
+					for (; first != last; ++first)
+						sink(nullptr);
+				}
+				else if (this->_isSortedBatch(first, last, comp))
+					this->_sortedBatchSearch(root, first, last, sink, comp);
+				else
+					this->_interleavedBatchSearch(root, first, last, sink, comp);
+			}
+
+			/* returns true if no key of the batch is less than the key before it (duplicates allowed) */
+			template <class ForwardIterator>
+			bool	_isSortedBatch(ForwardIterator first, ForwardIterator last, const key_compare &comp) const
+			{
+				ForwardIterator		next = first;
+
+				if (first == last)
+					return (true);
+				while (++next != last)
+				{
+					if (comp(*next, *first))
+						return (false);
+					first = next;
+				}
+				return (true);
+			}
+
+			/* each key is searched from the deepest node of the previous descent. Since keys are sorted,
+			that node's subtree can only be too low for the new key : we climb until we find an ancestor
+			whose upper bound (first ancestor reached through a left link) is greater than the key,
+			then descend from the lowest node sharing that bound */
+			template <class ForwardIterator, class Sink>
+			void	_sortedBatchSearch(node *root, ForwardIterator first, ForwardIterator last, Sink &sink,
+				const key_compare &comp) const
+			{
+				node	*deepest = root;
+
+				for (; first != last; ++first)
+				{
+					node	*x = deepest;
+					node	*start = deepest;
+
+					while (x->_parent != nullptr)
+					{
+						if (x == x->_parent->_left)
+						{
+							if (comp(*first, x->_parent->_val.first))
+								break ;
+							start = x->_parent;
+						}
+						x = x->_parent;
+					}
+					sink(this->_descend(start, *first, deepest, comp));
+				}
+			}
+
+			/* runs up to _batch_lanes descents at once, one level per lane and per round. The child
+			reached by a lane is prefetched, and is only read when the lane comes back to it */
+			template <class ForwardIterator, class Sink>
+			void	_interleavedBatchSearch(node *root, ForwardIterator first, ForwardIterator last, Sink &sink,
+				const key_compare &comp) const
+			{
+				ForwardIterator		keys[_batch_lanes];
+				node				*cur[_batch_lanes];
+				node				*found[_batch_lanes];
+
+				while (first != last)
+				{
+					std::size_t		lanes = 0;
+					std::size_t		active;
+
+					for (; first != last && lanes < _batch_lanes; ++first, ++lanes)
+					{
+						keys[lanes] = first;
+						cur[lanes] = root;
+						found[lanes] = nullptr;
+					}
+					active = lanes;
+					while (active > 0)
+					{
+						for (std::size_t i = 0; i < lanes; i++)
+						{
+							if (cur[i] == nullptr)
+								continue ;
+							if (comp(*keys[i], cur[i]->_val.first))
+								cur[i] = cur[i]->_left;
+							else if (comp(cur[i]->_val.first, *keys[i]))
+								cur[i] = cur[i]->_right;
+							else
+							{
+								found[i] = cur[i];
+								cur[i] = nullptr;
+							}
+							if (cur[i] != nullptr)
+								__builtin_prefetch(cur[i]);
+							else
+								active--;
+						}
+					}
+					for (std::size_t i = 0; i < lanes; i++)
+						sink(found[i]);
+				}
+			}
+
+			/* standard BST search from start, using the tree comparator. deepest is set to the
+			last node visited, where the next key of a sorted batch starts climbing */
+			node	*_descend(node *start, const key_type &k, node *&deepest, const key_compare &comp) const
+			{
+				node	*x = start;
+
+				while (x != nullptr)
+				{
+					deepest = x;
+					if (comp(k, x->_val.first))
+						x = x->_left;
+					else if (comp(x->_val.first, k))
+						x = x->_right;
+					else
+						return (x);
+				}
+				return (nullptr);
+			}
 	};
 	
 	template <class Key, class T, class Compare, class Alloc>
-	bool	operator==(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) // to test
+	bool	operator==(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
 	{
 		if (lhs.size() != rhs.size())
 			return (false);
 		else
-			return (equal(lhs.begin(), lhs.end(), rhs.begin()));
+			return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 	}
 
 	template <class Key, class T, class Compare, class Alloc>
-	bool	operator!=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) // to test
+	bool	operator!=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
 	{
-		return (!lhs == rhs);
+		return (!(lhs == rhs));
 	}
 
 	template <class Key, class T, class Compare, class Alloc>
-	bool	operator<(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) // to test
+	bool	operator<(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
 	{
-		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); // ?
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 	}
 
 	template <class Key, class T, class Compare, class Alloc>
-	bool	operator<=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) // to test
+	bool	operator<=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
 	{
 		return (!(rhs < lhs));
 	}
 
 	template <class Key, class T, class Compare, class Alloc>
-	bool	operator>(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) // to test
+	bool	operator>(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
 	{
 		return (rhs < lhs);
 	}
 
 	template <class Key, class T, class Compare, class Alloc>
-	bool	operator>=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) // to test
+	bool	operator>=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
 	{
 		return (!(lhs < rhs));
 	}
 
 	template <class Key, class T, class Compare, class Alloc>
-	void	swap(map<Key, T, Compare, Alloc>& lhs, map<Key, T, Compare, Alloc>& rhs) { lhs.swap(rhs); }; // to test
+	void	swap(map<Key, T, Compare, Alloc>& lhs, map<Key, T, Compare, Alloc>& rhs) { lhs.swap(rhs); };
 }
 
 #endif
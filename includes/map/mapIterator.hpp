@@ -6,7 +6,7 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/03 15:41:03 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/15 11:56:42 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:32:13 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,17 +15,17 @@
 
 # include "../utils/iteratorTraits.hpp"
 # include "../utils/enableConst.hpp"
+# include "../utils/enableIf.hpp"
 # include "../utils/pair.hpp"
 # include "./node.hpp"
 
-# include <limits>
-# include <memory>
-# include <vector>
 # include <cstddef>
-# include <sstream>
-# include <functional>
 # include <iterator>
 
+/* bidirectional iterator over the nodes of a tree, in key order. end() holds no node : it keeps the
+address of the root of its tree instead, so that --end() reaches the greatest node even after
+insertions changed the root. An iterator converts to a const_iterator (not the opposite) */
+
 namespace ft
 {
 	template <class Key, class T, bool IsConst = false> // non const by default
@@ -44,64 +44,58 @@ namespace ft
 			typedef std::size_t																	size_type;
 			typedef typename ft::enable_const<IsConst, value_type*, const value_type*>::type	pointer;
 			typedef typename ft::enable_const<IsConst, value_type&, const value_type&>::type	reference;
-
-		private:
-
-			typedef Node<Key, T>			node;
+			typedef Node<Key, T>																node;
 
 		public:
 
 			/* CONSTRUCTORS, DESTRUCTORS, OVERLOAD OPERATOR = */
 			
-			mapIterator(void) : _node(nullptr), _end_reached(false) {}; // to test
+			mapIterator(void) : _node(nullptr), _root(nullptr) {};
 
-			mapIterator(node *target) : _node(target), _end_reached(false) // to test
-			{
-				if (target == nullptr)
-					this->_end_reached = true;
-			}
+			/* target is nullptr for end(), root is the address of the root pointer of the tree */
+			mapIterator(node *target, node *const *root) : _node(target), _root(root) {}
+
+			mapIterator(const mapIterator &original) : _node(original._node), _root(original._root) {};
 
-			mapIterator(const mapIterator<Key, T, IsConst> &original) : _node(original._node),
-			_end_reached(original._end_reached) {}; // to test
+			/* conversion of an iterator to a const_iterator */
+			template <bool WasConst>
+			mapIterator(const mapIterator<Key, T, WasConst> &original,
+				typename ft::enable_if<!WasConst || IsConst>::type* = 0) : _node(original.base()),
+				_root(original.root()) {};
 
-			~mapIterator() {}; // to test
+			~mapIterator() {};
 			
-			mapIterator&	operator=(const mapIterator<Key, T> &original) // to test
+			mapIterator&	operator=(const mapIterator &original)
 			{
-				if (this != &original)
-				{
-					this->_node = original._node;
-					this->_end_reached = original._end_reached;
-				}
+				this->_node = original._node;
+				this->_root = original._root;
 				return *this;
 			}
 
+			/* GETTERS */
+
+			node		*base(void) const { return (this->_node); };
+			node *const	*root(void) const { return (this->_root); };
+
 			/* OVERLOADS OPERATORS */
-			mapIterator&	operator++(void) // to test
-			{
-				node		*tmp = this->_node;
 
-				tmp->getTreeSucc(tmp);
-				if (tmp == nullptr)
-					this->_end_reached = true;
-				else
-					this->_node = tmp;
+			mapIterator&	operator++(void)
+			{
+				this->_node = node::getTreeSucc(this->_node);
 				return *this;
 			}
 
-			mapIterator&	operator--(void) // to test
+			/* from end(), goes back to the greatest node */
+			mapIterator&	operator--(void)
 			{
-				node		*tmp = this->_node;
-				
-				tmp->getTreePred(tmp);
-				if (tmp == nullptr)
-					this->_end_reached = true;
+				if (this->_node == nullptr)
+					this->_node = node::getTreeMax(*this->_root);
 				else
-					this->_node = tmp;
+					this->_node = node::getTreePred(this->_node);
 				return *this;
 			}
 
-			mapIterator&	operator++(int) // to test
+			mapIterator		operator++(int)
 			{
 				mapIterator		tmp(*this);
 				
@@ -109,7 +103,7 @@ namespace ft
 				return (tmp);
 			}
 
-			mapIterator&	operator--(int) // to test
+			mapIterator		operator--(int)
 			{
 				mapIterator		tmp(*this);
 				
@@ -117,33 +111,35 @@ namespace ft
 				return (tmp);
 			}
 
-			reference	operator*(void) const // to test
+			reference	operator*(void) const
 			{
 				return (this->_node->_val);			
 			}
 
-			pointer		operator->(void) const // to test
+			pointer		operator->(void) const
 			{
 				return (&this->_node->_val);
 			}
 
-			/* EQUIVALENCY OPERATORS */
-
-			friend bool	operator==(const mapIterator &alpha, const mapIterator &bravo)
-			{
-				// TO IMPLEMENT
-			}
-
-			friend bool	operator!=(const mapIterator &alpha, const mapIterator &bravo)
-			{
-				// TO IMPLEMENT
-			}
-
 		private:
 
 			node		*_node;
-			bool		_end_reached;
+			node *const	*_root;
 	};
+
+	/* EQUIVALENCY OPERATORS (between iterators and const_iterators too) */
+
+	template <class Key, class T, bool IsConstA, bool IsConstB>
+	bool	operator==(const mapIterator<Key, T, IsConstA> &alpha, const mapIterator<Key, T, IsConstB> &bravo)
+	{
+		return (alpha.base() == bravo.base());
+	}
+
+	template <class Key, class T, bool IsConstA, bool IsConstB>
+	bool	operator!=(const mapIterator<Key, T, IsConstA> &alpha, const mapIterator<Key, T, IsConstB> &bravo)
+	{
+		return (alpha.base() != bravo.base());
+	}
 }
 
 #endif
@@ -6,26 +6,23 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/22 17:52:54 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/16 14:08:36 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:38:38 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef NODE_HPP
 # define NODE_HPP
 
-#include <functional>
-#include <memory>
-#include <iostream>
-#include <string>
+# include <cstddef>
 
 # include "../utils/pair.hpp"
-# include "./mapIterator.hpp"
-# include "../utils/reverseIterator.hpp"
-# include "./trees/binarySearchTree.hpp"
+
+/* node shared by the tree engines (binarySearchTree, AVLTree, redBlackTree) and walked by mapIterator.
+The tree walks are static : they take the node to start from and return nullptr past the last node */
 
 namespace ft
 {
-	template <typename Key, typename T, class Alloc>
+	template <typename Key, typename T>
 	class Node
 	{
 		
@@ -35,41 +32,27 @@ namespace ft
 			typedef Key										key_type;
 			typedef T										mapped_type;
 			typedef ft::pair<const Key, T>					value_type;
-			typedef Alloc									allocator_type;
 			typedef typename std::size_t 					size_type;
 			typedef typename std::ptrdiff_t 				difference_type;
+			/* colors of the nodes of a redBlackTree (Node::RED, Node::BLACK) */
+			enum	color { BLACK, RED };
 			
 			/* CONSTRUCTORS AND DESTRUCTORS, OVERLOADING OPERATOR = */
 
-			Node(value_type pair) : _parent(nullptr), _left(nullptr), _right(nullptr) 
-			{
-				this->_alloc.construct(); 
-			};
+			Node(const value_type &val) : _val(val), _parent(nullptr), _left(nullptr), _right(nullptr), _bf(0),
+			_color(BLACK) {};
 			
 			~Node() {}
 
 			Node(const Node &original) : _val(original._val), _parent(original._parent),
-			_left(original._left), _right(original._right) {};
-
-			Node&	operator=(const Node &original)
-			{
-				if (this != &original)
-				{
-					this->_val = original._val;
-					this->_parent = original._parent;
-					this->_left = original._left;
-					this->_right = original._right;
-				}
-				return *this;
-			}
+			_left(original._left), _right(original._right), _bf(original._bf), _color(original._color) {};
 
 			/* GETTERS */
 
-			Node	*getTreeSearch(Node *x, const Key k) { return this->_treeSearch(x, k); };
-			Node	*getTreeMin(Node *x) { return this->_treeMinimum(x); };
-			Node	*getTreeMax(Node *x) { return this->_treeMaximun(x); };
-			Node	*getTreeSucc(Node *x) { return this->_treeSuccessor(x); };
-			Node	*getTreePred(Node *x) { return this->_treePredecessor(x); };
+			static Node	*getTreeMin(Node *x) { return _treeMinimum(x); };
+			static Node	*getTreeMax(Node *x) { return _treeMaximun(x); };
+			static Node	*getTreeSucc(Node *x) { return _treeSuccessor(x); };
+			static Node	*getTreePred(Node *x) { return _treePredecessor(x); };
 
 		public:
 		
@@ -77,35 +60,32 @@ namespace ft
 			Node				*_parent;
 			Node				*_left;
 			Node				*_right;
-			allocator_type		_alloc;
+			int					_bf; // used for AVL
+			color				_color; // used for RBT
 
 		private:
 
-			Node	*_treeSearch(Node *x, const Key k) // to test
-			{
-				if (x == nullptr || k == x->_val.first)
-					return (x);
-				if (k < x->_val.first)
-					return (_treeSearch(x->_left, k));
-				else
-					return (_treeSearch(x->_right, k));
-			}
+			Node&	operator=(const Node &original); // _val.first is const
 
-			Node	*_treeMinimum(Node *x) // to test
+			static Node	*_treeMinimum(Node *x)
 			{
+				if (x == nullptr)
+					return (nullptr);
 				while (x->_left != nullptr)
 					x = x->_left;
 				return (x);
 			}
 
-			Node	*_treeMaximun(Node *x) // to test
+			static Node	*_treeMaximun(Node *x)
 			{
+				if (x == nullptr)
+					return (nullptr);
 				while (x->_right != nullptr)
 					x = x->_right;
 				return (x);
 			}
 
-			Node	*_treeSuccessor(Node *x) // to test
+			static Node	*_treeSuccessor(Node *x)
 			{
 				if (x->_right != nullptr)
 					return (_treeMinimum(x->_right));
@@ -120,10 +100,10 @@ namespace ft
 				return (y);
 			}
 
-			Node	*_treePredecessor(Node *x) // to test
+			static Node	*_treePredecessor(Node *x)
 			{
 				if (x->_left != nullptr)
-					return (_treeMinimum(x->_left));
+					return (_treeMaximun(x->_left));
 				
 				Node	*y = x->_parent;
 
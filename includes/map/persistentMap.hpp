@@ -0,0 +1,529 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistentMap.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:26:48 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 04:26:48 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PERSISTENT_MAP_HPP
+# define PERSISTENT_MAP_HPP
+
+# include <memory>
+# include <cstddef>
+# include <iterator>
+# include <algorithm>
+# include <stdexcept>
+# include <functional>
+
+# include "../utils/pair.hpp"
+
+/*
+
+	SYNOPSIS : persistent_map is an ordered map whose versions are immutable AVL trees sharing their nodes.
+
+	An update never modifies a node : it copies the O(log n) nodes of the path from the root to the
+	modified leaf (plus the nodes touched by the rotations), and links the copies to the untouched
+	subtrees of the previous version. Nodes are reference counted (one reference per parent and per root),
+	so a version is reclaimed as soon as no map holds it anymore.
+
+	Taking a snapshot (copy constructor, operator= or snapshot()) only copies the root pointer and
+	increments its counter : O(1), whatever the size of the map.
+
+	Thread safety : updates of one persistent_map must come from one thread at a time. Any thread can take
+	a snapshot of it while it is updated (root publication and snapshot share a short spinlock), then read
+	the snapshot without any lock. Iterators stay valid as long as the version they come from is held
+	by a map, so iterate over a snapshot rather than over a map being updated.
+
+	Contains the following prototypes (public functions only) :
+
+	=>	persistent_map(), persistent_map(const persistent_map &), operator=, ~persistent_map()
+	=>	persistent_map	snapshot(void) const;
+	=>	bool			insert(const value_type &val);		// does nothing if the key exists
+	=>	bool			update(const value_type &val);		// insert, or replace the value of the key
+	=>	size_type		erase(const key_type &k);
+	=>	void			clear(void);
+	=>	find, count, lower_bound, upper_bound, at, begin, end, size, empty
+*/
+
+namespace ft
+{
+	template <
+		class Key,
+		class T,
+		class Compare = std::less<Key>,
+		class Alloc = std::allocator<ft::pair<const Key, T> >
+	>
+	class persistent_map
+	{
+		private:
+
+			/* immutable once published : only _refs changes */
+			struct _node
+			{
+				ft::pair<const Key, T>	_val;
+				_node					*_left;
+				_node					*_right;
+				int						_height;
+				volatile long			_refs;
+			};
+
+		/* ALIASES */
+		public:
+
+			typedef Key													key_type;
+			typedef T													mapped_type;
+			typedef ft::pair<const Key, T>								value_type;
+			typedef Compare												key_compare;
+			typedef Alloc												allocator_type;
+			typedef typename Alloc::template rebind<_node>::other		node_allocator_type;
+			typedef std::size_t											size_type;
+			typedef std::ptrdiff_t										difference_type;
+			typedef const value_type&									const_reference;
+			typedef const value_type*									const_pointer;
+
+			/* max height of the stack of an iterator. An AVL tree of height 64 holds more than 2^44 keys */
+			static const int	max_height = 64;
+
+		/* ITERATOR (read-only, in order) */
+
+			/* keeps the stack of the nodes whose value is not visited yet : the current node on top,
+			then the ancestors reached through a left link. end() is the empty stack */
+			class const_iterator
+			{
+				public:
+
+					typedef std::forward_iterator_tag		iterator_category;
+					typedef ft::pair<const Key, T>			value_type;
+					typedef std::ptrdiff_t					difference_type;
+					typedef const value_type*				pointer;
+					typedef const value_type&				reference;
+
+					const_iterator(void) : _depth(0) {};
+
+					const_iterator(const const_iterator &original) : _depth(original._depth)
+					{
+						for (int i = 0; i < this->_depth; i++)
+							this->_stack[i] = original._stack[i];
+					}
+
+					~const_iterator() {};
+
+					const_iterator&	operator=(const const_iterator &original)
+					{
+						if (this != &original)
+						{
+							this->_depth = original._depth;
+							for (int i = 0; i < this->_depth; i++)
+								this->_stack[i] = original._stack[i];
+						}
+						return *this;
+					}
+
+					reference	operator*(void) const { return (this->_stack[this->_depth - 1]->_val); };
+					pointer		operator->(void) const { return (&this->_stack[this->_depth - 1]->_val); };
+
+					const_iterator&	operator++(void)
+					{
+						_node	*current = this->_stack[--this->_depth];
+
+						this->_pushLeftSpine(current->_right);
+						return *this;
+					}
+
+					const_iterator	operator++(int)
+					{
+						const_iterator	tmp(*this);
+
+						++(*this);
+						return (tmp);
+					}
+
+					friend bool	operator==(const const_iterator &alpha, const const_iterator &bravo)
+					{
+						if (alpha._depth == 0 || bravo._depth == 0)
+							return (alpha._depth == bravo._depth);
+						return (alpha._stack[alpha._depth - 1] == bravo._stack[bravo._depth - 1]);
+					}
+
+					friend bool	operator!=(const const_iterator &alpha, const const_iterator &bravo)
+					{
+						return (!(alpha == bravo));
+					}
+
+				private:
+
+					friend class persistent_map;
+
+					_node	*_stack[max_height];
+					int		_depth;
+
+					void	_push(_node *x) { this->_stack[this->_depth++] = x; };
+
+					void	_pushLeftSpine(_node *x)
+					{
+						for (; x != nullptr; x = x->_left)
+							this->_push(x);
+					}
+			};
+
+			typedef const_iterator		iterator; // versions are immutable
+
+		/* CONSTRUCTORS, DESTRUCTOR, COPY, OVERLOADING ASSIGNMENT OPERATOR (COPLIEN FORM) */
+
+			explicit	persistent_map(const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _root(nullptr), _size(0), _root_lock(0),
+				_comparator(comp), _alloc(alloc), _node_alloc(alloc) {}
+
+			/* snapshot of original, O(1) */
+			persistent_map(const persistent_map &original) : _root(nullptr), _size(0), _root_lock(0),
+				_comparator(original._comparator), _alloc(original._alloc), _node_alloc(original._node_alloc)
+			{
+				original._lockRoot();
+				this->_root = _ref(original._root);
+				this->_size = original._size;
+				original._unlockRoot();
+			}
+
+			~persistent_map() { this->_unref(this->_root); }
+
+			/* makes this map hold the current version of original, O(1) */
+			persistent_map&	operator=(const persistent_map &original)
+			{
+				_node		*root;
+				size_type	size;
+
+				if (this == &original)
+					return *this;
+				original._lockRoot();
+				root = _ref(original._root);
+				size = original._size;
+				original._unlockRoot();
+				this->_publish(root, size);
+				return *this;
+			}
+
+			persistent_map	snapshot(void) const { return (persistent_map(*this)); };
+
+		/* ITERATORS */
+
+			const_iterator	begin(void) const
+			{
+				const_iterator	it;
+
+				it._pushLeftSpine(this->_root);
+				return (it);
+			}
+
+			const_iterator	end(void) const { return (const_iterator()); };
+
+		/* CAPACITY */
+
+			bool		empty(void) const { return (this->_size == 0); };
+			size_type	size(void) const { return (this->_size); };
+
+		/* MODIFIERS (each one publishes a new version) */
+
+			/* inserts val if its key is not in the map yet. Returns true if a version was published */
+			bool	insert(const value_type &val)
+			{
+				_node	*root = this->_insert(this->_root, val, false);
+
+				if (root == nullptr)
+					return (false);
+				this->_publish(root, this->_size + 1);
+				return (true);
+			}
+
+			/* inserts val, or replaces the value of its key. Returns true if the key was not in the map */
+			bool	update(const value_type &val)
+			{
+				bool	inserted = (this->count(val.first) == 0);
+				_node	*root = this->_insert(this->_root, val, true);
+
+				this->_publish(root, this->_size + inserted);
+				return (inserted);
+			}
+
+			size_type	erase(const key_type &k)
+			{
+				bool	erased = false;
+				_node	*root = this->_erase(this->_root, k, erased);
+
+				if (erased == false)
+					return (0);
+				this->_publish(root, this->_size - 1);
+				return (1);
+			}
+
+			void	clear(void) { this->_publish(nullptr, 0); };
+
+		/* OPERATIONS */
+
+			const_iterator	find(const key_type &k) const
+			{
+				const_iterator	it = this->lower_bound(k);
+
+				if (it != this->end() && this->_comparator(k, it->first))
+					return (this->end());
+				return (it);
+			}
+
+			size_type	count(const key_type &k) const
+			{
+				_node	*x = this->_root;
+
+				while (x != nullptr)
+				{
+					if (this->_comparator(k, x->_val.first))
+						x = x->_left;
+					else if (this->_comparator(x->_val.first, k))
+						x = x->_right;
+					else
+						return (1);
+				}
+				return (0);
+			}
+
+			/* the nodes where the descent goes left are the ones after k : they are the iterator stack */
+			const_iterator	lower_bound(const key_type &k) const
+			{
+				const_iterator	it;
+
+				for (_node *x = this->_root; x != nullptr;)
+				{
+					if (this->_comparator(x->_val.first, k))
+						x = x->_right;
+					else
+					{
+						it._push(x);
+						x = x->_left;
+					}
+				}
+				return (it);
+			}
+
+			const_iterator	upper_bound(const key_type &k) const
+			{
+				const_iterator	it;
+
+				for (_node *x = this->_root; x != nullptr;)
+				{
+					if (this->_comparator(k, x->_val.first))
+					{
+						it._push(x);
+						x = x->_left;
+					}
+					else
+						x = x->_right;
+				}
+				return (it);
+			}
+
+			/* returns the value of key if exists, otherwise throw out-of-range exception */
+			const mapped_type&	at(const key_type &k) const
+			{
+				const_iterator	it = this->find(k);
+
+				if (it == this->end())
+					throw std::out_of_range("persistent_map");
+				return (it->second);
+			}
+
+		/* OBSERVERS */
+
+			key_compare		key_comp(void) const { return (this->_comparator); };
+			allocator_type	get_allocator(void) const { return (this->_alloc); };
+
+		private:
+
+			_node						*_root;
+			size_type					_size;
+			mutable volatile int		_root_lock;
+			key_compare					_comparator;
+			allocator_type				_alloc;
+			node_allocator_type			_node_alloc;
+
+		private:
+
+			/* ROOT PUBLICATION */
+
+			void	_lockRoot(void) const
+			{
+				while (__sync_lock_test_and_set(&this->_root_lock, 1))
+					while (this->_root_lock)
+						;
+			}
+
+			void	_unlockRoot(void) const { __sync_lock_release(&this->_root_lock); };
+
+			/* replaces the current version by root (whose reference is given to the map),
+			then drops the reference to the previous version */
+			void	_publish(_node *root, size_type size)
+			{
+				_node	*old;
+
+				this->_lockRoot();
+				old = this->_root;
+				this->_root = root;
+				this->_size = size;
+				this->_unlockRoot();
+				this->_unref(old);
+			}
+
+			/* REFERENCE COUNTING */
+
+			static _node	*_ref(_node *x)
+			{
+				if (x != nullptr)
+					__sync_add_and_fetch(&x->_refs, 1);
+				return (x);
+			}
+
+			/* drops one reference to x, and frees it (then drops its references to its children)
+			when it was the last one */
+			void	_unref(_node *x)
+			{
+				while (x != nullptr && __sync_sub_and_fetch(&x->_refs, 1) == 0)
+				{
+					_node	*right = x->_right;
+
+					this->_unref(x->_left);
+					this->_alloc.destroy(&x->_val);
+					this->_node_alloc.deallocate(x, 1);
+					x = right;
+				}
+			}
+
+			/* NODE CREATION */
+
+			static int	_height(_node *x) { return ((x == nullptr) ? 0 : x->_height); };
+
+			/* creates a node with one reference. The references to left and right are given to the node */
+			_node	*_make(const value_type &val, _node *left, _node *right)
+			{
+				_node	*x = this->_node_alloc.allocate(1);
+
+				this->_alloc.construct(&x->_val, val);
+				x->_left = left;
+				x->_right = right;
+				x->_height = 1 + std::max(_height(left), _height(right));
+				x->_refs = 1;
+				return (x);
+			}
+
+			/* creates the node (val, left, right), with the rotations needed if the heights of left and right
+			differ by two. left and right are references given to this function */
+			_node	*_balance(const value_type &val, _node *left, _node *right)
+			{
+				_node	*res;
+
+				if (_height(left) > _height(right) + 1)
+				{
+					if (_height(left->_left) >= _height(left->_right)) // right rotation
+						res = this->_make(left->_val, _ref(left->_left), this->_make(val, _ref(left->_right), right));
+					else // left-right rotation
+					{
+						_node	*mid = left->_right;
+
+						res = this->_make(mid->_val, this->_make(left->_val, _ref(left->_left), _ref(mid->_left)),
+							this->_make(val, _ref(mid->_right), right));
+					}
+					this->_unref(left);
+				}
+				else if (_height(right) > _height(left) + 1)
+				{
+					if (_height(right->_right) >= _height(right->_left)) // left rotation
+						res = this->_make(right->_val, this->_make(val, left, _ref(right->_left)), _ref(right->_right));
+					else // right-left rotation
+					{
+						_node	*mid = right->_left;
+
+						res = this->_make(mid->_val, this->_make(val, left, _ref(mid->_left)),
+							this->_make(right->_val, _ref(mid->_right), _ref(right->_right)));
+					}
+					this->_unref(right);
+				}
+				else
+					res = this->_make(val, left, right);
+				return (res);
+			}
+
+			/* PATH COPYING */
+
+			/* returns the new version of the subtree x with val inserted (a new reference), or nullptr
+			if the key exists and replace is false (nothing is copied then) */
+			_node	*_insert(_node *x, const value_type &val, bool replace)
+			{
+				_node	*sub;
+
+				if (x == nullptr)
+					return (this->_make(val, nullptr, nullptr));
+				if (this->_comparator(val.first, x->_val.first))
+				{
+					if ((sub = this->_insert(x->_left, val, replace)) == nullptr)
+						return (nullptr);
+					return (this->_balance(x->_val, sub, _ref(x->_right)));
+				}
+				if (this->_comparator(x->_val.first, val.first))
+				{
+					if ((sub = this->_insert(x->_right, val, replace)) == nullptr)
+						return (nullptr);
+					return (this->_balance(x->_val, _ref(x->_left), sub));
+				}
+				if (replace == false)
+					return (nullptr);
+				return (this->_make(val, _ref(x->_left), _ref(x->_right)));
+			}
+
+			/* returns the new version of the subtree x without the key k (a new reference, nullptr if
+			it is empty). erased stays false if k is missing, and nothing is copied then */
+			_node	*_erase(_node *x, const key_type &k, bool &erased)
+			{
+				_node	*sub;
+
+				if (x == nullptr)
+					return (nullptr);
+				if (this->_comparator(k, x->_val.first))
+				{
+					sub = this->_erase(x->_left, k, erased);
+					return (erased ? this->_balance(x->_val, sub, _ref(x->_right)) : nullptr);
+				}
+				if (this->_comparator(x->_val.first, k))
+				{
+					sub = this->_erase(x->_right, k, erased);
+					return (erased ? this->_balance(x->_val, _ref(x->_left), sub) : nullptr);
+				}
+				erased = true;
+				if (x->_left == nullptr)
+					return (_ref(x->_right));
+				if (x->_right == nullptr)
+					return (_ref(x->_left));
+
+				_node	*successor = nullptr;
+				_node	*res;
+
+				sub = this->_eraseMin(x->_right, successor);
+				res = this->_balance(successor->_val, _ref(x->_left), sub);
+				this->_unref(successor);
+				return (res);
+			}
+
+			/* returns the new version of the subtree x without its minimum. min receives a reference to it */
+			_node	*_eraseMin(_node *x, _node *&min)
+			{
+				if (x->_left == nullptr)
+				{
+					min = _ref(x);
+					return (_ref(x->_right));
+				}
+				return (this->_balance(x->_val, this->_eraseMin(x->_left, min), _ref(x->_right)));
+			}
+	};
+}
+
+#endif
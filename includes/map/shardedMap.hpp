@@ -0,0 +1,377 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shardedMap.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:30:28 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 08:54:35 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SHARDEDMAP_HPP
+# define SHARDEDMAP_HPP
+
+# include <memory>
+# include <cstddef>
+# include <stdexcept>
+# include <functional>
+# include <pthread.h>
+
+# include "../utils/pair.hpp"
+# include "../utils/hash.hpp"
+# include "./map.hpp"
+
+/*
+
+	SYNOPSIS : sharded_map is a map shared by several threads.
+
+	The keys are partitioned by their hash between Shards independent maps. Each shard owns a
+	readers-writer lock : lookups on a shard run in parallel, a modification locks only its shard,
+	so threads working on different keys seldom wait for each other. Shards are aligned on cache
+	lines so that two locks never share one.
+
+	=>	insert, assign, erase, lookup, count are thread-safe. Values are copied out (lookup) instead
+		of returning an iterator, since an iterator would outlive the lock.
+	=>	size, empty and clear lock the shards one after the other : the result is exact only if
+		nobody writes meanwhile.
+	=>	ordered iteration inside one shard : a read_guard (or a write_guard) locks the shard and gives
+		access to its map for the guard's lifetime.
+	=>	global ordered iteration : a snapshot_guard read-locks every shard (always in the same order,
+		so guards never deadlock), then begin() / end() walk all keys in order, merging the shards
+		with a heap of their current iterators (O(log Shards) per step).
+
+	Keys of a type without ft::hash specialization need a Hash functor (any std::size_t (Key)).
+*/
+
+namespace ft
+{
+	template <
+		class Key,
+		class T,
+		std::size_t Shards = 16,
+		class Hash = ft::hash<Key>,
+		class Compare = std::less<Key>,
+		class Alloc = std::allocator<ft::pair<const Key, T> >
+	>
+	class sharded_map
+	{
+		/* ALIASES */
+		public:
+
+			typedef Key												key_type;
+			typedef T												mapped_type;
+			typedef ft::pair<const Key, T>							value_type;
+			typedef Hash											hasher;
+			typedef Compare											key_compare;
+			typedef Alloc											allocator_type;
+			typedef std::size_t										size_type;
+			typedef ft::map<Key, T, Compare, Alloc>					map_type;
+			typedef typename map_type::iterator						map_iterator;
+			typedef typename map_type::const_iterator				map_const_iterator;
+
+		private:
+
+			/* one map and its lock, alone on its cache lines */
+			struct	_shard
+			{
+				pthread_rwlock_t	lock;
+				map_type			map;
+			} __attribute__((aligned(64)));
+
+		public:
+
+		/* GUARDS : lock a shard (or all of them) from construction to destruction */
+
+			class	read_guard
+			{
+				public:
+
+					read_guard(sharded_map &owner, size_type shard) : _target(&owner._shards[shard])
+					{
+						pthread_rwlock_rdlock(&this->_target->lock);
+					}
+
+					~read_guard() { pthread_rwlock_unlock(&this->_target->lock); }
+
+					/* the map is only read through a read_guard : its const members write nothing */
+					const map_type&	operator*(void) const { return (this->_target->map); };
+					const map_type*	operator->(void) const { return (&this->_target->map); };
+
+				private:
+
+					read_guard(const read_guard &original);
+					read_guard&	operator=(const read_guard &original);
+
+					_shard	*_target;
+			};
+
+			class	write_guard
+			{
+				public:
+
+					write_guard(sharded_map &owner, size_type shard) : _target(&owner._shards[shard])
+					{
+						pthread_rwlock_wrlock(&this->_target->lock);
+					}
+
+					~write_guard() { pthread_rwlock_unlock(&this->_target->lock); }
+
+					map_type&	operator*(void) const { return (this->_target->map); };
+					map_type*	operator->(void) const { return (&this->_target->map); };
+
+				private:
+
+					write_guard(const write_guard &original);
+					write_guard&	operator=(const write_guard &original);
+
+					_shard	*_target;
+			};
+
+			/* iterates over the keys of all the shards in order. Only valid under a snapshot_guard */
+			class	merged_iterator
+			{
+				public:
+
+					typedef typename sharded_map::value_type&		reference;
+					typedef typename sharded_map::value_type*		pointer;
+
+					merged_iterator(void) : _heap_size(0) {}
+
+					reference	operator*(void) const { return (*this->_cur[this->_heap[0]]); };
+					pointer		operator->(void) const { return (&(*this->_cur[this->_heap[0]])); };
+
+					merged_iterator&	operator++(void)
+					{
+						size_type	top = this->_heap[0];
+
+						++this->_cur[top];
+						if (this->_cur[top] == this->_end[top])
+							this->_heap[0] = this->_heap[--this->_heap_size];
+						this->_siftDown(0);
+						return (*this);
+					}
+
+					merged_iterator	operator++(int)
+					{
+						merged_iterator	tmp(*this);
+
+						++(*this);
+						return (tmp);
+					}
+
+					friend bool	operator==(const merged_iterator &alpha, const merged_iterator &bravo)
+					{
+						if (alpha._heap_size == 0 || bravo._heap_size == 0)
+							return (alpha._heap_size == bravo._heap_size);
+						return (alpha._heap[0] == bravo._heap[0]
+							&& alpha._cur[alpha._heap[0]] == bravo._cur[bravo._heap[0]]);
+					}
+
+					friend bool	operator!=(const merged_iterator &alpha, const merged_iterator &bravo)
+					{
+						return (!(alpha == bravo));
+					}
+
+				private:
+
+					friend class	sharded_map;
+
+					/* one cursor per non-empty shard, the heap holds shard indexes by smallest current key */
+					explicit	merged_iterator(sharded_map &owner) : _heap_size(0), _comparator(owner._comparator)
+					{
+						for (size_type i = 0; i < Shards; i++)
+						{
+							map_type	&m = owner._shards[i].map;
+
+							if (m.empty())
+								continue ;
+							this->_cur[i] = m.begin();
+							this->_end[i] = m.end();
+							this->_heap[this->_heap_size++] = i;
+						}
+						for (size_type i = this->_heap_size / 2; i-- > 0; )
+							this->_siftDown(i);
+					}
+
+					bool	_less(size_type a, size_type b) const
+					{
+						return (this->_comparator(this->_cur[a]->first, this->_cur[b]->first));
+					}
+
+					void	_siftDown(size_type i)
+					{
+						while (true)
+						{
+							size_type	left = 2 * i + 1;
+							size_type	smallest = i;
+
+							if (left < this->_heap_size && this->_less(this->_heap[left], this->_heap[smallest]))
+								smallest = left;
+							if (left + 1 < this->_heap_size
+								&& this->_less(this->_heap[left + 1], this->_heap[smallest]))
+								smallest = left + 1;
+							if (smallest == i)
+								return ;
+							std::swap(this->_heap[i], this->_heap[smallest]);
+							i = smallest;
+						}
+					}
+
+					map_iterator	_cur[Shards];
+					map_iterator	_end[Shards];
+					size_type		_heap[Shards];
+					size_type		_heap_size;
+					key_compare		_comparator;
+			};
+
+			/* read-locks every shard, in index order */
+			class	snapshot_guard
+			{
+				public:
+
+					explicit	snapshot_guard(sharded_map &owner) : _owner(&owner)
+					{
+						for (size_type i = 0; i < Shards; i++)
+							pthread_rwlock_rdlock(&owner._shards[i].lock);
+					}
+
+					~snapshot_guard()
+					{
+						for (size_type i = Shards; i-- > 0; )
+							pthread_rwlock_unlock(&this->_owner->_shards[i].lock);
+					}
+
+					merged_iterator	begin(void) const { return (merged_iterator(*this->_owner)); };
+					merged_iterator	end(void) const { return (merged_iterator()); };
+
+				private:
+
+					snapshot_guard(const snapshot_guard &original);
+					snapshot_guard&	operator=(const snapshot_guard &original);
+
+					sharded_map		*_owner;
+			};
+
+		/* CONSTRUCTOR, DESTRUCTOR (the locks can not be copied : no copy, no assignment) */
+
+			explicit	sharded_map(const hasher &hash = hasher(), const key_compare &comp = key_compare()) :
+				_hasher(hash), _comparator(comp)
+			{
+				for (size_type i = 0; i < Shards; i++)
+				{
+					if (pthread_rwlock_init(&this->_shards[i].lock, nullptr) != 0)
+					{
+						while (i-- > 0)
+							pthread_rwlock_destroy(&this->_shards[i].lock);
+						throw std::runtime_error("sharded_map");
+					}
+				}
+			}
+
+			~sharded_map()
+			{
+				for (size_type i = 0; i < Shards; i++)
+					pthread_rwlock_destroy(&this->_shards[i].lock);
+			}
+
+		/* SHARDS */
+
+			size_type	shard_count(void) const { return (Shards); };
+
+			size_type	shard_of(const key_type &k) const
+			{
+				return (this->_hasher(k) % Shards);
+			}
+
+		/* CAPACITY (exact only without concurrent writers) */
+
+			size_type	size(void)
+			{
+				size_type	total = 0;
+
+				for (size_type i = 0; i < Shards; i++)
+				{
+					read_guard	guard(*this, i);
+
+					total += guard->size();
+				}
+				return (total);
+			}
+
+			bool	empty(void) { return (this->size() == 0); };
+
+		/* LOOKUP */
+
+			/* copies the value of k in out if k exists */
+			bool	lookup(const key_type &k, mapped_type &out)
+			{
+				read_guard			guard(*this, this->shard_of(k));
+				map_const_iterator	it = guard->find(k);
+
+				if (it == guard->end())
+					return (false);
+				out = it->second;
+				return (true);
+			}
+
+			size_type	count(const key_type &k)
+			{
+				read_guard	guard(*this, this->shard_of(k));
+
+				return (guard->count(k));
+			}
+
+		/* MODIFIERS */
+
+			/* inserts val if its key does not exist yet, returns true if inserted */
+			bool	insert(const value_type &val)
+			{
+				write_guard	guard(*this, this->shard_of(val.first));
+
+				return (guard->insert(val).second);
+			}
+
+			/* inserts val, or replaces the value of its key if it already exists */
+			void	assign(const value_type &val)
+			{
+				write_guard	guard(*this, this->shard_of(val.first));
+
+				(*guard)[val.first] = val.second;
+			}
+
+			size_type	erase(const key_type &k)
+			{
+				write_guard	guard(*this, this->shard_of(k));
+
+				return (guard->erase(k));
+			}
+
+			void	clear(void)
+			{
+				for (size_type i = 0; i < Shards; i++)
+				{
+					write_guard	guard(*this, i);
+
+					guard->clear();
+				}
+			}
+
+		/* OBSERVERS */
+
+			hasher		hash_function(void) const { return (this->_hasher); };
+			key_compare	key_comp(void) const { return (this->_comparator); };
+
+		private:
+
+			sharded_map(const sharded_map &original);
+			sharded_map&	operator=(const sharded_map &original);
+
+			_shard			_shards[Shards];
+			hasher			_hasher;
+			key_compare		_comparator;
+	};
+}
+
+#endif
@@ -0,0 +1,433 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AVLTree.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:37:48 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 06:38:38 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef AVL_TREE_HPP
+# define AVL_TREE_HPP
+
+#include <functional>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <iostream>
+#include <string>
+
+#include "../node.hpp"
+#include "../../utils/pair.hpp"
+#include "../../utils/containerStats.hpp"
+
+/*
+
+	SYNOPSIS : AVL tree engine, with the same nodes as binarySearchTree (ported from lab/AVLTree.hpp).
+
+	Every node keeps its balance factor (_bf = height of the right subtree - height of the left subtree)
+	between -1 and 1 : after an insertion or a deletion, the balance factors are updated from the
+	modified leaf up to the root, and a node reaching -2 or 2 is fixed by one or two rotations.
+	The height of the tree stays below 1.44 log2(n).
+
+	Deletion relinks the nodes (the successor takes the place of the deleted node) instead of copying
+	keys, so no node is allocated during a deletion. Inserting an existing key does nothing.
+
+	Contains the following prototypes (public functions only) :
+
+	=>	AVLTree(), ~AVLTree(), AVLTree(const AVLTree &original), operator=	// copies are deep
+	=>	size_type	getSize(void);
+	=>	node*		getRoot(void);
+	=>	node*		getMin(void);
+	=>	node*		getMax(void);
+	=>	size_type	getRotations(void);		// rotations made since the construction
+	=>	tree_stats	stats(void) const;		// see containerStats.hpp
+	=>	bool		treeInsertion(const value_type &val);
+	=>	bool		IsKeyAlreadyExisting(const Key &key);
+	=>	void		deleteNode(const Key &key);
+	=>	void		postOrderTraversalDeletion(node *elem);
+	=>	void		printTree(void);
+*/
+
+namespace ft
+{
+	template < 
+		class Key,
+		class T,
+		class Alloc = std::allocator<ft::pair<const Key, T> > 
+	> 
+	class AVLTree
+	{
+		public:
+		
+			/* ALIASES */
+			typedef Key									key_type;
+			typedef T									mapped_type;
+			typedef ft::pair<const Key, T>				value_type;
+			typedef std::size_t							size_type;
+			typedef Alloc								allocator_type;
+			typedef Node<Key, T>						node;
+			typedef typename Alloc::template rebind<node>::other	node_allocator_type;
+
+			/* CONSTRUCTORS AND DESTRUCTORS */
+			explicit	AVLTree(const allocator_type &alloc = allocator_type()) : _root(nullptr), _size(0),
+			_rotations(0), _pair_alloc(alloc), _node_alloc(alloc) {}
+
+			~AVLTree()
+			{
+				this->postOrderTraversalDeletion(this->_root);
+			}
+
+			AVLTree(const AVLTree &original) : _root(nullptr), _size(original._size), _rotations(0),
+			_pair_alloc(original._pair_alloc), _node_alloc(original._node_alloc)
+			{
+				this->_root = this->_cloneSubtree(original._root, nullptr);
+			}
+
+			AVLTree&	operator=(const AVLTree &original)
+			{
+				if (this != &original)
+				{
+					this->postOrderTraversalDeletion(this->_root);
+					this->_root = this->_cloneSubtree(original._root, nullptr);
+					this->_size = original._size;
+				}
+				return *this;
+			}
+
+			/* GETTERS */
+
+			size_type	getSize(void)		{ return (this->_size); };
+			node*		getRoot(void)		{ return (this->_root); };
+			node*		getMin(void)		{ return (node::getTreeMin(this->_root)); };
+			node*		getMax(void)		{ return (node::getTreeMax(this->_root)); };
+			size_type	getRotations(void)	{ return (this->_rotations); };
+
+			/* counters of the descents, rotations, rebalancing steps and node allocations (zeros unless
+			built with FT_CONTAINERS_STATS) */
+			tree_stats	stats(void) const
+			{
+# ifdef FT_CONTAINERS_STATS
+				return (this->_stats);
+# else
+				return (tree_stats());
+# endif
+			}
+
+			/* PUBLIC METHODS */
+
+			/* standard BST insertion, then update of the balance factors up to the first node whose
+			height does not change, rotating the first unbalanced one. Returns false if key exists */
+			bool	treeInsertion(const value_type &val)
+			{
+				node		*parent = nullptr;
+				node		*x = this->_root;
+				node		*newNode;
+
+				FT_STATS(this->_stats.searches++;)
+				while (x != nullptr)
+				{
+					FT_STATS(this->_stats.nodes_visited++;)
+					parent = x;
+					if (val.first < x->_val.first)
+						x = x->_left;
+					else if (x->_val.first < val.first)
+						x = x->_right;
+					else
+						return (false);
+				}
+				newNode = this->_createNewNode(val);
+				newNode->_parent = parent;
+				if (parent == nullptr)
+					this->_root = newNode;
+				else if (val.first < parent->_val.first)
+					parent->_left = newNode;
+				else
+					parent->_right = newNode;
+				this->_size++;
+				this->_retraceInsertion(newNode);
+				return (true);
+			}
+
+			/* check whether a key exists or not */
+			bool	IsKeyAlreadyExisting(const Key &key)
+			{
+				return (this->_search(key) != nullptr);
+			}
+
+			/* deletes a node by identifying it by its key (does nothing if the key does not exist) */
+			void	deleteNode(const Key &key)
+			{
+				node		*z;
+				node		*parent;
+				bool		fromLeft;
+
+				z = this->_search(key);
+				if (z == nullptr)
+					return ;
+				if (z->_left != nullptr && z->_right != nullptr) // the successor takes the place of z
+				{
+					node	*y = node::getTreeMin(z->_right);
+
+					if (y->_parent == z)
+					{
+						parent = y;
+						fromLeft = false;
+					}
+					else
+					{
+						parent = y->_parent;
+						fromLeft = true;
+						this->_transplant(y, y->_right);
+						y->_right = z->_right;
+						y->_right->_parent = y;
+					}
+					this->_transplant(z, y);
+					y->_left = z->_left;
+					y->_left->_parent = y;
+					y->_bf = z->_bf;
+				}
+				else
+				{
+					parent = z->_parent;
+					fromLeft = (parent != nullptr && parent->_left == z);
+					this->_transplant(z, (z->_left != nullptr ? z->_left : z->_right));
+				}
+				this->_deleteNode(z);
+				this->_size--;
+				this->_retraceDeletion(parent, fromLeft);
+			}
+
+			/* to cover the full tree, elem must be equal to this->_root */
+			void	postOrderTraversalDeletion(node *elem)
+			{
+				if (elem != nullptr)
+				{
+					this->postOrderTraversalDeletion(elem->_left);
+					this->postOrderTraversalDeletion(elem->_right);
+					this->_deleteNode(elem);
+				}
+				if (elem == this->_root)
+				{
+					this->_root = nullptr;
+					this->_size = 0;
+				}
+			}
+
+			/* print the tree in 2D : the root value appears in the center of the vertical axis,
+			in the left side of the terminal. Debug and visual function */
+			void	printTree(void)
+			{
+				if (this->_root == nullptr)
+					return ;
+				this->_printTree(this->_root, 0);
+			}
+
+		private:
+
+			node					*_root;
+			size_type				_size;
+			size_type				_rotations;
+			allocator_type			_pair_alloc;
+			node_allocator_type		_node_alloc; // Alloc rebound to nodes
+			FT_STATS(tree_stats		_stats;)
+
+		private:
+
+			/* HELPERS */
+
+			/* allocate memory for a node creation, then create it */
+			node	*_createNewNode(const value_type &val)
+			{
+				node		*newNode = this->_node_alloc.allocate(1);
+
+				FT_STATS(this->_stats.allocations++;)
+				new (newNode) node(val);
+				newNode->_color = node::RED;
+				return (newNode);
+			}
+
+			/* delete a node and free its memory */
+			void	_deleteNode(node *target)
+			{
+				target->~node();
+				this->_node_alloc.deallocate(target, 1);
+			}
+
+			/* deep copy of the subtree of src, balance factors included */
+			node	*_cloneSubtree(node *src, node *parent)
+			{
+				node	*cpy;
+
+				if (src == nullptr)
+					return (nullptr);
+				cpy = this->_createNewNode(src->_val);
+				cpy->_bf = src->_bf;
+				cpy->_parent = parent;
+				cpy->_left = this->_cloneSubtree(src->_left, cpy);
+				cpy->_right = this->_cloneSubtree(src->_right, cpy);
+				return (cpy);
+			}
+
+			/* iterative lookup of key, nullptr if it is missing */
+			node	*_search(const Key &key)
+			{
+				node	*x = this->_root;
+
+				FT_STATS(this->_stats.searches++;)
+				while (x != nullptr)
+				{
+					FT_STATS(this->_stats.nodes_visited++;)
+					if (key < x->_val.first)
+						x = x->_left;
+					else if (x->_val.first < key)
+						x = x->_right;
+					else
+						return (x);
+				}
+				return (nullptr);
+			}
+
+			/* replace the subtree of u by the subtree of v (v can be nullptr) */
+			void	_transplant(node *u, node *v)
+			{
+				if (u->_parent == nullptr)
+					this->_root = v;
+				else if (u == u->_parent->_left)
+					u->_parent->_left = v;
+				else
+					u->_parent->_right = v;
+				if (v != nullptr)
+					v->_parent = u->_parent;
+			}
+
+			/*  space should be equal to 0, target to this->_root */
+			void	_printTree(node *target, int space)
+			{
+				const int	indent = 5;
+				
+				if (target ==  nullptr)
+					return ;
+				space += indent;
+				this->_printTree(target->_right, space);
+				std::cout << std::endl;
+				for (int i = indent; i < space; i++)
+        			std::cout << " ";
+				std::cout << "[" << target->_val.first << "|" << target->_bf << "]" << std::endl;
+				this->_printTree(target->_left, space);
+			}
+
+			/* HELPERS SPECIFIC TO AVL TREES */
+
+			/* left rotation on a (b = right child of a becomes the root of the subtree).
+			=> newBal(a) = oldBal(a) - 1 - max(0, oldBal(b))
+			=> newBal(b) = oldBal(b) - 1 + min(0, newBal(a)) */
+			void	_AVL_left_rotation(node *a)
+			{
+				node		*b = a->_right;
+
+				a->_right = b->_left;
+				if (b->_left != nullptr)
+					b->_left->_parent = a;
+				this->_transplant(a, b);
+				b->_left = a;
+				a->_parent = b;
+				a->_bf = a->_bf - 1 - std::max(0, b->_bf);
+				b->_bf = b->_bf - 1 + std::min(0, a->_bf);
+				this->_rotations++;
+				FT_STATS(this->_stats.rotations++;)
+			}
+
+			/* right rotation on a (b = left child of a becomes the root of the subtree).
+			=> newBal(a) = oldBal(a) + 1 - min(0, oldBal(b))
+			=> newBal(b) = oldBal(b) + 1 + max(0, newBal(a)) */
+			void	_AVL_right_rotation(node *a)
+			{
+				node		*b = a->_left;
+
+				a->_left = b->_right;
+				if (b->_right != nullptr)
+					b->_right->_parent = a;
+				this->_transplant(a, b);
+				b->_right = a;
+				a->_parent = b;
+				a->_bf = a->_bf + 1 - std::min(0, b->_bf);
+				b->_bf = b->_bf + 1 + std::max(0, a->_bf);
+				this->_rotations++;
+				FT_STATS(this->_stats.rotations++;)
+			}
+
+			/* fixes a node whose balance factor is -2 or 2, returns the new root of its subtree */
+			node	*_rebalanceTree(node *start)
+			{
+				if (start->_bf > 0)
+				{
+					if (start->_right->_bf < 0)
+						this->_AVL_right_rotation(start->_right);
+					this->_AVL_left_rotation(start);
+				}
+				else
+				{
+					if (start->_left->_bf > 0)
+						this->_AVL_left_rotation(start->_left);
+					this->_AVL_right_rotation(start);
+				}
+				return (start->_parent);
+			}
+
+			/* the subtree of x grew by one : update its ancestors. One rebalancing is enough, since
+			it gives back its height to the subtree */
+			void	_retraceInsertion(node *x)
+			{
+				node	*parent = x->_parent;
+
+				while (parent != nullptr)
+				{
+					FT_STATS(this->_stats.rebalances++;)
+					if (x == parent->_left)
+						parent->_bf--;
+					else
+						parent->_bf++;
+					if (parent->_bf == 0)
+						return ;
+					if (parent->_bf == 2 || parent->_bf == -2)
+					{
+						this->_rebalanceTree(parent);
+						return ;
+					}
+					x = parent;
+					parent = x->_parent;
+				}
+			}
+
+			/* the subtree on the fromLeft side of parent lost one level : update the ancestors until
+			a subtree keeps its height. A rebalancing may lower the height, so it does not stop there */
+			void	_retraceDeletion(node *parent, bool fromLeft)
+			{
+				while (parent != nullptr)
+				{
+					FT_STATS(this->_stats.rebalances++;)
+					parent->_bf += (fromLeft ? 1 : -1);
+					if (parent->_bf == 1 || parent->_bf == -1)
+						return ;
+					if (parent->_bf == 2 || parent->_bf == -2)
+					{
+						node	*sibling = (parent->_bf > 0 ? parent->_right : parent->_left);
+						int		siblingBf = sibling->_bf;
+
+						parent = this->_rebalanceTree(parent);
+						if (siblingBf == 0) // single rotation, the height did not change
+							return ;
+					}
+					if (parent->_parent != nullptr)
+						fromLeft = (parent->_parent->_left == parent);
+					parent = parent->_parent;
+				}
+			}
+	};
+}
+
+#endif
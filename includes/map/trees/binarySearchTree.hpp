@@ -6,7 +6,7 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/14 10:49:22 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/16 15:22:19 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:54:35 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,18 +15,21 @@
 
 #include <functional>
 #include <memory>
+#include <new>
 #include <iostream>
 #include <string>
 
 #include "../node.hpp"
 #include "../../utils/pair.hpp"
+#include "../../utils/containerStats.hpp"
 
 namespace ft
 {
 	template < 
 		class Key,
 		class T,
-		class Alloc = std::allocator<ft::pair<const Key, T> > 
+		class Alloc = std::allocator<ft::pair<const Key, T> >,
+		class Compare = std::less<Key>
 	> 
 	class binarySearchTree
 	{			
@@ -38,71 +41,163 @@ namespace ft
 			typedef ft::pair<const Key, T>				value_type;
 			typedef std::size_t							size_type;
 			typedef Alloc								allocator_type;
-			typedef Node<Key, T, allocator_type>		node;
+			typedef Compare								key_compare;
+			typedef Node<Key, T>						node;
+			typedef typename Alloc::template rebind<node>::other	node_allocator_type;
 
 			/* CONSTRUCTORS AND DESTRUCTORS */
-			binarySearchTree() : _root(nullptr), _size(0), _pair_alloc(Alloc()) 
+			explicit	binarySearchTree(const allocator_type &alloc = allocator_type(),
+				const key_compare &comp = key_compare()) : _root(nullptr), _size(0), _pair_alloc(alloc),
+				_node_alloc(alloc), _comp(comp), _slab(nullptr), _slab_size(0), _slab_used(0) {}
+
+			~binarySearchTree()
 			{
-				this->_node_alloc = std::allocator<node>();
+				this->postOrderTraversalDeletion(this->_root);
+				this->_releaseSlab();
 			}
 
-			~binarySearchTree() { this->postOrderTraversalDeletion(this->_root); };
-
-			binarySearchTree(const binarySearchTree &original) : _root(original._root), _size(original._size),
-			_pair_alloc(original._pair_alloc), _node_alloc(original._node_alloc) {};
+			/* deep copy : clones the nodes of original with the same shape, colors and balance factors */
+			binarySearchTree(const binarySearchTree &original) : _root(nullptr), _size(0),
+			_pair_alloc(original._pair_alloc), _node_alloc(original._node_alloc), _comp(original._comp),
+			_slab(nullptr), _slab_size(0), _slab_used(0)
+			{
+				this->_root = this->_cloneTree(original._root, original._size);
+			}
 
 			binarySearchTree&	operator=(const binarySearchTree &original)
 			{
 				if (this != &original)
 				{
-					this->_root = original._root;
-					this->_size = original._size;
+					this->postOrderTraversalDeletion(this->_root);
+					this->_releaseSlab();
 					this->_pair_alloc = original._pair_alloc;
 					this->_node_alloc = original._node_alloc;
+					this->_comp = original._comp;
+					this->_root = this->_cloneTree(original._root, original._size);
 				}
 				return *this;
 			}
 
 			/* GETTERS */
 			
-			size_type	getSize(void)	{ return (this->_size); };
-			node*		getRoot(void)	{ return (this->_root); };
-			node*		getMin(void)	{ return (this->_root->getTreeMin(this->_root)); };
-			node*		getMax(void)	{ return (this->_root->getTreeMax(this->_root)); };
-			
-			mapped_type&	getValOfKey(const Key &key)
+			size_type		getSize(void) const	{ return (this->_size); };
+			node*			getRoot(void) const	{ return (this->_root); };
+			node*			getMin(void) const	{ return (node::getTreeMin(this->_root)); };
+			node*			getMax(void) const	{ return (node::getTreeMax(this->_root)); };
+			key_compare		key_comp(void) const { return (this->_comp); };
+
+			/* address of the root pointer : lets an end() iterator find the greatest node */
+			node *const		*getRootAddress(void) const { return (&this->_root); };
+
+			/* value of key, nullptr if the key is missing */
+			mapped_type		*getValOfKey(const Key &key)
+			{
+				node	*target = this->_search(key);
+
+				return (target == nullptr ? nullptr : &target->_val.second);
+			}
+
+			/* node of key, nullptr if the key is missing */
+			node			*getNode(const Key &key) { return (this->_search(key)); };
+
+			/* same as getNode, but the descent is not counted : it writes nothing, so threads sharing the
+			tree under a readers lock (the const lookups of ft::map in sharded_map) do not race */
+			node			*lookupNode(const Key &key) const
+			{
+				node	*x = this->_root;
+
+				while (x != nullptr)
+				{
+					if (this->_comp(key, x->_val.first))
+						x = x->_left;
+					else if (this->_comp(x->_val.first, key))
+						x = x->_right;
+					else
+						return (x);
+				}
+				return (nullptr);
+			}
+
+			/* first node whose key is not less than key (upper == false) or greater than key (upper == true),
+			nullptr if there is none */
+			node			*getBound(const Key &key, bool upper) const
+			{
+				node	*x = this->_root;
+				node	*res = nullptr;
+
+				while (x != nullptr)
+				{
+					if (upper ? this->_comp(key, x->_val.first) : !this->_comp(x->_val.first, key))
+					{
+						res = x;
+						x = x->_left;
+					}
+					else
+						x = x->_right;
+				}
+				return (res);
+			}
+
+			/* counters of the descents and node allocations (zeros unless built with FT_CONTAINERS_STATS) */
+			tree_stats	stats(void) const
 			{
-				return (this->_root->getTreeSearch(this->_root, key));
+# ifdef FT_CONTAINERS_STATS
+				return (this->_stats);
+# else
+				return (tree_stats());
+# endif
 			}
 		
 			/* PUBLIC METHODS */
 
-			/* create a node and insert it using a standard BST methodology */
-			void	binarySearchTreeInsertion(const value_type &val) // to test
+			/* create a node and insert it using a standard BST methodology, returns the new node.
+			The key is not checked : equal keys go to the right */
+			node	*binarySearchTreeInsertion(const value_type &val)
 			{
 				node		*newNode = this->_createNewNode(val);
 				
 				this->_treeInsert(newNode);
+				return (newNode);
 			}
 
 			/* check wether a key exists or not */
 			bool	IsKeyAlreadyExisting(const Key &key)
 			{
-				node 	*target = this->_root->getTreeSearch(this->_root, key);
-				
-				if (target == nullptr)
-					return (false);
-				return (true);
+				return (this->_search(key) != nullptr);
 			}
 
-			/* deletes a node by identifying it by its key */
-			void	deleteNode(const Key &key) // to test
+			/* deletes a node by identifying it by its key (does nothing if the key does not exist).
+			The other nodes are relinked, not copied : iterators to them stay valid */
+			void	deleteNode(const Key &key)
 			{
-				this->_treeDelete(this->_root, key);
+				node	*z = this->_search(key);
+
+				if (z == nullptr)
+					return ;
+				if (z->_left == nullptr)
+					this->_transplant(z, z->_right);
+				else if (z->_right == nullptr)
+					this->_transplant(z, z->_left);
+				else // the successor takes the place of z
+				{
+					node	*y = node::getTreeMin(z->_right);
+
+					if (y->_parent != z)
+					{
+						this->_transplant(y, y->_right);
+						y->_right = z->_right;
+						y->_right->_parent = y;
+					}
+					this->_transplant(z, y);
+					y->_left = z->_left;
+					y->_left->_parent = y;
+				}
+				this->_deleteNode(z);
+				this->_size--;
 			}
 
-			/* to cover the full tree, elem must be equal to this->_root */
-			void	postOrderTraversalDeletion(node *elem) // to test
+			/* to cover the full tree, elem must be equal to this->_root : the tree is then empty */
+			void	postOrderTraversalDeletion(node *elem)
 			{
 				if (elem != nullptr)
 				{
@@ -110,6 +205,12 @@ namespace ft
 					this->postOrderTraversalDeletion(elem->_right);
 					this->_deleteNode(elem);
 				}
+				if (elem == this->_root)
+				{
+					this->_root = nullptr;
+					this->_size = 0;
+					this->_releaseSlab();
+				}
 			}
 
 			/* print the tree in 2D : the root value appears in the center of the vertical axis,
@@ -126,7 +227,14 @@ namespace ft
 			node					*_root;
 			size_type				_size;
 			allocator_type			_pair_alloc;
-			std::allocator<node>	_node_alloc;
+			node_allocator_type		_node_alloc; // Alloc rebound to nodes
+			key_compare				_comp;
+			/* single block holding the nodes created by a copy. They are not deallocated one by one :
+			the whole block is, with the tree or before the next copy */
+			node					*_slab;
+			size_type				_slab_size;
+			size_type				_slab_used;
+			FT_STATS(tree_stats		_stats;)
 
 		private:
 
@@ -137,21 +245,112 @@ namespace ft
 			{
 				node		*newNode = this->_node_alloc.allocate(1); // alloc space for a node
 
-				this->_pair_alloc.construct(&newNode->_val, val);
-				newNode->_parent = nullptr;
-				newNode->_right = nullptr;
-				newNode->_left = nullptr;
+				FT_STATS(this->_stats.allocations++;)
+				new (newNode) node(val); // then build it in place (no links)
+				newNode->_color = node::RED;
 				return (newNode);
 			}
 
-			/* delete a node and free its memory */
+			/* delete a node and free its memory (unless it belongs to the slab of a copy) */
 			void	_deleteNode(node *target) // to test
 			{
-				
-				this->_node_alloc.deallocate(target, 1);
+				target->~node();
+				if (this->_isInSlab(target) == false)
+					this->_node_alloc.deallocate(target, 1);
 				target = nullptr;
 			}
 
+			/* COPY HELPERS */
+
+			bool	_isInSlab(node *target) const
+			{
+				std::less<node *>	before;
+
+				return (this->_slab != nullptr && !before(target, this->_slab)
+					&& before(target, this->_slab + this->_slab_size));
+			}
+
+			void	_releaseSlab(void)
+			{
+				if (this->_slab != nullptr)
+					this->_node_alloc.deallocate(this->_slab, this->_slab_size);
+				this->_slab = nullptr;
+				this->_slab_size = 0;
+				this->_slab_used = 0;
+			}
+
+			/* creates a copy of src (value, color and balance factor) without any link. Takes it from the slab,
+			or allocates it alone if the slab is full (in case count was lower than the real number of nodes) */
+			node	*_cloneNode(node *src)
+			{
+				node	*cpy;
+
+				if (this->_slab_used < this->_slab_size)
+					cpy = this->_slab + this->_slab_used++;
+				else
+				{
+					cpy = this->_node_alloc.allocate(1);
+					FT_STATS(this->_stats.allocations++;)
+				}
+				new (cpy) node(src->_val);
+				cpy->_bf = src->_bf;
+				cpy->_color = src->_color;
+				return (cpy);
+			}
+
+			/* clones the subtree of root (count nodes expected) in one preorder traversal, without recursion
+			nor stack : src and dst walk down together, and walk back up through their parent links.
+			A child of src is cloned when dst has no child on that side yet. Nodes are laid out in the slab
+			in preorder, so a parent is followed in memory by its left subtree. The size of the tree is the
+			number of nodes cloned. Returns the root of the copy */
+			node	*_cloneTree(node *root, size_type count)
+			{
+				node	*src = root;
+				node	*dst;
+				node	*res;
+				size_type	cloned = 1;
+
+				if (root == nullptr)
+					return (nullptr);
+				if (count > 0)
+				{
+					this->_slab = this->_node_alloc.allocate(count);
+					FT_STATS(this->_stats.allocations++;)
+					this->_slab_size = count;
+				}
+				this->_slab_used = 0;
+				res = this->_cloneNode(root);
+				dst = res;
+				while (true)
+				{
+					if (src->_left != nullptr && dst->_left == nullptr)
+					{
+						dst->_left = this->_cloneNode(src->_left);
+						cloned++;
+						dst->_left->_parent = dst;
+						src = src->_left;
+						dst = dst->_left;
+					}
+					else if (src->_right != nullptr && dst->_right == nullptr)
+					{
+						dst->_right = this->_cloneNode(src->_right);
+						cloned++;
+						dst->_right->_parent = dst;
+						src = src->_right;
+						dst = dst->_right;
+					}
+					else if (src == root)
+						break ;
+					else
+					{
+						src = src->_parent;
+						dst = dst->_parent;
+					}
+				}
+				this->_size = cloned;
+				return (res);
+			}
+
 			/*  space should be equal to 0, target to this->_root */
 			void	_printTree(node *target, int space) // functionnal
 			{
@@ -168,53 +367,38 @@ namespace ft
 				this->_printTree(target->_left, space);
 			}
 
-			/* create a copy of a node, but with another key,
-			then replace links from other links from target to newNode */
-			node	*_replace_key(node *target, value_type newPair) // to test
+			/* STANDARD BST FUNCTIONS */
+
+			/* iterative lookup of key, nullptr if it is missing (or if the tree is empty) */
+			node	*_search(const Key &key)
 			{
-				node	*newNode = this->_createNewNode(newPair);
+				node	*x = this->_root;
 
-				newNode->_color = target->_color;
-				newNode->_parent = target->_parent;
-				newNode->_left = target->_left;
-				newNode->_right = target->_right;
-				if (target->_parent != nullptr)
+				FT_STATS(this->_stats.searches++;)
+				while (x != nullptr)
 				{
-					if (target->_parent->_right
-						&& target->_parent->_right->_val.first == target->_val.first)
-						target->_parent->_right = newNode;
+					FT_STATS(this->_stats.nodes_visited++;)
+					if (this->_comp(key, x->_val.first))
+						x = x->_left;
+					else if (this->_comp(x->_val.first, key))
+						x = x->_right;
 					else
-						target->_parent->_left = newNode;
+						return (x);
 				}
-				if (target->_right != nullptr)
-					target->_right->_parent = newNode;
-				if (target->_left != nullptr)
-					target->_left->_parent = newNode;
-				return (newNode);
+				return (nullptr);
 			}
 
-			/* returns a copy of a dinamically allocated node (not shallow copy) */
-			node	*_copyNode(node *target)
-			{
-				node	*cpy = this->_createNewNode(target->_val);
-				
-				cpy->_color = target->_color;
-				cpy->_parent = target->_parent;
-				cpy->_left = target->_left;
-				cpy->_right = target->_right;
-				return (cpy);
-			}
-			
-			/* STANDARD BST FUNCTIONS */
 			void	_treeInsert(node *z) // functionnal
 			{
 				node		*y = nullptr;
 				node		*x = this->_root;
 
+				FT_STATS(this->_stats.searches++;)
 				while (x != nullptr)
 				{
+					FT_STATS(this->_stats.nodes_visited++;)
 					y = x;
-					if (z->_val.first < x->_val.first)
+					if (this->_comp(z->_val.first, x->_val.first))
 						x = x->_left;
 					else
 						x = x->_right;
@@ -222,7 +406,7 @@ namespace ft
 				z->_parent = y;
 				if (y == nullptr)
 					this->_root = z;
-				else if (z->_val.first < y->_val.first)
+				else if (this->_comp(z->_val.first, y->_val.first))
 					y->_left = z;
 				else
 					y->_right = z;
@@ -230,51 +414,17 @@ namespace ft
 				this->_size++;
 			}
 
-			/* should be used with start == this->_root */
-			node	*_treeDelete(node *start, const Key key) // to test
+			/* replace the subtree of u by the subtree of v (v can be nullptr) */
+			void	_transplant(node *u, node *v)
 			{
-				if (start == nullptr) // case target is NULL
-					return (nullptr);
-				else if (key < start->_val.first) // case key inferior to start node
-					start->_left = this->_treeDelete(start->_left, key);
-				else if (key > start->_val.first) // case key superior to start node
-					start->_right = this->_treeDelete(start->_right, key);
-				else // we reach node target, now we have to make relevant ops
-				{
-					if (start->_left == nullptr && start->_right == nullptr) // case target got no child
-					{
-						this->_deleteNode(start);
-						start = nullptr;
-					}
-					else if (start->_left == nullptr) // case target got only right child
-					{
-						node	*tmp = start;
-						
-						start = start->_right;
-						this->_deleteNode(tmp);
-						tmp = nullptr;
-					}
-					else if (start->_right == nullptr) // case target got only left child
-					{
-						node	*tmp = start;
-						
-						start = start->_left;
-						this->_deleteNode(tmp);
-						tmp = nullptr;
-					}
-					else // case taget has two children node left and right
-					{
-						node	*tmp = this->_root->getTreeMin(start->_right);
-						node	*newNode = this->_replace_key(start, tmp->_val);
-						
-						this->_deleteNode(start);
-						start = newNode;
-						start->_right = _treeDelete(start->_right, tmp->_val.first);
-					}
-				}
-				// withdraw one to size of the binary search tree
-				this->_size--;
-				return (start);
+				if (u->_parent == nullptr)
+					this->_root = v;
+				else if (u == u->_parent->_left)
+					u->_parent->_left = v;
+				else
+					u->_parent->_right = v;
+				if (v != nullptr)
+					v->_parent = u->_parent;
 			}
 	};
 }
@@ -0,0 +1,492 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redBlackTree.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:38:16 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 06:38:38 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RED_BLACK_TREE_HPP
+# define RED_BLACK_TREE_HPP
+
+#include <functional>
+#include <memory>
+#include <new>
+#include <iostream>
+#include <string>
+
+#include "../node.hpp"
+#include "../../utils/pair.hpp"
+#include "../../utils/containerStats.hpp"
+
+/*
+
+	SYNOPSIS : red-black tree engine, with the same nodes as binarySearchTree (replaces the draft
+	bin/redBlackTree.hpp). Leaves are nullptr, and count as black nodes.
+
+	Basic rule of red-black tree :
+
+	1) Every node in T is either red or black.
+	2) The root node of T is black.
+	3) Every NULL node is black.
+	4) If a node is red, both of its children are black.
+	5) Every path from a root node to a NULL node has the same number of black nodes.
+
+	Insertion and deletion restore them with recolorings and at most 2 (insertion) or 3 (deletion)
+	rotations. The height of the tree stays below 2 log2(n + 1). Inserting an existing key does nothing.
+
+	Contains the following prototypes (public functions only) :
+
+	=>	redBlackTree(), ~redBlackTree(), redBlackTree(const redBlackTree &original), operator=	// deep copies
+	=>	size_type	getSize(void);
+	=>	node*		getRoot(void);
+	=>	node*		getMin(void);
+	=>	node*		getMax(void);
+	=>	size_type	getRotations(void);		// rotations made since the construction
+	=>	tree_stats	stats(void) const;		// see containerStats.hpp
+	=>	bool		treeInsertion(const value_type &val);
+	=>	bool		IsKeyAlreadyExisting(const Key &key);
+	=>	void		deleteNode(const Key &key);
+	=>	void		postOrderTraversalDeletion(node *elem);
+	=>	void		printTree(void);
+*/
+
+namespace ft
+{
+	template < 
+		class Key,
+		class T,
+		class Alloc = std::allocator<ft::pair<const Key, T> > 
+	> 
+	class redBlackTree
+	{			
+		public:
+
+			/* ALIASES */
+			typedef Key									key_type;
+			typedef T									mapped_type;
+			typedef ft::pair<const Key, T>				value_type;
+			typedef std::size_t							size_type;
+			typedef Alloc								allocator_type;
+			typedef Node<Key, T>						node;
+			typedef typename Alloc::template rebind<node>::other	node_allocator_type;
+
+			/* CONSTRUCTORS AND DESTRUCTORS */
+			explicit	redBlackTree(const allocator_type &alloc = allocator_type()) : _root(nullptr), _size(0),
+			_rotations(0), _pair_alloc(alloc), _node_alloc(alloc) {}
+
+			~redBlackTree()
+			{
+				this->postOrderTraversalDeletion(this->_root);
+			}
+
+			redBlackTree(const redBlackTree &original) : _root(nullptr), _size(original._size), _rotations(0),
+			_pair_alloc(original._pair_alloc), _node_alloc(original._node_alloc)
+			{
+				this->_root = this->_cloneSubtree(original._root, nullptr);
+			}
+
+			redBlackTree&	operator=(const redBlackTree &original)
+			{
+				if (this != &original)
+				{
+					this->postOrderTraversalDeletion(this->_root);
+					this->_root = this->_cloneSubtree(original._root, nullptr);
+					this->_size = original._size;
+				}
+				return *this;
+			}
+
+			/* GETTERS */
+			
+			size_type	getSize(void)		{ return (this->_size); };
+			node*		getRoot(void)		{ return (this->_root); };
+			node*		getMin(void)		{ return (node::getTreeMin(this->_root)); };
+			node*		getMax(void)		{ return (node::getTreeMax(this->_root)); };
+			size_type	getRotations(void)	{ return (this->_rotations); };
+
+			/* counters of the descents, rotations, rebalancing steps and node allocations (zeros unless
+			built with FT_CONTAINERS_STATS) */
+			tree_stats	stats(void) const
+			{
+# ifdef FT_CONTAINERS_STATS
+				return (this->_stats);
+# else
+				return (tree_stats());
+# endif
+			}
+
+			/* PUBLIC METHODS */
+
+			/* standard BST insertion of a red node, then fix of the red-red violations. Returns false
+			if key exists */
+			bool	treeInsertion(const value_type &val)
+			{
+				node		*parent = nullptr;
+				node		*x = this->_root;
+				node		*newNode;
+
+				FT_STATS(this->_stats.searches++;)
+				while (x != nullptr)
+				{
+					FT_STATS(this->_stats.nodes_visited++;)
+					parent = x;
+					if (val.first < x->_val.first)
+						x = x->_left;
+					else if (x->_val.first < val.first)
+						x = x->_right;
+					else
+						return (false);
+				}
+				newNode = this->_createNewNode(val);
+				newNode->_parent = parent;
+				if (parent == nullptr)
+					this->_root = newNode;
+				else if (val.first < parent->_val.first)
+					parent->_left = newNode;
+				else
+					parent->_right = newNode;
+				this->_size++;
+				this->_insertFixup(newNode);
+				return (true);
+			}
+
+			/* check wether a key exists or not */
+			bool	IsKeyAlreadyExisting(const Key &key)
+			{
+				return (this->_search(key) != nullptr);
+			}
+
+			/* deletes a node by identifying it by its key (does nothing if the key does not exist) */
+			void	deleteNode(const Key &key)
+			{
+				node		*z;
+				node		*x;
+				node		*xParent;
+				typename node::color	removedColor;
+
+				z = this->_search(key);
+				if (z == nullptr)
+					return ;
+				removedColor = z->_color;
+				if (z->_left == nullptr || z->_right == nullptr)
+				{
+					x = (z->_left != nullptr ? z->_left : z->_right);
+					xParent = z->_parent;
+					this->_transplantNode(z, x);
+				}
+				else // the successor y takes the place and the color of z
+				{
+					node	*y = node::getTreeMin(z->_right);
+
+					removedColor = y->_color;
+					x = y->_right;
+					if (y->_parent == z)
+						xParent = y;
+					else
+					{
+						xParent = y->_parent;
+						this->_transplantNode(y, y->_right);
+						y->_right = z->_right;
+						y->_right->_parent = y;
+					}
+					this->_transplantNode(z, y);
+					y->_left = z->_left;
+					y->_left->_parent = y;
+					y->_color = z->_color;
+				}
+				this->_deleteNode(z);
+				this->_size--;
+				if (removedColor == node::BLACK)
+					this->_deleteFixup(x, xParent);
+			}
+
+			/* to cover the full tree, elem must be equal to this->_root */
+			void	postOrderTraversalDeletion(node *elem)
+			{
+				if (elem != nullptr)
+				{
+					this->postOrderTraversalDeletion(elem->_left);
+					this->postOrderTraversalDeletion(elem->_right);
+					this->_deleteNode(elem);
+				}
+				if (elem == this->_root)
+				{
+					this->_root = nullptr;
+					this->_size = 0;
+				}
+			}
+
+			/* print the tree in 2D : the root value appears in the center of the vertical axis,
+			in the left side of the terminal. Debug and visual function */
+			void	printTree(void)
+			{
+				if (this->_root == nullptr)
+					return ;
+				this->_printTree(this->_root, 0);
+			}
+			
+		private:
+
+			node					*_root;
+			size_type				_size;
+			size_type				_rotations;
+			allocator_type			_pair_alloc;
+			node_allocator_type		_node_alloc; // Alloc rebound to nodes
+			FT_STATS(tree_stats		_stats;)
+
+		private:
+
+			/* HELPERS */
+
+			/* allocate memory for a node creation, then create it (red) */
+			node	*_createNewNode(const value_type &val)
+			{
+				node		*newNode = this->_node_alloc.allocate(1);
+
+				FT_STATS(this->_stats.allocations++;)
+				new (newNode) node(val);
+				newNode->_color = node::RED;
+				return (newNode);
+			}
+
+			/* delete a node and free its memory */
+			void	_deleteNode(node *target)
+			{
+				target->~node();
+				this->_node_alloc.deallocate(target, 1);
+			}
+
+			/* deep copy of the subtree of src, colors included */
+			node	*_cloneSubtree(node *src, node *parent)
+			{
+				node	*cpy;
+
+				if (src == nullptr)
+					return (nullptr);
+				cpy = this->_createNewNode(src->_val);
+				cpy->_color = src->_color;
+				cpy->_parent = parent;
+				cpy->_left = this->_cloneSubtree(src->_left, cpy);
+				cpy->_right = this->_cloneSubtree(src->_right, cpy);
+				return (cpy);
+			}
+
+			/*  space should be equal to 0, target to this->_root */
+			void	_printTree(node *target, int space)
+			{
+				const int	indent = 5;
+				
+				if (target ==  nullptr)
+					return ;
+				space += indent;
+				this->_printTree(target->_right, space);
+				std::cout << std::endl;
+				for (int i = indent; i < space; i++)
+        			std::cout << " ";
+				std::cout << "[" << target->_val.first << (target->_color == node::RED ? "|R" : "|B") << "]" << std::endl;
+				this->_printTree(target->_left, space);
+			}
+
+			/* RBT FUNCTIONS */
+
+			static bool	_isRed(node *x) { return (x != nullptr && x->_color == node::RED); };
+
+			void	_leftRotate(node *x)
+			{
+				node	*y = x->_right;
+				
+				x->_right = y->_left;
+				if (x->_right != nullptr)
+					x->_right->_parent = x;
+				this->_transplantNode(x, y);
+				y->_left = x;
+				x->_parent = y;
+				this->_rotations++;
+				FT_STATS(this->_stats.rotations++;)
+			}
+
+			void	_rightRotate(node *y)
+			{
+				node	*x = y->_left;
+
+				y->_left = x->_right;
+				if (y->_left != nullptr)
+					y->_left->_parent = y;
+				this->_transplantNode(y, x);
+				x->_right = y;
+				y->_parent = x;
+				this->_rotations++;
+				FT_STATS(this->_stats.rotations++;)
+			}
+
+			/* iterative lookup of key, nullptr if it is missing */
+			node	*_search(const Key &key)
+			{
+				node	*x = this->_root;
+
+				FT_STATS(this->_stats.searches++;)
+				while (x != nullptr)
+				{
+					FT_STATS(this->_stats.nodes_visited++;)
+					if (key < x->_val.first)
+						x = x->_left;
+					else if (x->_val.first < key)
+						x = x->_right;
+					else
+						return (x);
+				}
+				return (nullptr);
+			}
+
+			/* replace the subtree of x by the subtree of y (y can be nullptr) */
+			void	_transplantNode(node *x, node *y)
+			{
+				if (x->_parent == nullptr)
+					this->_root = y;
+				else if (x == x->_parent->_left)
+					x->_parent->_left = y;
+				else
+					x->_parent->_right = y;
+				if (y != nullptr)
+					y->_parent = x->_parent;
+			}
+
+			/* newNode is red : while its parent is red too, either recolor (red uncle) and go up
+			to the grandparent, or rotate (black uncle) and stop */
+			void	_insertFixup(node *newNode)
+			{
+				while (_isRed(newNode->_parent))
+				{
+					node	*parent = newNode->_parent;
+					node	*grandParent = parent->_parent; // exists, the root is black
+
+					FT_STATS(this->_stats.rebalances++;)
+					if (parent == grandParent->_left)
+					{
+						node	*uncle = grandParent->_right;
+
+						if (_isRed(uncle))
+						{
+							uncle->_color = node::BLACK;
+							parent->_color = node::BLACK;
+							grandParent->_color = node::RED;
+							newNode = grandParent;
+							continue ;
+						}
+						if (newNode == parent->_right)
+						{
+							newNode = parent;
+							this->_leftRotate(newNode);
+							parent = newNode->_parent;
+						}
+						parent->_color = node::BLACK;
+						grandParent->_color = node::RED;
+						this->_rightRotate(grandParent);
+					}
+					else
+					{
+						node	*uncle = grandParent->_left;
+
+						if (_isRed(uncle))
+						{
+							uncle->_color = node::BLACK;
+							parent->_color = node::BLACK;
+							grandParent->_color = node::RED;
+							newNode = grandParent;
+							continue ;
+						}
+						if (newNode == parent->_left)
+						{
+							newNode = parent;
+							this->_rightRotate(newNode);
+							parent = newNode->_parent;
+						}
+						parent->_color = node::BLACK;
+						grandParent->_color = node::RED;
+						this->_leftRotate(grandParent);
+					}
+				}
+				this->_root->_color = node::BLACK;
+			}
+
+			/* a black node was removed above x (x can be nullptr, so its parent is given) : x carries
+			an extra black, pushed up or absorbed by recolorings and rotations of its sibling */
+			void	_deleteFixup(node *x, node *parent)
+			{
+				while (x != this->_root && _isRed(x) == false)
+				{
+					FT_STATS(this->_stats.rebalances++;)
+					if (x == parent->_left)
+					{
+						node	*sibling = parent->_right;
+
+						if (_isRed(sibling))
+						{
+							sibling->_color = node::BLACK;
+							parent->_color = node::RED;
+							this->_leftRotate(parent);
+							sibling = parent->_right;
+						}
+						if (_isRed(sibling->_left) == false && _isRed(sibling->_right) == false)
+						{
+							sibling->_color = node::RED;
+							x = parent;
+							parent = x->_parent;
+							continue ;
+						}
+						if (_isRed(sibling->_right) == false)
+						{
+							sibling->_left->_color = node::BLACK;
+							sibling->_color = node::RED;
+							this->_rightRotate(sibling);
+							sibling = parent->_right;
+						}
+						sibling->_color = parent->_color;
+						parent->_color = node::BLACK;
+						sibling->_right->_color = node::BLACK;
+						this->_leftRotate(parent);
+					}
+					else
+					{
+						node	*sibling = parent->_left;
+
+						if (_isRed(sibling))
+						{
+							sibling->_color = node::BLACK;
+							parent->_color = node::RED;
+							this->_rightRotate(parent);
+							sibling = parent->_left;
+						}
+						if (_isRed(sibling->_left) == false && _isRed(sibling->_right) == false)
+						{
+							sibling->_color = node::RED;
+							x = parent;
+							parent = x->_parent;
+							continue ;
+						}
+						if (_isRed(sibling->_left) == false)
+						{
+							sibling->_right->_color = node::BLACK;
+							sibling->_color = node::RED;
+							this->_leftRotate(sibling);
+							sibling = parent->_left;
+						}
+						sibling->_color = parent->_color;
+						parent->_color = node::BLACK;
+						sibling->_left->_color = node::BLACK;
+						this->_rightRotate(parent);
+					}
+					x = this->_root;
+				}
+				if (x != nullptr)
+					x->_color = node::BLACK;
+			}
+	};
+}
+
+#endif
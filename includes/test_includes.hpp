@@ -6,7 +6,7 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/01 15:46:01 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/15 17:44:53 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:08:37 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,33 +22,78 @@
 #include <ctime>
 
 /* includes from namespace ft */
-// add vector and map
+// add vector, deque, adapters and map
 #include "./vector/vector.hpp"
 #include "./vector/vectorIterator.hpp"
+#include "./vector/vectorBool.hpp"
+#include "./vector/bitIterator.hpp"
+#include "./deque/deque.hpp"
+#include "./deque/dequeIterator.hpp"
+#include "./adapters/stack.hpp"
+#include "./adapters/queue.hpp"
+#include "./adapters/priorityQueue.hpp"
+#include "./adapters/indexedPriorityQueue.hpp"
 #include "./map/map.hpp"
+#include "./map/frozenMap.hpp"
+#include "./map/persistentMap.hpp"
+#include "./map/shardedMap.hpp"
+#include "./map/concurrentSkiplistMap.hpp"
 #include "./map/mapIterator.hpp"
 #include "./map/node.hpp"
 #include "./map/trees/binarySearchTree.hpp"
+#include "./map/trees/AVLTree.hpp"
+#include "./map/trees/redBlackTree.hpp"
 // add utils
+#include "./utils/arena.hpp"
 #include "./utils/compare.hpp"
+#include "./utils/containerStats.hpp"
+#include "./utils/countingAllocator.hpp"
 #include "./utils/enableConst.hpp"
 #include "./utils/enableIf.hpp"
+#include "./utils/epoch.hpp"
+#include "./utils/hash.hpp"
+#include "./utils/heap.hpp"
+#include "./utils/isContiguousIterator.hpp"
 #include "./utils/isIntegral.hpp"
 #include "./utils/iteratorTraits.hpp"
 #include "./utils/pair.hpp"
+#include "./utils/parallel.hpp"
 #include "./utils/reverseIterator.hpp"
+#include "./utils/ringBuffer.hpp"
+#include "./utils/sort.hpp"
+#include "./utils/threadPool.hpp"
 
 /* include from test utils */
 #include "../srcs/test_utils/colors.hpp"
+#include "../srcs/test_utils/benchmark.hpp"
+#include "../srcs/test_utils/workload.hpp"
+#include "../srcs/test_utils/perfCounters.hpp"
+#include "../srcs/test_utils/latencyHistogram.hpp"
 
 /* utils */
 void		separator(Colors &col);
 /* tests on tree */
 void		tree_verification(Colors &col);
+void		tree_speedtest(Colors &col);
 /* tests on map */
 void		map_verif_procedure(Colors &col);
+void		map_speedtest(Colors &col);
+void		map_operations_speedtest(Colors &col);
+void		concurrent_map_speedtest(Colors &col);
 /* tests on vectors */
 void		vector_verif_procedure(Colors &col);
 void		vector_speedtest(Colors &col);
+void		vector_bool_speedtest(Colors &col);
+void		sort_speedtest(Colors &col, bool all_distributions);
+void		parallel_speedtest(Colors &col);
+void		ring_speedtest(Colors &col);
+void		arena_speedtest(Colors &col);
+/* tests on deques */
+void		deque_verif_procedure(Colors &col);
+void		deque_speedtest(Colors &col);
+/* tests on adapters */
+void		adapters_verif_procedure(Colors &col);
+void		adapters_speedtest(Colors &col);
+void		heap_speedtest(Colors &col);
 
 #endif
@@ -0,0 +1,286 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:03:53 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 08:56:28 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARENA_HPP
+# define ARENA_HPP
+
+# include <new>
+# include <cstddef>
+# include <stdint.h>
+
+/*
+
+	SYNOPSIS : arena is a monotonic memory resource, arena_allocator<T> the allocator using it.
+
+	The arena hands out memory by moving a pointer forward in large chunks. Nothing is given back
+	one allocation at a time : arena_allocator::deallocate does nothing, and reset() takes back all
+	the memory of the arena at once. Made for short lived containers thrown away together (the
+	vectors and maps of one request) : build them on an arena_allocator, destroy them, then reset.
+
+	=>	void		*allocate(size_type bytes, size_type align);	// align : a power of two
+	=>	void		reset(void);		// everything allocated is gone, the chunks are kept for reuse
+	=>	void		release(void);		// reset and gives the chunks back to operator delete
+	=>	size_type	used(void) const;		// bytes handed out since the last reset
+	=>	size_type	reserved(void) const;	// bytes of the chunks held
+
+	An allocation bigger than a quarter of a chunk gets a chunk of its own, freed by the next reset
+	instead of being kept : one big vector does not make every later request hold its memory.
+
+	arena_allocator<T> satisfies the Alloc of ft::vector, ft::deque, ft::map (its rebind gives the
+	allocator of the tree nodes, on the same arena) and of the std containers. A default constructed
+	arena_allocator uses default_arena(), shared by the whole program : give an allocator built on
+	your own arena to the containers of one request. Two arena_allocators are equal when they share
+	their arena. The containers must be destroyed (or cleared) before the reset of their arena, and
+	an arena is not thread safe : one arena per thread.
+*/
+
+namespace ft
+{
+	class	arena
+	{
+		public:
+
+			typedef std::size_t		size_type;
+
+			static const size_type	default_chunk_size = 256 * 1024;
+
+			/* CONSTRUCTOR, DESTRUCTOR (no copy) */
+
+			explicit	arena(size_type chunk_size = default_chunk_size) : _chunk_size(chunk_size), _first(nullptr),
+			_current(nullptr), _large(nullptr), _cur(nullptr), _end(nullptr), _used(0), _reserved(0) {}
+
+			~arena() { this->release(); }
+
+			/* ALLOCATION */
+
+			void	*allocate(size_type bytes, size_type align = sizeof(void *) * 2)
+			{
+				size_type	pad = (0 - reinterpret_cast<uintptr_t>(this->_cur)) & (align - 1);
+
+				if (bytes + pad <= static_cast<size_type>(this->_end - this->_cur) && bytes + pad >= bytes)
+				{
+					char	*res = this->_cur + pad;
+
+					this->_cur = res + bytes;
+					this->_used += bytes;
+					return (res);
+				}
+				return (this->_allocate_slow(bytes, align));
+			}
+
+			/* the chunks are rewound, not freed : the next request allocates no memory from the system */
+			void	reset(void)
+			{
+				this->_free_chunks(this->_large);
+				this->_large = nullptr;
+				this->_current = this->_first;
+				this->_enter(this->_current);
+				this->_used = 0;
+			}
+
+			void	release(void)
+			{
+				this->_free_chunks(this->_large);
+				this->_free_chunks(this->_first);
+				this->_first = nullptr;
+				this->_current = nullptr;
+				this->_large = nullptr;
+				this->_cur = nullptr;
+				this->_end = nullptr;
+				this->_used = 0;
+				this->_reserved = 0;
+			}
+
+			/* GETTERS */
+
+			size_type	used(void) const { return (this->_used); }
+			size_type	reserved(void) const { return (this->_reserved); }
+			size_type	chunk_size(void) const { return (this->_chunk_size); }
+
+		private:
+
+			/* header of a chunk, its memory follows it */
+			struct	_chunk
+			{
+				_chunk		*next;
+				size_type	size;
+			};
+
+			size_type	_chunk_size;
+			_chunk		*_first; // chunks kept by reset, in the order they are filled
+			_chunk		*_current;
+			_chunk		*_large; // chunks of a single big allocation
+			char		*_cur; // free memory of the current chunk : [_cur, _end)
+			char		*_end;
+			size_type	_used;
+			size_type	_reserved;
+
+			arena(const arena &original);
+			arena	&operator=(const arena &original);
+
+			static char	*_data(_chunk *c) { return (reinterpret_cast<char *>(c + 1)); }
+
+			void	_enter(_chunk *c)
+			{
+				this->_cur = c ? _data(c) : nullptr;
+				this->_end = c ? _data(c) + c->size : nullptr;
+			}
+
+			_chunk	*_new_chunk(size_type size)
+			{
+				if (size > static_cast<size_type>(-1) - sizeof(_chunk))
+					throw std::bad_alloc();
+
+				_chunk	*c = static_cast<_chunk *>(::operator new(sizeof(_chunk) + size));
+
+				c->next = nullptr;
+				c->size = size;
+				this->_reserved += size;
+				return (c);
+			}
+
+			void	_free_chunks(_chunk *c)
+			{
+				while (c)
+				{
+					_chunk	*next = c->next;
+
+					this->_reserved -= c->size;
+					::operator delete(c);
+					c = next;
+				}
+			}
+
+			/* the current chunk is full : a chunk of its own for a big allocation, else the next chunk
+			kept by reset, else a new one at the end of the list */
+			void	*_allocate_slow(size_type bytes, size_type align)
+			{
+				if (bytes > this->_chunk_size / 4 || align > this->_chunk_size / 4)
+				{
+					if (bytes > static_cast<size_type>(-1) - align)
+						throw std::bad_alloc();
+
+					_chunk		*c = this->_new_chunk(bytes + align);
+					size_type	pad = (0 - reinterpret_cast<uintptr_t>(_data(c))) & (align - 1);
+
+					c->next = this->_large;
+					this->_large = c;
+					this->_used += bytes;
+					return (_data(c) + pad);
+				}
+				if (this->_current && this->_current->next)
+					this->_current = this->_current->next;
+				else
+				{
+					_chunk	*c = this->_new_chunk(this->_chunk_size);
+
+					if (this->_current)
+						this->_current->next = c;
+					else
+						this->_first = c;
+					this->_current = c;
+				}
+				this->_enter(this->_current);
+				return (this->allocate(bytes, align));
+			}
+	};
+
+	inline arena	&default_arena(void)
+	{
+		static arena	a;
+
+		return (a);
+	}
+
+	template <class T>
+	class arena_allocator
+	{
+		public:
+
+			typedef T					value_type;
+			typedef T*					pointer;
+			typedef const T*			const_pointer;
+			typedef T&					reference;
+			typedef const T&			const_reference;
+			typedef std::size_t			size_type;
+			typedef std::ptrdiff_t		difference_type;
+
+			template <class U>
+			struct	rebind
+			{
+				typedef arena_allocator<U>	other;
+			};
+
+			/* CONSTRUCTORS AND DESTRUCTOR */
+
+			arena_allocator() : _arena(&default_arena()) {}
+
+			explicit	arena_allocator(arena &a) : _arena(&a) {}
+
+			arena_allocator(const arena_allocator &original) : _arena(original._arena) {}
+
+			/* rebind copy : same arena */
+			template <class U>
+			arena_allocator(const arena_allocator<U> &original) : _arena(&original.get_arena()) {}
+
+			~arena_allocator() {}
+
+			arena_allocator&	operator=(const arena_allocator &original)
+			{
+				this->_arena = original._arena;
+				return (*this);
+			}
+
+			/* ALLOCATION */
+
+			pointer	allocate(size_type n, const void *hint = 0)
+			{
+				(void)hint;
+				if (n > this->max_size())
+					throw std::bad_alloc();
+				return (static_cast<pointer>(this->_arena->allocate(n * sizeof(value_type), __alignof__(value_type))));
+			}
+
+			/* the memory goes back with the reset of the arena */
+			void	deallocate(pointer p, size_type n) { (void)p; (void)n; }
+
+			void	construct(pointer p, const_reference val) { new (static_cast<void *>(p)) value_type(val); }
+			void	destroy(pointer p) { p->~value_type(); }
+
+			size_type	max_size(void) const { return (static_cast<size_type>(-1) / sizeof(value_type)); }
+
+			pointer			address(reference x) const { return (&x); }
+			const_pointer	address(const_reference x) const { return (&x); }
+
+			/* GETTERS */
+
+			arena	&get_arena(void) const { return (*this->_arena); }
+
+		private:
+
+			arena	*_arena;
+	};
+
+	template <class T, class U>
+	bool	operator==(const arena_allocator<T> &lhs, const arena_allocator<U> &rhs)
+	{
+		return (&lhs.get_arena() == &rhs.get_arena());
+	}
+
+	template <class T, class U>
+	bool	operator!=(const arena_allocator<T> &lhs, const arena_allocator<U> &rhs)
+	{
+		return (&lhs.get_arena() != &rhs.get_arena());
+	}
+}
+
+#endif
@@ -6,17 +6,34 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/03 15:46:31 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/14 12:31:28 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:32:13 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef COMPARE_HPP
 # define COMPARE_HPP
 
-#include "../test_includes.hpp"
+#include "../vector/vectorIterator.hpp"
+#include "./isContiguousIterator.hpp"
+#include <cstring>
+#include <cstddef>
+#include <stdint.h>
+
+# if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define FT_COMPARE_X86 1
+#  include <immintrin.h>
+# else
+#  define FT_COMPARE_X86 0
+# endif
 
 /* contains lexicographical_compare and equal, two template functions used to assess 
-equivalence of two ranges of iterators */
+equivalence of two ranges of iterators.
+
+Both have overloads for contiguous ranges (raw pointers, vectorIterator) : when both ranges hold the
+same integral type, two elements are equal exactly when their bytes are, so equal becomes a memcmp
+and lexicographical_compare looks for the first differing byte with SSE2 or AVX2 (16 or 32 bytes
+compared per instruction, chosen at the first call from the CPU features), then compares the two
+elements holding it. Other element types (floating points, classes) keep the generic loop. */
 
 namespace ft
 {
@@ -53,6 +70,205 @@ namespace ft
 		}
 		return (first2 != last2);
 	}
+
+	/* BYTE MISMATCH KERNELS */
+
+	/* index of the first byte differing between a and b, n if there is none. 8 bytes per step */
+	inline std::size_t	mismatch_bytes_scalar(const unsigned char *a, const unsigned char *b, std::size_t n)
+	{
+		std::size_t		i = 0;
+		uint64_t		x;
+		uint64_t		y;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			std::memcpy(&x, a + i, 8);
+			std::memcpy(&y, b + i, 8);
+			if (x != y)
+				break ;
+		}
+		while (i < n && a[i] == b[i])
+			i++;
+		return (i);
+	}
+
+# if FT_COMPARE_X86
+
+	/* 16 bytes per step : the equal bytes give a 16 bits mask, its first zero bit is the mismatch */
+	__attribute__((target("sse2")))
+	inline std::size_t	mismatch_bytes_sse2(const unsigned char *a, const unsigned char *b, std::size_t n)
+	{
+		std::size_t		i = 0;
+		unsigned int	diff;
+
+		for (; i + 16 <= n; i += 16)
+		{
+			diff = 0xFFFFu ^ static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+				_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)),
+				_mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i)))));
+			if (diff != 0)
+				return (i + __builtin_ctz(diff));
+		}
+		return (i + mismatch_bytes_scalar(a + i, b + i, n - i));
+	}
+
+	/* same with 32 bytes per step */
+	__attribute__((target("avx2")))
+	inline std::size_t	mismatch_bytes_avx2(const unsigned char *a, const unsigned char *b, std::size_t n)
+	{
+		std::size_t		i = 0;
+		unsigned int	diff;
+
+		for (; i + 32 <= n; i += 32)
+		{
+			diff = 0xFFFFFFFFu ^ static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+				_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)),
+				_mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i)))));
+			if (diff != 0)
+				return (i + __builtin_ctz(diff));
+		}
+		return (i + mismatch_bytes_scalar(a + i, b + i, n - i));
+	}
+
+# endif
+
+	typedef std::size_t	(*mismatch_bytes_kernel)(const unsigned char *, const unsigned char *, std::size_t);
+
+	/* widest kernel supported by the CPU running the program */
+	inline mismatch_bytes_kernel	select_mismatch_bytes(const char **name = nullptr)
+	{
+		const char				*dummy;
+		mismatch_bytes_kernel	kernel = mismatch_bytes_scalar;
+
+		if (name == nullptr)
+			name = &dummy;
+		*name = "scalar";
+# if FT_COMPARE_X86
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+		{
+			*name = "avx2";
+			kernel = mismatch_bytes_avx2;
+		}
+		else if (__builtin_cpu_supports("sse2"))
+		{
+			*name = "sse2";
+			kernel = mismatch_bytes_sse2;
+		}
+# endif
+		return (kernel);
+	}
+
+	/* the CPU is checked once, then every call goes straight to the selected kernel */
+	inline std::size_t	mismatch_bytes(const unsigned char *a, const unsigned char *b, std::size_t n)
+	{
+		static const mismatch_bytes_kernel		kernel = select_mismatch_bytes();
+
+		return (kernel(a, b, n));
+	}
+
+	/* CONTIGUOUS RANGES */
+
+	/* bitwise_comparable<T1, T2>::value is true when ranges of T1 and T2 can be compared byte per byte :
+	same integral type on both sides, const or not (no padding, one representation per value) */
+	template <class T1, class T2>
+	struct bitwise_comparable
+	{
+		static const bool value = false;
+	};
+
+	# define FT_BITWISE_COMPARABLE(type)											\
+	template <> struct bitwise_comparable<type, type> { static const bool value = true; };			\
+	template <> struct bitwise_comparable<const type, type> { static const bool value = true; };	\
+	template <> struct bitwise_comparable<type, const type> { static const bool value = true; };	\
+	template <> struct bitwise_comparable<const type, const type> { static const bool value = true; };
+
+	FT_BITWISE_COMPARABLE(bool)
+	FT_BITWISE_COMPARABLE(char)
+	FT_BITWISE_COMPARABLE(signed char)
+	FT_BITWISE_COMPARABLE(unsigned char)
+	FT_BITWISE_COMPARABLE(wchar_t)
+	FT_BITWISE_COMPARABLE(short)
+	FT_BITWISE_COMPARABLE(unsigned short)
+	FT_BITWISE_COMPARABLE(int)
+	FT_BITWISE_COMPARABLE(unsigned int)
+	FT_BITWISE_COMPARABLE(long)
+	FT_BITWISE_COMPARABLE(unsigned long)
+	FT_BITWISE_COMPARABLE(long long)
+	FT_BITWISE_COMPARABLE(unsigned long long)
+
+	# undef FT_BITWISE_COMPARABLE
+
+	template <bool Bitwise>
+	struct bitwise_tag {};
+
+	template <class T1, class T2>
+	bool	contiguous_equal(T1 *first1, T1 *last1, T2 *first2, bitwise_tag<false>)
+	{
+		return (ft::equal<T1 *, T2 *>(first1, last1, first2));
+	}
+
+	template <class T1, class T2>
+	bool	contiguous_equal(T1 *first1, T1 *last1, T2 *first2, bitwise_tag<true>)
+	{
+		return (first1 == last1 || std::memcmp(first1, first2, (last1 - first1) * sizeof(T1)) == 0);
+	}
+
+	template <class T1, class T2>
+	bool	contiguous_lexicographical_compare(T1 *first1, T1 *last1, T2 *first2, T2 *last2,
+		bitwise_tag<false>)
+	{
+		return (ft::lexicographical_compare<T1 *, T2 *>(first1, last1, first2, last2));
+	}
+
+	/* the element holding the first differing byte is the first differing element */
+	template <class T1, class T2>
+	bool	contiguous_lexicographical_compare(T1 *first1, T1 *last1, T2 *first2, T2 *last2,
+		bitwise_tag<true>)
+	{
+		std::size_t		n1 = last1 - first1;
+		std::size_t		n2 = last2 - first2;
+		std::size_t		n = (n1 < n2 ? n1 : n2);
+		std::size_t		i;
+
+		if (n == 0)
+			return (n1 < n2);
+		i = ft::mismatch_bytes(reinterpret_cast<const unsigned char *>(first1),
+			reinterpret_cast<const unsigned char *>(first2), n * sizeof(T1)) / sizeof(T1);
+		if (i < n)
+			return (first1[i] < first2[i]);
+		return (n1 < n2);
+	}
+
+	/* raw pointers */
+	template <class T1, class T2>
+	bool	equal(T1 *first1, T1 *last1, T2 *first2)
+	{
+		return (ft::contiguous_equal(first1, last1, first2,
+			bitwise_tag<bitwise_comparable<T1, T2>::value>()));
+	}
+
+	template <class T1, class T2>
+	bool	lexicographical_compare(T1 *first1, T1 *last1, T2 *first2, T2 *last2)
+	{
+		return (ft::contiguous_lexicographical_compare(first1, last1, first2, last2,
+			bitwise_tag<bitwise_comparable<T1, T2>::value>()));
+	}
+
+	/* vectorIterator : the elements are compared through their addresses */
+	template <class T, bool C1, bool C2>
+	bool	equal(vectorIterator<T, C1> first1, vectorIterator<T, C1> last1, vectorIterator<T, C2> first2)
+	{
+		return (ft::equal(ft::to_address(first1), ft::to_address(last1), ft::to_address(first2)));
+	}
+
+	template <class T, bool C1, bool C2>
+	bool	lexicographical_compare(vectorIterator<T, C1> first1, vectorIterator<T, C1> last1,
+		vectorIterator<T, C2> first2, vectorIterator<T, C2> last2)
+	{
+		return (ft::lexicographical_compare(ft::to_address(first1), ft::to_address(last1),
+			ft::to_address(first2), ft::to_address(last2)));
+	}
 }
 
 #endif
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   containerStats.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:58:26 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 04:58:26 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONTAINERSTATS_HPP
+# define CONTAINERSTATS_HPP
+
+# include <cstddef>
+
+/*
+
+	SYNOPSIS : hot path counters of the containers, compiled only with -DFT_CONTAINERS_STATS.
+
+	Without the flag, FT_STATS(expr) expands to nothing : the containers have no counter member and
+	no counting instruction, and their stats() returns a snapshot full of zeros. With the flag, every
+	container counts in its own stats, and stats() returns a copy of them.
+
+	=>	vector_stats	: reallocations		arrays allocated to change the capacity
+						  copied			elements copied from the old array to the new one
+						  shifted			elements moved by insert / erase to open or close a gap
+	=>	tree_stats		: searches			descents from the root (lookup, insertion, deletion)
+						  nodes_visited		nodes compared during those descents
+						  rotations			left or right rotations
+						  rebalances		fixup steps (AVL retracing, red-black recoloring or rotation)
+						  allocations		calls of the node allocator (the slab of a copy counts once)
+
+	The counters are not atomic : they follow the thread safety of the container itself.
+*/
+
+# ifdef FT_CONTAINERS_STATS
+#  define FT_STATS_ENABLED 1
+#  define FT_STATS(expr) expr
+# else
+#  define FT_STATS_ENABLED 0
+#  define FT_STATS(expr)
+# endif
+
+namespace ft
+{
+	struct	vector_stats
+	{
+		std::size_t		reallocations;
+		std::size_t		copied;
+		std::size_t		shifted;
+
+		vector_stats() : reallocations(0), copied(0), shifted(0) {}
+	};
+
+	struct	tree_stats
+	{
+		std::size_t		searches;
+		std::size_t		nodes_visited;
+		std::size_t		rotations;
+		std::size_t		rebalances;
+		std::size_t		allocations;
+
+		tree_stats() : searches(0), nodes_visited(0), rotations(0), rebalances(0), allocations(0) {}
+	};
+}
+
+#endif
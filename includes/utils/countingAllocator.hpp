@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   countingAllocator.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:53:03 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 04:54:43 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COUNTINGALLOCATOR_HPP
+# define COUNTINGALLOCATOR_HPP
+
+# include <memory>
+# include <cstddef>
+
+/*
+
+	SYNOPSIS : counting_allocator forwards to an Inner allocator and counts what goes through it.
+
+	The counts are kept in an allocation_stats shared by every copy and every rebind of the allocator
+	(the stats pointer is copied), so the stats of a map see the pairs and the nodes of its tree.
+	A default constructed counting_allocator uses default_allocation_stats(), shared by the whole
+	program : give an allocator built on your own allocation_stats to count one container alone.
+
+	=>	allocations / deallocations	: calls of allocate / deallocate
+	=>	allocated_bytes				: bytes of all the allocations
+	=>	live_bytes / peak_bytes		: bytes allocated but not deallocated yet, and their maximum
+	=>	growths						: allocations of several elements bigger than the previous one of
+									  several elements, like a vector moving to a bigger array
+
+	Two counting_allocators are equal when they share their stats : memory allocated by one of them
+	can be deallocated by the other. The counts are not atomic : one container per thread.
+*/
+
+namespace ft
+{
+	struct	allocation_stats
+	{
+		std::size_t		allocations;
+		std::size_t		deallocations;
+		std::size_t		allocated_bytes;
+		std::size_t		live_bytes;
+		std::size_t		peak_bytes;
+		std::size_t		growths;
+		std::size_t		last_block; // bytes of the last allocation of several elements
+
+		allocation_stats() : allocations(0), deallocations(0), allocated_bytes(0), live_bytes(0),
+		peak_bytes(0), growths(0), last_block(0) {}
+	};
+
+	inline allocation_stats	&default_allocation_stats(void)
+	{
+		static allocation_stats		stats;
+
+		return (stats);
+	}
+
+	template <class T, class Inner = std::allocator<T> >
+	class counting_allocator
+	{
+		public:
+
+			typedef typename Inner::value_type			value_type;
+			typedef typename Inner::pointer				pointer;
+			typedef typename Inner::const_pointer		const_pointer;
+			typedef typename Inner::reference			reference;
+			typedef typename Inner::const_reference		const_reference;
+			typedef typename Inner::size_type			size_type;
+			typedef typename Inner::difference_type		difference_type;
+			typedef Inner								inner_allocator_type;
+
+			template <class U>
+			struct	rebind
+			{
+				typedef counting_allocator<U, typename Inner::template rebind<U>::other>	other;
+			};
+
+			/* CONSTRUCTORS AND DESTRUCTOR */
+
+			counting_allocator() : _inner(), _stats(&default_allocation_stats()) {}
+
+			explicit	counting_allocator(allocation_stats &stats, const Inner &inner = Inner())
+			: _inner(inner), _stats(&stats) {}
+
+			counting_allocator(const counting_allocator &original) : _inner(original._inner),
+			_stats(original._stats) {}
+
+			/* rebind copy : same stats, inner allocator rebound */
+			template <class U, class OtherInner>
+			counting_allocator(const counting_allocator<U, OtherInner> &original)
+			: _inner(original.inner()), _stats(&original.stats()) {}
+
+			~counting_allocator() {}
+
+			counting_allocator&	operator=(const counting_allocator &original)
+			{
+				this->_inner = original._inner;
+				this->_stats = original._stats;
+				return (*this);
+			}
+
+			/* ALLOCATION */
+
+			pointer	allocate(size_type n, const void *hint = 0)
+			{
+				pointer			res = this->_inner.allocate(n, hint);
+				std::size_t		bytes = n * sizeof(value_type);
+
+				this->_stats->allocations++;
+				this->_stats->allocated_bytes += bytes;
+				this->_stats->live_bytes += bytes;
+				if (this->_stats->live_bytes > this->_stats->peak_bytes)
+					this->_stats->peak_bytes = this->_stats->live_bytes;
+				if (n > 1)
+				{
+					if (this->_stats->last_block > 0 && bytes > this->_stats->last_block)
+						this->_stats->growths++;
+					this->_stats->last_block = bytes;
+				}
+				return (res);
+			}
+
+			void	deallocate(pointer p, size_type n)
+			{
+				this->_stats->deallocations++;
+				this->_stats->live_bytes -= n * sizeof(value_type);
+				this->_inner.deallocate(p, n);
+			}
+
+			void	construct(pointer p, const_reference val) { this->_inner.construct(p, val); }
+			void	destroy(pointer p) { this->_inner.destroy(p); }
+
+			size_type	max_size(void) const { return (this->_inner.max_size()); }
+
+			pointer			address(reference x) const { return (this->_inner.address(x)); }
+			const_pointer	address(const_reference x) const { return (this->_inner.address(x)); }
+
+			/* GETTERS */
+
+			allocation_stats	&stats(void) const { return (*this->_stats); }
+			const Inner			&inner(void) const { return (this->_inner); }
+
+		private:
+
+			Inner				_inner;
+			allocation_stats	*_stats;
+	};
+
+	template <class T, class InnerT, class U, class InnerU>
+	bool	operator==(const counting_allocator<T, InnerT> &lhs, const counting_allocator<U, InnerU> &rhs)
+	{
+		return (&lhs.stats() == &rhs.stats());
+	}
+
+	template <class T, class InnerT, class U, class InnerU>
+	bool	operator!=(const counting_allocator<T, InnerT> &lhs, const counting_allocator<U, InnerU> &rhs)
+	{
+		return (&lhs.stats() != &rhs.stats());
+	}
+}
+
+#endif
@@ -6,15 +6,13 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/03 15:46:35 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/11/03 15:46:36 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:32:13 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef ENABLE_IF_HPP
 # define ENABLE_IF_HPP
 
-#include "../test_includes.hpp"
-
 /* enable_if is related to SFINAE (see next paragraph). enable_if check wether a condition is true,
 and enable the template substitution by the compiler. Otherwise, it makes it fails in a SFINAE way,
 using an ill-formed implementation intentionally */
@@ -0,0 +1,254 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   epoch.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:33:03 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 08:58:37 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EPOCH_HPP
+# define EPOCH_HPP
+
+# include <vector>
+# include <cstddef>
+# include <stdexcept>
+# include <stdint.h>
+# include <pthread.h>
+
+/*
+
+	SYNOPSIS : epoch_domain reclaims the memory of lock-free containers (epoch-based reclamation).
+
+	A node removed from a lock-free structure can still be read by threads that reached it before
+	its removal, so it can not be freed at once : it is retired instead. The domain keeps a global
+	epoch, and every thread publishes the epoch it saw when it started an operation (enter / exit,
+	or a guard). The global epoch only moves from e to e + 1 when every active thread has seen e :
+	a node retired at epoch e can not be reached anymore once the global epoch is e + 2, and is
+	freed then by the thread which retired it.
+
+	=>	threads take one of max_threads slots on their first enter, and keep it in every domain : the
+		slots and the pthread key giving them back when a thread ends are shared by the whole process,
+		so any number of domains can be created. enter / exit can be nested, and must be balanced
+		before the thread ends.
+	=>	a retired node is given with the function freeing it, and a context for that function.
+	=>	the destructor frees everything still retired : no thread must use the domain anymore.
+*/
+
+namespace ft
+{
+	class epoch_domain
+	{
+		public:
+
+			typedef void	(*reclaim_function)(void *ptr, void *context);
+
+			static const int	max_threads = 128;
+
+			/* enters the domain from construction to destruction */
+			class	guard
+			{
+				public:
+
+					explicit	guard(epoch_domain &domain) : _domain(&domain) { domain.enter(); }
+					~guard() { this->_domain->exit(); }
+
+				private:
+
+					guard(const guard &original);
+					guard&	operator=(const guard &original);
+
+					epoch_domain	*_domain;
+			};
+
+		/* CONSTRUCTOR, DESTRUCTOR (no copy) */
+
+			epoch_domain(void) : _epoch(0)
+			{
+				for (int i = 0; i < max_threads; i++)
+				{
+					this->_records[i].epoch = 0;
+					this->_records[i].active = 0;
+					this->_records[i].nesting = 0;
+					this->_records[i].retired = 0;
+					for (int b = 0; b < 3; b++)
+						this->_records[i].bag_epoch[b] = 0;
+				}
+			}
+
+			~epoch_domain()
+			{
+				for (int i = 0; i < max_threads; i++)
+					for (int b = 0; b < 3; b++)
+						this->_freeBag(this->_records[i].bags[b]);
+			}
+
+		/* CRITICAL SECTIONS */
+
+			/* from enter to exit, nothing retired meanwhile is freed */
+			void	enter(void)
+			{
+				_record		*self = this->_self();
+
+				if (self->nesting++ > 0)
+					return ;
+				self->active = 1;
+				__sync_synchronize(); // seen active before reading the epoch
+				self->epoch = this->_epoch;
+				__sync_synchronize(); // published before any read of the structure
+			}
+
+			void	exit(void)
+			{
+				_record		*self = this->_self();
+
+				if (--self->nesting > 0)
+					return ;
+				__sync_synchronize(); // reads of the structure done before
+				self->active = 0;
+			}
+
+		/* RECLAMATION */
+
+			/* ptr is unlinked : reclaim(ptr, context) will be called when no thread can read it */
+			void	retire(void *ptr, reclaim_function reclaim, void *context)
+			{
+				_record			*self = this->_self();
+				unsigned long	epoch = this->_epoch;
+				int				bag = epoch % 3;
+				_retired		item;
+
+				if (self->bag_epoch[bag] != epoch) // this bag holds nodes of epoch - 3 at most
+				{
+					this->_freeBag(self->bags[bag]);
+					self->bag_epoch[bag] = epoch;
+				}
+				item.ptr = ptr;
+				item.reclaim = reclaim;
+				item.context = context;
+				self->bags[bag].push_back(item);
+				if (++self->retired % 64 == 0)
+				{
+					this->_tryAdvance();
+					this->_collect(*self);
+				}
+			}
+
+			unsigned long	epoch(void) const { return (this->_epoch); };
+
+		private:
+
+			struct	_retired
+			{
+				void				*ptr;
+				reclaim_function	reclaim;
+				void				*context;
+			};
+
+			/* written by the thread owning its slot only */
+			struct	_record
+			{
+				volatile unsigned long	epoch;
+				volatile int			active;
+				int						nesting;
+				std::size_t				retired;
+				std::vector<_retired>	bags[3];
+				unsigned long			bag_epoch[3];
+			} __attribute__((aligned(64)));
+
+			epoch_domain(const epoch_domain &original);
+			epoch_domain&	operator=(const epoch_domain &original);
+
+			/* slots of the threads, common to every domain */
+			struct	_threads
+			{
+				pthread_key_t	key;
+				int				key_error;
+				volatile int	used[max_threads];
+			};
+
+			static _threads	&_registry(void)
+			{
+				static _threads		registry; // zero-initialized, before any thread can call
+
+				return (registry);
+			}
+
+			static void	_createKey(void)
+			{
+				_registry().key_error = pthread_key_create(&_registry().key, &epoch_domain::_releaseSlot);
+			}
+
+			/* slot of the calling thread, claimed on its first call in any domain */
+			static int	_threadSlot(void)
+			{
+				static pthread_once_t	once = PTHREAD_ONCE_INIT;
+				_threads				&registry = _registry();
+				void					*slot;
+
+				pthread_once(&once, &epoch_domain::_createKey);
+				if (registry.key_error != 0)
+					throw std::runtime_error("epoch_domain");
+				slot = pthread_getspecific(registry.key);
+				if (slot != nullptr)
+					return (static_cast<int>(reinterpret_cast<intptr_t>(slot)) - 1);
+				for (int i = 0; i < max_threads; i++)
+				{
+					if (registry.used[i] == 0 && __sync_bool_compare_and_swap(&registry.used[i], 0, 1))
+					{
+						pthread_setspecific(registry.key, reinterpret_cast<void*>(static_cast<intptr_t>(i) + 1));
+						return (i);
+					}
+				}
+				throw std::runtime_error("epoch_domain : too many threads");
+			}
+
+			/* called when a thread ends : its retired nodes stay in the slot for the next owner */
+			static void	_releaseSlot(void *slot)
+			{
+				__sync_lock_release(&_registry().used[reinterpret_cast<intptr_t>(slot) - 1]);
+			}
+
+			_record	*_self(void) { return (&this->_records[_threadSlot()]); };
+
+			/* global epoch + 1 if every active thread has seen it */
+			void	_tryAdvance(void)
+			{
+				unsigned long	epoch = this->_epoch;
+
+				for (int i = 0; i < max_threads; i++)
+				{
+					if (this->_records[i].active && this->_records[i].epoch != epoch)
+						return ;
+				}
+				__sync_bool_compare_and_swap(&this->_epoch, epoch, epoch + 1);
+			}
+
+			/* frees the bags retired two epochs ago or more */
+			void	_collect(_record &self)
+			{
+				unsigned long	epoch = this->_epoch;
+
+				for (int b = 0; b < 3; b++)
+				{
+					if (self.bag_epoch[b] + 2 <= epoch)
+						this->_freeBag(self.bags[b]);
+				}
+			}
+
+			void	_freeBag(std::vector<_retired> &bag)
+			{
+				for (std::size_t i = 0; i < bag.size(); i++)
+					bag[i].reclaim(bag[i].ptr, bag[i].context);
+				bag.clear();
+			}
+
+			_record					_records[max_threads];
+			volatile unsigned long	_epoch;
+	};
+}
+
+#endif
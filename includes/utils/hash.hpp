@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:28:52 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 06:27:40 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_HPP
+# define HASH_HPP
+
+#include <string>
+#include <cstddef>
+
+/* hash is a function object returning a std::size_t for a key, like std::hash (which is C++11).
+It is specialized for the integral types, pointers and std::string. The unspecialized template is
+only declared : using hash with another key type fails at compile time, a hash functor has to be
+given to the container instead.
+
+Integers are mixed with the finalizer of MurmurHash3 (every bit of the key changes about half the
+bits of the result), so that keys sharing their low bits (multiples of 16, ...) are still spread
+when the result is reduced modulo a small number of buckets or shards. Strings use FNV-1a. */
+
+namespace ft
+{
+	/* MurmurHash3 64 bits finalizer */
+	inline std::size_t	hash_mix(unsigned long long x)
+	{
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccdULL;
+		x ^= x >> 33;
+		x *= 0xc4ceb9fe1a85ec53ULL;
+		x ^= x >> 33;
+		return (static_cast<std::size_t>(x));
+	}
+
+	template <class T>
+	struct hash;
+
+	/* one specialization per integral type, all of them mixing the value */
+	# define FT_INTEGRAL_HASH(type)												\
+	template <>																	\
+	struct hash<type>															\
+	{																			\
+		std::size_t	operator()(type x) const									\
+		{																		\
+			return (hash_mix(static_cast<unsigned long long>(x)));				\
+		}																		\
+	};
+
+	FT_INTEGRAL_HASH(bool)
+	FT_INTEGRAL_HASH(char)
+	FT_INTEGRAL_HASH(signed char)
+	FT_INTEGRAL_HASH(unsigned char)
+	FT_INTEGRAL_HASH(wchar_t)
+	FT_INTEGRAL_HASH(short)
+	FT_INTEGRAL_HASH(unsigned short)
+	FT_INTEGRAL_HASH(int)
+	FT_INTEGRAL_HASH(unsigned int)
+	FT_INTEGRAL_HASH(long)
+	FT_INTEGRAL_HASH(unsigned long)
+	FT_INTEGRAL_HASH(long long)
+	FT_INTEGRAL_HASH(unsigned long long)
+
+	# undef FT_INTEGRAL_HASH
+
+	template <class T>
+	struct hash<T*>
+	{
+		std::size_t	operator()(T *x) const
+		{
+			return (hash_mix(reinterpret_cast<unsigned long long>(x)));
+		}
+	};
+
+	/* FNV-1a, 64 bits */
+	template <>
+	struct hash<std::string>
+	{
+		std::size_t	operator()(const std::string &x) const
+		{
+			unsigned long long	h = 0xcbf29ce484222325ULL;
+
+			for (std::size_t i = 0; i < x.size(); i++)
+			{
+				h ^= static_cast<unsigned char>(x[i]);
+				h *= 0x100000001b3ULL;
+			}
+			return (static_cast<std::size_t>(h));
+		}
+	};
+}
+
+#endif
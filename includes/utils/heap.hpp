@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heap.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:43:51 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:49:51 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HEAP_HPP
+# define HEAP_HPP
+
+#include "./iteratorTraits.hpp"
+#include <algorithm>
+#include <cstddef>
+
+/*
+
+	SYNOPSIS : d-ary heaps over random access iterators (Arity children per node, Arity >= 2).
+
+	=>	void	make_dary_heap<Arity>(RandomIt first, RandomIt last, Compare comp);	// O(n)
+	=>	void	push_dary_heap<Arity>(RandomIt first, RandomIt last, Compare comp);	// *(last - 1) is the new one
+	=>	void	pop_dary_heap<Arity>(RandomIt first, RandomIt last, Compare comp);	// the top goes to last - 1
+	=>	bool	is_dary_heap<Arity>(RandomIt first, RandomIt last, Compare comp);
+	=>	Distance	dary_sift_up<Arity>(RandomIt first, Distance hole, Compare comp);
+	=>	Distance	dary_sift_down<Arity>(RandomIt first, Distance hole, Distance len, Compare comp);
+	=>	Distance	dary_greatest_child<Arity>(RandomIt first, Distance child, Distance len, Compare comp);
+	=>	void	dary_prefetch_grandchildren<Arity>(RandomIt first, Distance child, Distance len);
+
+	Same contract as the std heap algorithms : the top (first) is the greatest element for comp. The
+	children of the node i are the Arity consecutive nodes from Arity * i + 1 : a 4-ary heap of ints reads
+	16 bytes per level, a 8-ary heap 32 bytes, in one or two cache lines. The heap is log2(Arity) times
+	less deep than a binary heap : a pop compares more elements per level, but misses the cache on less
+	levels, which wins once the heap no longer fits in the cache. The sifts move a hole instead of
+	swapping, and return the final position of the element (for the indexed heaps). pop moves the hole
+	of the top down to a leaf before placing the last element (as std::pop_heap), prefetching the
+	grandchildren of each node on its way : one cache line for a 4-ary heap of ints.
+*/
+
+namespace ft
+{
+	/* moves the element at hole up while it is greater than its parent */
+	template <std::size_t Arity, class RandomIt, class Distance, class Compare>
+	Distance	dary_sift_up(RandomIt first, Distance hole, Compare comp)
+	{
+		typename ft::iterator_traits<RandomIt>::value_type		val = *(first + hole);
+		Distance												parent;
+
+		while (hole > 0)
+		{
+			parent = (hole - 1) / static_cast<Distance>(Arity);
+			if (comp(*(first + parent), val) == false)
+				break ;
+			*(first + hole) = *(first + parent);
+			hole = parent;
+		}
+		*(first + hole) = val;
+		return (hole);
+	}
+
+	/* the grandchildren of a node are Arity * Arity consecutive elements : asks the cache for them while
+	the children are compared, one hint per line */
+	template <std::size_t Arity, class RandomIt, class Distance>
+	void	dary_prefetch_grandchildren(RandomIt first, Distance child, Distance len)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type		value_type;
+		const Distance													grandchild = static_cast<Distance>(Arity) * child + 1;
+		const Distance													count = static_cast<Distance>(Arity * Arity);
+		const Distance													step = (sizeof(value_type) < 64 ? 64 / sizeof(value_type) : 1);
+
+		for (Distance i = 0; i < count && grandchild + i < len; i += step)
+			__builtin_prefetch(&*(first + (grandchild + i)));
+	}
+
+	/* greatest of the children [child, child + Arity) of a node, cut at len. For a full node the bound of
+	the loop is a constant : the compiler unrolls it */
+	template <std::size_t Arity, class RandomIt, class Distance, class Compare>
+	Distance	dary_greatest_child(RandomIt first, Distance child, Distance len, Compare comp)
+	{
+		Distance	best = child;
+
+		if (len - child >= static_cast<Distance>(Arity))
+		{
+			for (std::size_t i = 1; i < Arity; i++)
+				if (comp(*(first + best), *(first + (child + static_cast<Distance>(i)))))
+					best = child + static_cast<Distance>(i);
+		}
+		else
+			for (++child; child < len; ++child)
+				if (comp(*(first + best), *(first + child)))
+					best = child;
+		return (best);
+	}
+
+	/* moves the element at hole down the heap [first, first + len), under its greatest child */
+	template <std::size_t Arity, class RandomIt, class Distance, class Compare>
+	Distance	dary_sift_down(RandomIt first, Distance hole, Distance len, Compare comp)
+	{
+		typename ft::iterator_traits<RandomIt>::value_type		val = *(first + hole);
+		Distance												child;
+
+		while ((child = static_cast<Distance>(Arity) * hole + 1) < len)
+		{
+			child = ft::dary_greatest_child<Arity>(first, child, len, comp);
+			if (comp(val, *(first + child)) == false)
+				break ;
+			*(first + hole) = *(first + child);
+			hole = child;
+		}
+		*(first + hole) = val;
+		return (hole);
+	}
+
+	/* sifts down every parent, from the last one : O(n) */
+	template <std::size_t Arity, class RandomIt, class Compare>
+	void	make_dary_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::difference_type		Distance;
+		Distance															len = last - first;
+
+		if (len < 2)
+			return ;
+		for (Distance i = (len - 2) / static_cast<Distance>(Arity) + 1; i-- > 0; )
+			ft::dary_sift_down<Arity>(first, i, len, comp);
+	}
+
+	template <std::size_t Arity, class RandomIt, class Compare>
+	void	push_dary_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		if (last - first > 1)
+			ft::dary_sift_up<Arity>(first, (last - first) - 1, comp);
+	}
+
+	/* the last element of the heap is one of the smallest : the hole left by the top goes down to a leaf
+	without comparing it (one comparison less per level), then it comes back up from there */
+	template <std::size_t Arity, class RandomIt, class Compare>
+	void	pop_dary_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::difference_type		Distance;
+		Distance															len = (last - first) - 1;
+		Distance															hole = 0;
+		Distance															child;
+
+		if (len < 1)
+			return ;
+		std::iter_swap(first, last - 1);
+		typename ft::iterator_traits<RandomIt>::value_type		val = *first;
+
+		while ((child = static_cast<Distance>(Arity) * hole + 1) < len)
+		{
+			ft::dary_prefetch_grandchildren<Arity>(first, child, len);
+			child = ft::dary_greatest_child<Arity>(first, child, len, comp);
+			*(first + hole) = *(first + child);
+			hole = child;
+		}
+		*(first + hole) = val;
+		ft::dary_sift_up<Arity>(first, hole, comp);
+	}
+
+	template <std::size_t Arity, class RandomIt, class Compare>
+	bool	is_dary_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::difference_type		Distance;
+
+		for (Distance i = 1; i < last - first; i++)
+			if (comp(*(first + (i - 1) / static_cast<Distance>(Arity)), *(first + i)))
+				return (false);
+		return (true);
+	}
+}
+
+#endif
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   isContiguousIterator.hpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:02:36 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 06:27:46 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef IS_CONTIGUOUS_ITERATOR_HPP
+# define IS_CONTIGUOUS_ITERATOR_HPP
+
+#include "../vector/vectorIterator.hpp"
+
+/* is_contiguous_iterator<Iterator>::value is true when the elements reached by Iterator are stored
+next to each other in memory : raw pointers and vectorIterator. An algorithm can then work on
+[to_address(first), to_address(first) + (last - first)) with pointers instead of iterators.
+
+Like is_integral, it uses template specialization : an iterator type which is not specialized is
+not contiguous. to_address never dereferences the iterator : it can be given an end iterator. */
+
+namespace ft
+{
+	template <class Iterator>
+	struct is_contiguous_iterator
+	{
+		static const bool value = false;
+	};
+
+	template <class T>
+	struct is_contiguous_iterator<T*>
+	{
+		static const bool value = true;
+	};
+
+	template <class T, bool IsConst>
+	struct is_contiguous_iterator<ft::vectorIterator<T, IsConst> >
+	{
+		static const bool value = true;
+	};
+
+	/* address of the element an iterator points to */
+	template <class T>
+	T	*to_address(T *ptr)
+	{
+		return (ptr);
+	}
+
+	template <class T, bool IsConst>
+	typename ft::vectorIterator<T, IsConst>::pointer	to_address(const ft::vectorIterator<T, IsConst> &it)
+	{
+		return (it.base());
+	}
+}
+
+#endif
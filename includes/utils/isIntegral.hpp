@@ -6,14 +6,13 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/03 15:46:33 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/11/03 15:46:34 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:32:13 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef IS_INTEGRAL_HPP
 # define IS_INTEGRAL_HPP
 
-#include "../test_includes.hpp"
 #include <stdint.h> // this header sotres somes types such as char16_t and char32_t
 
 /* "Integral" refers to integer types (i.e. whole numbers). 
@@ -83,6 +82,42 @@ namespace ft
 	{
 		static const bool value = true;
 	};
+
+	template<>
+	struct is_integral<signed char>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_integral<unsigned char>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_integral<unsigned short>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_integral<unsigned int>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_integral<unsigned long>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_integral<unsigned long long>
+	{
+		static const bool value = true;
+	};
 }
 
 #endif
@@ -6,15 +6,13 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/03 15:46:29 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/16 13:38:41 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:32:13 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef PAIR_HPP
 # define PAIR_HPP
 
-#include "../test_includes.hpp"
-
 namespace ft
 {
 	/* pair struct */
@@ -28,13 +26,16 @@ namespace ft
 		pair(const T1& a, const T2& b) : first(a), second(b) {};
 
 		/* copy constructor */
+		pair(const pair& pr) : first(pr.first), second(pr.second) {};
+
+		/* conversion from a pair of other types */
 		template<class U, class V>
 		pair(const pair<U, V>& pr) : first(pr.first), second(pr.second) {};
 
 		/* overloading operator = */
 		pair&	operator=(const pair& pr)
 		{
-			if (this != pr)
+			if (this != &pr)
 			{
 				first = pr.first;
 				second = pr.second;
@@ -47,6 +48,43 @@ namespace ft
 		T2		second;
 	};
 
+	/* relational operators : first is compared, then second */
+	template <class T1, class T2>
+	bool	operator==(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+	{
+		return (lhs.first == rhs.first && lhs.second == rhs.second);
+	}
+
+	template <class T1, class T2>
+	bool	operator!=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T1, class T2>
+	bool	operator<(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+	{
+		return (lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second));
+	}
+
+	template <class T1, class T2>
+	bool	operator<=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class T1, class T2>
+	bool	operator>(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class T1, class T2>
+	bool	operator>=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
 	/* make_pair : call pair constructor and return a pair object */
 	template <class T1,class T2>
 	pair<T1, T2>	make_pair(T1 x, T2 y)
@@ -0,0 +1,389 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:12:08 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:26:09 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARALLEL_HPP
+# define PARALLEL_HPP
+
+#include "./threadPool.hpp"
+#include "./iteratorTraits.hpp"
+#include "./sort.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <cstddef>
+
+/*
+
+	SYNOPSIS : parallel algorithms over random access ranges (ft::vector iterators, pointers), run on a
+	ft::thread_pool. grain is the number of elements below which a range is not split anymore.
+
+	=>	void		parallel_for(thread_pool &pool, RandomIt first, RandomIt last, Function f [, grain]);
+	=>	OutputIt	parallel_transform(thread_pool &pool, RandomIt first, RandomIt last, OutputIt d_first,
+					UnaryOp op [, grain]);
+	=>	T			parallel_reduce(thread_pool &pool, RandomIt first, RandomIt last, T init, BinaryOp op
+					[, grain]);
+	=>	OutputIt	parallel_inclusive_scan(thread_pool &pool, RandomIt first, RandomIt last, OutputIt d_first,
+					BinaryOp op [, grain]);
+	=>	void		parallel_sort(thread_pool &pool, RandomIt first, RandomIt last);
+	=>	void		parallel_sort(thread_pool &pool, RandomIt first, RandomIt last, Compare comp [, grain]);
+
+	f and op are shared by the threads : they must not modify a state of their own.
+
+	parallel_reduce and parallel_inclusive_scan cut the range in chunks of grain elements, whatever the
+	number of threads. Each chunk is reduced from its first element, then the partial results are
+	combined from left to right, starting with init. op only needs to be associative (not commutative),
+	and the result does not depend on the number of threads nor on the scheduling : with the same grain,
+	a reduction of floats gives the same value on 1 or 64 threads (but maybe not the value of a sequential
+	left fold). The scan makes the sums of the chunks, scans them on the calling thread, then scans every
+	chunk again from the sum of the chunks before it. d_first can be first.
+
+	parallel_sort sorts the chunks of grain elements with ft::sort (the default order gets the radix sort),
+	then merges the sorted runs two by two, in passes between the range and a buffer. The output of a pass
+	is cut in chunks of grain elements, and the first element of each chunk in both runs is found by a
+	binary search on the diagonal (merge path) : all the threads merge, even on the last pass. Equivalent
+	elements keep the order they had after the sort of their chunk : parallel_sort is not stable.
+*/
+
+namespace ft
+{
+	/* big enough to pay for a task (a few microseconds), small enough to balance on many cores */
+	static const std::size_t	parallel_grain = 16384;
+
+	/* PARALLEL FOR / TRANSFORM */
+
+	template <class RandomIt, class Function>
+	struct parallel_for_job
+	{
+		RandomIt		first;
+		Function		*f;
+
+		static void	run(void *context, std::size_t begin, std::size_t end)
+		{
+			parallel_for_job	*job = static_cast<parallel_for_job *>(context);
+			RandomIt			last = job->first + end;
+
+			for (RandomIt it = job->first + begin; it != last; ++it)
+				(*job->f)(*it);
+		}
+	};
+
+	template <class RandomIt, class Function>
+	void	parallel_for(ft::thread_pool &pool, RandomIt first, RandomIt last, Function f,
+		std::size_t grain = ft::parallel_grain)
+	{
+		parallel_for_job<RandomIt, Function>	job;
+
+		job.first = first;
+		job.f = &f;
+		pool.run(last - first, grain, &parallel_for_job<RandomIt, Function>::run, &job);
+	}
+
+	template <class RandomIt, class OutputIt, class UnaryOp>
+	struct parallel_transform_job
+	{
+		RandomIt		first;
+		OutputIt		d_first;
+		UnaryOp			*op;
+
+		static void	run(void *context, std::size_t begin, std::size_t end)
+		{
+			parallel_transform_job	*job = static_cast<parallel_transform_job *>(context);
+
+			std::transform(job->first + begin, job->first + end, job->d_first + begin, *job->op);
+		}
+	};
+
+	template <class RandomIt, class OutputIt, class UnaryOp>
+	OutputIt	parallel_transform(ft::thread_pool &pool, RandomIt first, RandomIt last, OutputIt d_first,
+		UnaryOp op, std::size_t grain = ft::parallel_grain)
+	{
+		parallel_transform_job<RandomIt, OutputIt, UnaryOp>		job;
+
+		job.first = first;
+		job.d_first = d_first;
+		job.op = &op;
+		pool.run(last - first, grain, &parallel_transform_job<RandomIt, OutputIt, UnaryOp>::run, &job);
+		return (d_first + (last - first));
+	}
+
+	/* PARALLEL REDUCE / SCAN */
+
+	/* sums[c] = op reduction of chunk c. The pool splits the chunk numbers, never a chunk */
+	template <class RandomIt, class T, class BinaryOp>
+	struct parallel_chunk_sums_job
+	{
+		RandomIt			first;
+		std::size_t			n;
+		std::size_t			grain;
+		BinaryOp			*op;
+		std::vector<T>		*sums;
+
+		static void	run(void *context, std::size_t begin, std::size_t end)
+		{
+			parallel_chunk_sums_job		*job = static_cast<parallel_chunk_sums_job *>(context);
+
+			for (std::size_t c = begin; c < end; c++)
+			{
+				RandomIt	it = job->first + c * job->grain;
+				RandomIt	last = job->first + std::min(job->n, (c + 1) * job->grain);
+				T			sum = *it;
+
+				while (++it != last)
+					sum = (*job->op)(sum, *it);
+				(*job->sums)[c] = sum;
+			}
+		}
+	};
+
+	template <class RandomIt, class T, class BinaryOp>
+	T	parallel_reduce(ft::thread_pool &pool, RandomIt first, RandomIt last, T init, BinaryOp op,
+		std::size_t grain = ft::parallel_grain)
+	{
+		parallel_chunk_sums_job<RandomIt, T, BinaryOp>		job;
+		std::size_t											n = last - first;
+		std::size_t											chunks;
+
+		if (grain == 0)
+			grain = 1;
+		chunks = (n + grain - 1) / grain;
+		std::vector<T>		sums(chunks, init);
+
+		job.first = first;
+		job.n = n;
+		job.grain = grain;
+		job.op = &op;
+		job.sums = &sums;
+		pool.run(chunks, 1, &parallel_chunk_sums_job<RandomIt, T, BinaryOp>::run, &job);
+		for (std::size_t c = 0; c < chunks; c++)
+			init = op(init, sums[c]);
+		return (init);
+	}
+
+	/* scans chunk c from carries[c], the reduction of the chunks before it (nothing for the first one) */
+	template <class RandomIt, class OutputIt, class T, class BinaryOp>
+	struct parallel_scan_job
+	{
+		RandomIt			first;
+		OutputIt			d_first;
+		std::size_t			n;
+		std::size_t			grain;
+		BinaryOp			*op;
+		std::vector<T>		*carries;
+
+		static void	run(void *context, std::size_t begin, std::size_t end)
+		{
+			parallel_scan_job	*job = static_cast<parallel_scan_job *>(context);
+
+			for (std::size_t c = begin; c < end; c++)
+			{
+				RandomIt	it = job->first + c * job->grain;
+				RandomIt	last = job->first + std::min(job->n, (c + 1) * job->grain);
+				OutputIt	out = job->d_first + c * job->grain;
+				T			sum = (c == 0 ? T(*it) : (*job->op)((*job->carries)[c], *it));
+
+				*out = sum;
+				while (++it != last)
+				{
+					sum = (*job->op)(sum, *it);
+					*++out = sum;
+				}
+			}
+		}
+	};
+
+	template <class RandomIt, class OutputIt, class BinaryOp>
+	OutputIt	parallel_inclusive_scan(ft::thread_pool &pool, RandomIt first, RandomIt last, OutputIt d_first,
+		BinaryOp op, std::size_t grain = ft::parallel_grain)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type		value_type;
+
+		parallel_chunk_sums_job<RandomIt, value_type, BinaryOp>				sums_job;
+		parallel_scan_job<RandomIt, OutputIt, value_type, BinaryOp>			scan_job;
+		std::size_t															n = last - first;
+		std::size_t															chunks;
+
+		if (n == 0)
+			return (d_first);
+		if (grain == 0)
+			grain = 1;
+		chunks = (n + grain - 1) / grain;
+		std::vector<value_type>		sums(chunks, *first);
+
+		sums_job.first = first;
+		sums_job.n = n;
+		sums_job.grain = grain;
+		sums_job.op = &op;
+		sums_job.sums = &sums;
+		if (chunks > 1) // the last chunk needs no sum
+			pool.run(chunks - 1, 1, &parallel_chunk_sums_job<RandomIt, value_type, BinaryOp>::run, &sums_job);
+		for (std::size_t c = 2; c < chunks; c++) // sums[c] becomes the carry of chunk c
+			sums[c - 1] = op(sums[c - 2], sums[c - 1]);
+		for (std::size_t c = chunks - 1; c > 0; c--)
+			sums[c] = sums[c - 1];
+		scan_job.first = first;
+		scan_job.d_first = d_first;
+		scan_job.n = n;
+		scan_job.grain = grain;
+		scan_job.op = &op;
+		scan_job.carries = &sums;
+		pool.run(chunks, 1, &parallel_scan_job<RandomIt, OutputIt, value_type, BinaryOp>::run, &scan_job);
+		return (d_first + n);
+	}
+
+	/* PARALLEL SORT */
+
+	template <class RandomIt, class Compare>
+	void	parallel_sort_chunk(RandomIt first, RandomIt last, Compare comp)
+	{
+		ft::sort(first, last, comp);
+	}
+
+	/* the default order keeps the radix sort of ft::sort */
+	template <class RandomIt, class T>
+	void	parallel_sort_chunk(RandomIt first, RandomIt last, std::less<T>)
+	{
+		ft::sort(first, last);
+	}
+
+	template <class RandomIt, class Compare>
+	struct parallel_sort_chunks_job
+	{
+		RandomIt		first;
+		std::size_t		n;
+		std::size_t		grain;
+		Compare			*comp;
+
+		static void	run(void *context, std::size_t begin, std::size_t end)
+		{
+			parallel_sort_chunks_job	*job = static_cast<parallel_sort_chunks_job *>(context);
+
+			for (std::size_t c = begin; c < end; c++)
+				ft::parallel_sort_chunk(job->first + c * job->grain,
+					job->first + std::min(job->n, (c + 1) * job->grain), *job->comp);
+		}
+	};
+
+	/* number of elements of a in the first k elements of the merge of a and b (na + nb >= k). On equivalent
+	elements, those of a go first */
+	template <class RandomIt, class Compare>
+	std::size_t	merge_path(RandomIt a, std::size_t na, RandomIt b, std::size_t nb, std::size_t k, Compare comp)
+	{
+		std::size_t		lo = (k > nb ? k - nb : 0);
+		std::size_t		hi = std::min(k, na);
+
+		while (lo < hi)
+		{
+			std::size_t		i = lo + (hi - lo) / 2;
+			std::size_t		j = k - i;
+
+			if (j > 0 && !comp(b[j - 1], a[i])) // a[i] goes before b[j - 1] : take more of a
+				lo = i + 1;
+			else
+				hi = i;
+		}
+		return (lo);
+	}
+
+	/* one merge pass of the runs of width elements from src to dst, cut in chunks of grain outputs. width
+	is a multiple of grain : a chunk never straddles two pairs of runs */
+	template <class SrcIt, class DstIt, class Compare>
+	struct parallel_merge_job
+	{
+		SrcIt			src;
+		DstIt			dst;
+		std::size_t		n;
+		std::size_t		width;
+		std::size_t		grain;
+		Compare			*comp;
+
+		static void	run(void *context, std::size_t begin, std::size_t end)
+		{
+			parallel_merge_job	*job = static_cast<parallel_merge_job *>(context);
+
+			for (std::size_t c = begin; c < end; c++)
+			{
+				std::size_t		out = c * job->grain;
+				std::size_t		out_end = std::min(job->n, out + job->grain);
+				std::size_t		pair = out - out % (2 * job->width);
+				std::size_t		mid = std::min(job->n, pair + job->width);
+				std::size_t		na = mid - pair;
+				std::size_t		nb = std::min(job->n, pair + 2 * job->width) - mid;
+				SrcIt			a = job->src + pair;
+				SrcIt			b = job->src + mid;
+				std::size_t		i = ft::merge_path(a, na, b, nb, out - pair, *job->comp);
+				std::size_t		i_end = ft::merge_path(a, na, b, nb, out_end - pair, *job->comp);
+
+				std::merge(a + i, a + i_end, b + (out - pair - i), b + (out_end - pair - i_end),
+					job->dst + out, *job->comp);
+			}
+		}
+	};
+
+	template <class SrcIt, class DstIt, class Compare>
+	void	parallel_merge_pass(ft::thread_pool &pool, SrcIt src, DstIt dst, std::size_t n, std::size_t width,
+		std::size_t grain, Compare &comp)
+	{
+		parallel_merge_job<SrcIt, DstIt, Compare>	job;
+
+		job.src = src;
+		job.dst = dst;
+		job.n = n;
+		job.width = width;
+		job.grain = grain;
+		job.comp = &comp;
+		pool.run((n + grain - 1) / grain, 1, &parallel_merge_job<SrcIt, DstIt, Compare>::run, &job);
+	}
+
+	template <class RandomIt, class Compare>
+	void	parallel_sort(ft::thread_pool &pool, RandomIt first, RandomIt last, Compare comp,
+		std::size_t grain = ft::parallel_grain)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type		value_type;
+
+		parallel_sort_chunks_job<RandomIt, Compare>		job;
+		std::size_t										n = last - first;
+		std::vector<value_type>							buf;
+		bool											in_range = true;
+
+		if (grain == 0)
+			grain = 1;
+		if (n <= grain || pool.size() == 1)
+		{
+			ft::parallel_sort_chunk(first, last, comp);
+			return ;
+		}
+		job.first = first;
+		job.n = n;
+		job.grain = grain;
+		job.comp = &comp;
+		pool.run((n + grain - 1) / grain, 1, &parallel_sort_chunks_job<RandomIt, Compare>::run, &job);
+		buf.assign(first, last);
+		for (std::size_t width = grain; width < n; width *= 2)
+		{
+			if (in_range)
+				ft::parallel_merge_pass(pool, first, buf.begin(), n, width, grain, comp);
+			else
+				ft::parallel_merge_pass(pool, buf.begin(), first, n, width, grain, comp);
+			in_range = !in_range;
+		}
+		if (in_range == false) // a pass of one run copies it back
+			ft::parallel_merge_pass(pool, buf.begin(), first, n, n, grain, comp);
+	}
+
+	template <class RandomIt>
+	void	parallel_sort(ft::thread_pool &pool, RandomIt first, RandomIt last)
+	{
+		ft::parallel_sort(pool, first, last, std::less<typename ft::iterator_traits<RandomIt>::value_type>());
+	}
+}
+
+#endif
@@ -6,14 +6,13 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/11 11:08:56 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/14 16:45:38 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 06:32:13 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef REVERSE_ITERATOR_HPP
 # define REVERSE_ITERATOR_HPP
 
-# include "../test_includes.hpp"
 # include "iteratorTraits.hpp"
 
 /* reverse iterators are made of standard iterators. There is a relation of -1 between an iterator and its 
@@ -42,12 +41,12 @@ namespace ft
 
 			/* CONSTRUCTORS AND DESTRUCTORS */
 			
-			reverseIterator(void) : _current(nullptr) {}
+			reverseIterator(void) : _current() {}
 			
 			explicit reverseIterator(iterator_type it) : _current(it) {}
 			
 			template<class Iter>
-			reverseIterator (const reverseIterator<Iter>& rev_it) : _current(rev_it._current) {}
+			reverseIterator (const reverseIterator<Iter>& rev_it) : _current(rev_it.base()) {}
 			
 			iterator_type	base() const { return (this->_current); }
 
@@ -127,51 +126,51 @@ namespace ft
 	template <class Iterator>
 	bool	operator==(const reverseIterator<Iterator>& lhs, const reverseIterator<Iterator>& rhs) // to test
 	{
-		return (lhs._current == rhs._current); 
+		return (lhs.base() == rhs.base()); 
 	}
 
 	template <class Iterator>
 	bool	operator!=(const reverseIterator<Iterator>& lhs, const reverseIterator<Iterator>& rhs) // to test
 	{
-		return (lhs._current != rhs._current); 
+		return (lhs.base() != rhs.base()); 
 	}
 
 	template <class Iterator>
 	bool	operator<(const reverseIterator<Iterator>& lhs, const reverseIterator<Iterator>& rhs) // to test
 	{
-		return (lhs._current > rhs._current);
+		return (lhs.base() > rhs.base());
 	}
 
 	template <class Iterator>
 	bool	operator<=(const reverseIterator<Iterator>& lhs, const reverseIterator<Iterator>& rhs) // to test
 	{
-		return (lhs._current >= rhs._current);
+		return (lhs.base() >= rhs.base());
 	}
 
 	template <class Iterator>
 	bool	operator>(const reverseIterator<Iterator>& lhs, const reverseIterator<Iterator>& rhs) // to test
 	{
-		return (lhs._current < rhs._current);
+		return (lhs.base() < rhs.base());
 	}
 
 	template <class Iterator>
 	bool	operator>=(const reverseIterator<Iterator>& lhs, const reverseIterator<Iterator>& rhs) // to test
 	{
-		return (lhs._current <= rhs._current);
+		return (lhs.base() <= rhs.base());
 	}
 
 	template <class Iterator>
 	reverseIterator<Iterator>	operator+(typename reverseIterator<Iterator>::difference_type n, // to test
 			const reverseIterator<Iterator>& rev_it)
 	{
-		return (rev_it->_current - n);
+		return (reverseIterator<Iterator>(rev_it.base() - n));
 	}
 
 	template <class Iterator>
 	typename reverseIterator<Iterator>::difference_type	operator-(const reverseIterator<Iterator>& lhs, // to test
 			const reverseIterator<Iterator>& rhs)
 	{
-		return (lhs.base() - rhs.base());
+		return (rhs.base() - lhs.base());
 	}
 }
 
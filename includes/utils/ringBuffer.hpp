@@ -0,0 +1,371 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ringBuffer.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:50:45 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 06:03:10 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RING_BUFFER_HPP
+# define RING_BUFFER_HPP
+
+# include <memory>
+# include <cstddef>
+# include <stdexcept>
+# include <sched.h>
+
+/*
+
+	SYNOPSIS : bounded lock-free FIFO queues between threads, over a ring of capacity slots (the
+	capacity asked, rounded up to a power of two : a slot is an index & mask).
+
+	=>	spsc_ring<T, Alloc>	: one producer thread, one consumer thread.
+	=>	mpmc_ring<T, Alloc>	: any number of producers and consumers.
+
+	=>	bool		try_push(const T& val);			// false if the ring is full
+	=>	bool		try_pop(T& out);				// false if the ring is empty
+	=>	size_type	try_push_n(InputIt first, size_type n);	// pushes the first elements that fit, returns
+	=>	size_type	try_pop_n(OutputIt out, size_type n);		// their number (0 if full / empty)
+	=>	void		push(const T& val);	void	pop(T& out);	// spin (sched_yield) until it is done
+	=>	size_type	size(void) const;	bool	empty(void) const;	size_type	capacity(void) const;
+
+	The elements are built in raw slots allocated by Alloc, as in ft::vector. size and empty are
+	exact only when no other thread works on the ring. The destructor destroys the elements left.
+
+	spsc_ring : the producer owns tail, the consumer owns head, on two different cache lines. Each side
+	keeps a copy of the index of the other one and reads the shared index only when its copy says the
+	ring is full (or empty) : most operations touch no line written by the other thread. A batch reads
+	the other index once and publishes its own once, with release ordering after the elements.
+
+	mpmc_ring : Vyukov's bounded queue. Each slot has a sequence number telling the lap of the producer
+	or consumer expected there. A producer claims the slot at enqueue with a CAS on enqueue, builds the
+	element and releases the slot by setting its sequence (the consumers wait for it there, not on the
+	index). A batch claims every consecutive ready slot with a single CAS.
+*/
+
+namespace ft
+{
+	/* capacity rounded up to a power of two, 2 at least */
+	inline std::size_t	ring_capacity(std::size_t capacity, std::size_t max_size)
+	{
+		std::size_t		rounded = 2;
+
+		while (rounded < capacity && rounded <= max_size / 2)
+			rounded *= 2;
+		if (rounded < capacity)
+			throw std::length_error("ring");
+		return (rounded);
+	}
+
+	/* SINGLE PRODUCER, SINGLE CONSUMER */
+
+	template <class T, class Alloc = std::allocator<T> >
+	class spsc_ring
+	{
+		/* ALIASES */
+		public:
+
+			typedef T											value_type;
+			typedef Alloc										allocator_type;
+			typedef typename Alloc::pointer						pointer;
+			typedef std::size_t									size_type;
+
+		/* CONSTRUCTOR, DESTRUCTOR (no copy) */
+
+			explicit spsc_ring(size_type capacity, const allocator_type& alloc = allocator_type()) : _alloc(alloc)
+			{
+				size_type	rounded = ft::ring_capacity(capacity, this->_alloc.max_size());
+
+				this->_slots = this->_alloc.allocate(rounded);
+				this->_mask = rounded - 1;
+				this->_producer.tail = 0;
+				this->_producer.head = 0;
+				this->_consumer.head = 0;
+				this->_consumer.tail = 0;
+			}
+
+			virtual ~spsc_ring()
+			{
+				for (size_type i = this->_consumer.head; i != this->_producer.tail; i++)
+					this->_alloc.destroy(this->_slots + (i & this->_mask));
+				this->_alloc.deallocate(this->_slots, this->_mask + 1);
+			}
+
+		/* CAPACITY */
+
+			size_type	capacity(void) const { return (this->_mask + 1); };
+
+			size_type	size(void) const
+			{
+				return (__atomic_load_n(&this->_producer.tail, __ATOMIC_ACQUIRE)
+					- __atomic_load_n(&this->_consumer.head, __ATOMIC_ACQUIRE));
+			}
+
+			bool		empty(void) const { return (this->size() == 0); };
+
+		/* PRODUCER */
+
+			bool	try_push(const value_type& val)
+			{
+				return (this->try_push_n(&val, 1) == 1);
+			}
+
+			template <class InputIterator>
+			size_type	try_push_n(InputIterator first, size_type n)
+			{
+				size_type	tail = this->_producer.tail;
+				size_type	room = this->_mask + 1 - (tail - this->_producer.head);
+
+				if (room < n) // the copy of head may be old
+				{
+					this->_producer.head = __atomic_load_n(&this->_consumer.head, __ATOMIC_ACQUIRE);
+					room = this->_mask + 1 - (tail - this->_producer.head);
+				}
+				if (n > room)
+					n = room;
+				for (size_type i = 0; i < n; i++, ++first)
+					this->_alloc.construct(this->_slots + ((tail + i) & this->_mask), *first);
+				if (n > 0)
+					__atomic_store_n(&this->_producer.tail, tail + n, __ATOMIC_RELEASE);
+				return (n);
+			}
+
+			void	push(const value_type& val)
+			{
+				while (this->try_push(val) == false)
+					sched_yield();
+			}
+
+		/* CONSUMER */
+
+			bool	try_pop(value_type& out)
+			{
+				return (this->try_pop_n(&out, 1) == 1);
+			}
+
+			template <class OutputIterator>
+			size_type	try_pop_n(OutputIterator out, size_type n)
+			{
+				size_type	head = this->_consumer.head;
+				size_type	ready = this->_consumer.tail - head;
+				pointer		slot;
+
+				if (ready < n)
+				{
+					this->_consumer.tail = __atomic_load_n(&this->_producer.tail, __ATOMIC_ACQUIRE);
+					ready = this->_consumer.tail - head;
+				}
+				if (n > ready)
+					n = ready;
+				for (size_type i = 0; i < n; i++, ++out)
+				{
+					slot = this->_slots + ((head + i) & this->_mask);
+					*out = *slot;
+					this->_alloc.destroy(slot);
+				}
+				if (n > 0)
+					__atomic_store_n(&this->_consumer.head, head + n, __ATOMIC_RELEASE);
+				return (n);
+			}
+
+			void	pop(value_type& out)
+			{
+				while (this->try_pop(out) == false)
+					sched_yield();
+			}
+
+		private: // private member data
+
+			spsc_ring(const spsc_ring &original);
+			spsc_ring&	operator=(const spsc_ring &original);
+
+			/* the line of each thread : its index, and its copy of the index of the other one */
+			struct	_producer_line
+			{
+				size_type	tail;
+				size_type	head;
+			} __attribute__((aligned(64)));
+
+			struct	_consumer_line
+			{
+				size_type	head;
+				size_type	tail;
+			} __attribute__((aligned(64)));
+
+			allocator_type		_alloc;
+			pointer				_slots;
+			size_type			_mask;
+			_producer_line		_producer;
+			_consumer_line		_consumer;
+	};
+
+	/* MULTIPLE PRODUCERS, MULTIPLE CONSUMERS */
+
+	template <class T, class Alloc = std::allocator<T> >
+	class mpmc_ring
+	{
+		/* ALIASES */
+		public:
+
+			typedef T											value_type;
+			typedef Alloc										allocator_type;
+			typedef typename Alloc::pointer						pointer;
+			typedef std::size_t									size_type;
+			typedef typename Alloc::template rebind<size_type>::other		sequence_allocator_type;
+
+		/* CONSTRUCTOR, DESTRUCTOR (no copy) */
+
+			explicit mpmc_ring(size_type capacity, const allocator_type& alloc = allocator_type()) : _alloc(alloc),
+			_seq_alloc(alloc)
+			{
+				size_type	rounded = ft::ring_capacity(capacity, this->_alloc.max_size());
+
+				this->_slots = this->_alloc.allocate(rounded);
+				this->_seq = this->_seq_alloc.allocate(rounded);
+				for (size_type i = 0; i < rounded; i++)
+					this->_seq[i] = i;
+				this->_mask = rounded - 1;
+				this->_enqueue.pos = 0;
+				this->_dequeue.pos = 0;
+			}
+
+			virtual ~mpmc_ring()
+			{
+				for (size_type i = this->_dequeue.pos; i != this->_enqueue.pos; i++)
+					this->_alloc.destroy(this->_slots + (i & this->_mask));
+				this->_alloc.deallocate(this->_slots, this->_mask + 1);
+				this->_seq_alloc.deallocate(this->_seq, this->_mask + 1);
+			}
+
+		/* CAPACITY */
+
+			size_type	capacity(void) const { return (this->_mask + 1); };
+
+			size_type	size(void) const
+			{
+				size_type	dequeue = __atomic_load_n(&this->_dequeue.pos, __ATOMIC_ACQUIRE);
+				size_type	enqueue = __atomic_load_n(&this->_enqueue.pos, __ATOMIC_ACQUIRE);
+
+				return (enqueue > dequeue ? enqueue - dequeue : 0);
+			}
+
+			bool		empty(void) const { return (this->size() == 0); };
+
+		/* PRODUCERS */
+
+			bool	try_push(const value_type& val)
+			{
+				return (this->try_push_n(&val, 1) == 1);
+			}
+
+			/* the slot pos + i is free for this lap when its sequence is pos + i */
+			template <class InputIterator>
+			size_type	try_push_n(InputIterator first, size_type n)
+			{
+				size_type	pos = __atomic_load_n(&this->_enqueue.pos, __ATOMIC_RELAXED);
+				size_type	count = this->_claim(this->_enqueue.pos, pos, n, 0);
+
+				for (size_type i = 0; i < count; i++, ++first)
+				{
+					this->_alloc.construct(this->_slots + ((pos + i) & this->_mask), *first);
+					__atomic_store_n(this->_seq + ((pos + i) & this->_mask), pos + i + 1, __ATOMIC_RELEASE);
+				}
+				return (count);
+			}
+
+			void	push(const value_type& val)
+			{
+				while (this->try_push(val) == false)
+					sched_yield();
+			}
+
+		/* CONSUMERS */
+
+			bool	try_pop(value_type& out)
+			{
+				return (this->try_pop_n(&out, 1) == 1);
+			}
+
+			/* the slot pos + i holds an element of this lap when its sequence is pos + i + 1. Once read, the
+			slot is given to the producers of the next lap */
+			template <class OutputIterator>
+			size_type	try_pop_n(OutputIterator out, size_type n)
+			{
+				size_type	pos = __atomic_load_n(&this->_dequeue.pos, __ATOMIC_RELAXED);
+				size_type	count = this->_claim(this->_dequeue.pos, pos, n, 1);
+				pointer		slot;
+
+				for (size_type i = 0; i < count; i++, ++out)
+				{
+					slot = this->_slots + ((pos + i) & this->_mask);
+					*out = *slot;
+					this->_alloc.destroy(slot);
+					__atomic_store_n(this->_seq + ((pos + i) & this->_mask), pos + i + this->_mask + 1,
+						__ATOMIC_RELEASE);
+				}
+				return (count);
+			}
+
+			void	pop(value_type& out)
+			{
+				while (this->try_pop(out) == false)
+					sched_yield();
+			}
+
+		private: // private member data
+
+			mpmc_ring(const mpmc_ring &original);
+			mpmc_ring&	operator=(const mpmc_ring &original);
+
+			struct	_index_line
+			{
+				size_type	pos;
+			} __attribute__((aligned(64)));
+
+			allocator_type				_alloc;
+			sequence_allocator_type		_seq_alloc;
+			pointer						_slots;
+			size_type					*_seq;
+			size_type					_mask;
+			_index_line					_enqueue;
+			_index_line					_dequeue;
+
+		private: // private member methods (helpers)
+
+			/* claims up to n consecutive slots from index (pos : its value read by the caller) whose sequence is
+			their position + offset, with one CAS. Returns their number, 0 if the first one is not ready
+			(full or empty). pos is updated to the first slot claimed */
+			size_type	_claim(size_type &index, size_type &pos, size_type n, size_type offset)
+			{
+				size_type		count;
+				std::ptrdiff_t	diff;
+
+				while (n > 0)
+				{
+					diff = static_cast<std::ptrdiff_t>(__atomic_load_n(this->_seq + (pos & this->_mask),
+						__ATOMIC_ACQUIRE) - (pos + offset));
+					if (diff < 0) // the slot is still used by the previous lap
+						return (0);
+					if (diff > 0) // another thread claimed it : try again from the new index
+					{
+						pos = __atomic_load_n(&index, __ATOMIC_RELAXED);
+						continue ;
+					}
+					count = 1;
+					while (count < n && __atomic_load_n(this->_seq + ((pos + count) & this->_mask), __ATOMIC_ACQUIRE)
+						== pos + count + offset)
+						count++;
+					if (__atomic_compare_exchange_n(&index, &pos, pos + count, true, __ATOMIC_RELAXED,
+						__ATOMIC_RELAXED))
+						return (count);
+				}
+				return (0);
+			}
+	};
+}
+
+#endif
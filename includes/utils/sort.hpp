@@ -0,0 +1,466 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:05:28 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 06:27:46 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SORT_HPP
+# define SORT_HPP
+
+#include "./isIntegral.hpp"
+#include "./iteratorTraits.hpp"
+#include "./pair.hpp"
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <cstddef>
+
+/*
+
+	SYNOPSIS : sorting algorithms over random access iterators (vectorIterator, pointers, ...).
+
+	=>	void	sort(RandomIt first, RandomIt last [, Compare comp]);
+	=>	void	stable_sort(RandomIt first, RandomIt last [, Compare comp]);
+	=>	void	radix_sort(RandomIt first, RandomIt last);
+	=>	void	introsort(RandomIt first, RandomIt last, Compare comp);
+	=>	void	heap_sort(RandomIt first, RandomIt last, Compare comp);
+	=>	void	insertion_sort(RandomIt first, RandomIt last, Compare comp);
+	=>	int		presorted(RandomIt first, RandomIt last);	// 1 sorted, -1 strictly decreasing, 0 otherwise
+
+	sort with a comparator is an introsort : quicksort with a median of three pivot, switching to a heap
+	sort when the recursion gets deeper than 2 log2(n) (O(n log n) in the worst case), and leaving the
+	ranges of 16 elements or less to a final insertion sort.
+
+	Without a comparator, sort and stable_sort sort integral values with a LSD radix sort : one counting
+	pass per byte of the key, skipping the bytes shared by every key (small keys in a big type cost one
+	or two passes). sort also radix sorts the ft::pair whose first is integral, then sorts each run of
+	equal firsts by operator<. A range already sorted, or strictly decreasing, is only checked (and
+	reversed) instead. Other types, and ranges of less than radix_threshold elements, use the
+	comparison sorts. radix_sort sorts by the key alone (value or pair::first) and is stable.
+
+	stable_sort with a comparator is a merge sort with a buffer of half the range : the runs of 32
+	elements are insertion sorted, and two sorted halves already in order are not merged.
+	The radix sort and the merge sort copy elements into a std::vector : they need copyable values.
+*/
+
+namespace ft
+{
+	/* ranges shorter than that do not pay the histogram and the buffer of a radix sort */
+	static const std::size_t	radix_threshold = 256;
+
+	/* INSERTION SORT (stable) */
+
+	template <class RandomIt, class Compare>
+	void	insertion_sort(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type		value_type;
+
+		if (first == last)
+			return ;
+		for (RandomIt i = first + 1; i != last; ++i)
+		{
+			value_type		val = *i;
+			RandomIt		j = i;
+
+			if (comp(val, *first)) // goes to the front : no need to check the bound in the loop
+			{
+				std::copy_backward(first, i, i + 1);
+				*first = val;
+				continue ;
+			}
+			while (comp(val, *(j - 1)))
+			{
+				*j = *(j - 1);
+				--j;
+			}
+			*j = val;
+		}
+	}
+
+	/* HEAP SORT */
+
+	/* moves the element at hole down the max heap [first, first + len) */
+	template <class RandomIt, class Distance, class Compare>
+	void	sift_down(RandomIt first, Distance hole, Distance len, Compare comp)
+	{
+		typename ft::iterator_traits<RandomIt>::value_type		val = *(first + hole);
+		Distance												child;
+
+		while ((child = 2 * hole + 1) < len)
+		{
+			if (child + 1 < len && comp(*(first + child), *(first + child + 1)))
+				child++;
+			if (comp(val, *(first + child)) == false)
+				break ;
+			*(first + hole) = *(first + child);
+			hole = child;
+		}
+		*(first + hole) = val;
+	}
+
+	template <class RandomIt, class Compare>
+	void	heap_sort(RandomIt first, RandomIt last, Compare comp)
+	{
+		typename ft::iterator_traits<RandomIt>::difference_type		len = last - first;
+
+		for (typename ft::iterator_traits<RandomIt>::difference_type i = len / 2; i-- > 0; )
+			ft::sift_down(first, i, len, comp);
+		while (len > 1)
+		{
+			--len;
+			std::iter_swap(first, first + len);
+			ft::sift_down(first, static_cast<typename ft::iterator_traits<RandomIt>::difference_type>(0), len, comp);
+		}
+	}
+
+	/* INTROSORT */
+
+	/* puts the median of *a, *b and *c in *result */
+	template <class RandomIt, class Compare>
+	void	move_median_to_first(RandomIt result, RandomIt a, RandomIt b, RandomIt c, Compare comp)
+	{
+		if (comp(*a, *b))
+		{
+			if (comp(*b, *c))
+				std::iter_swap(result, b);
+			else if (comp(*a, *c))
+				std::iter_swap(result, c);
+			else
+				std::iter_swap(result, a);
+		}
+		else if (comp(*a, *c))
+			std::iter_swap(result, a);
+		else if (comp(*b, *c))
+			std::iter_swap(result, c);
+		else
+			std::iter_swap(result, b);
+	}
+
+	/* Hoare partition around *pivot. The median of three guarantees an element not less than the
+	pivot on the right and not greater on the left, so the scans need no bound check */
+	template <class RandomIt, class Compare>
+	RandomIt	unguarded_partition(RandomIt first, RandomIt last, RandomIt pivot, Compare comp)
+	{
+		while (true)
+		{
+			while (comp(*first, *pivot))
+				++first;
+			--last;
+			while (comp(*pivot, *last))
+				--last;
+			if (!(first < last))
+				return (first);
+			std::iter_swap(first, last);
+			++first;
+		}
+	}
+
+	/* recursion on the right part, loop on the left one. Leaves ranges of 16 elements unsorted */
+	template <class RandomIt, class Compare>
+	void	introsort_loop(RandomIt first, RandomIt last, std::size_t depth, Compare comp)
+	{
+		RandomIt	cut;
+
+		while (last - first > 16)
+		{
+			if (depth == 0)
+			{
+				ft::heap_sort(first, last, comp);
+				return ;
+			}
+			--depth;
+			ft::move_median_to_first(first, first + 1, first + (last - first) / 2, last - 1, comp);
+			cut = ft::unguarded_partition(first + 1, last, first, comp);
+			ft::introsort_loop(cut, last, depth, comp);
+			last = cut;
+		}
+	}
+
+	template <class RandomIt, class Compare>
+	void	introsort(RandomIt first, RandomIt last, Compare comp)
+	{
+		std::size_t		depth = 0;
+
+		if (last - first < 2)
+			return ;
+		for (std::size_t n = last - first; n > 1; n >>= 1)
+			depth += 2;
+		ft::introsort_loop(first, last, depth, comp);
+		ft::insertion_sort(first, last, comp);
+	}
+
+	/* MERGE SORT (stable) */
+
+	/* sorts [first, last) with buf, which can hold half of it */
+	template <class RandomIt, class Pointer, class Compare>
+	void	merge_sort_buffered(RandomIt first, RandomIt last, Pointer buf, Compare comp)
+	{
+		RandomIt	mid;
+		RandomIt	right;
+		RandomIt	out;
+		Pointer		left;
+		Pointer		left_end;
+
+		if (last - first <= 32)
+		{
+			ft::insertion_sort(first, last, comp);
+			return ;
+		}
+		mid = first + (last - first) / 2;
+		ft::merge_sort_buffered(first, mid, buf, comp);
+		ft::merge_sort_buffered(mid, last, buf, comp);
+		if (comp(*mid, *(mid - 1)) == false) // the halves are already in order
+			return ;
+		left = buf;
+		left_end = std::copy(first, mid, buf);
+		right = mid;
+		out = first;
+		while (left != left_end && right != last) // on equal elements, the left one goes first
+		{
+			if (comp(*right, *left))
+				*out++ = *right++;
+			else
+				*out++ = *left++;
+		}
+		std::copy(left, left_end, out); // what is left of the right half is already in place
+	}
+
+	/* RADIX SORT */
+
+	/* key of a value for the radix sort : the value itself for the integral types, first for a pair */
+	template <class T>
+	struct radix_traits
+	{
+		typedef T				key_type;
+		static const bool		sortable = ft::is_integral<T>::value;
+		static const bool		whole_value = true;
+
+		static key_type	key(const T &val) { return (val); }
+	};
+
+	template <class K, class V>
+	struct radix_traits<ft::pair<K, V> >
+	{
+		typedef K				key_type;
+		static const bool		sortable = ft::is_integral<K>::value;
+		static const bool		whole_value = false;
+
+		static key_type	key(const ft::pair<K, V> &val) { return (val.first); }
+	};
+
+	/* byte number pass of key. The sign bit is flipped so that the negative keys come first */
+	template <class K>
+	unsigned int	radix_digit(K key, std::size_t pass)
+	{
+		static const bool	is_signed = (K(-1) < K(1));
+		unsigned int		digit;
+
+		digit = static_cast<unsigned int>((static_cast<unsigned long long>(key) >> (8 * pass)) & 0xFF);
+		if (is_signed && pass == sizeof(K) - 1)
+			digit ^= 0x80;
+		return (digit);
+	}
+
+	/* moves every element of [src, src_end) to its bucket of dst. offsets holds the start of the buckets */
+	template <class InputIt, class OutputIt>
+	void	radix_scatter(InputIt src, InputIt src_end, OutputIt dst, std::size_t *offsets, std::size_t pass)
+	{
+		typedef typename ft::iterator_traits<InputIt>::value_type		value_type;
+
+		for (; src != src_end; ++src)
+			*(dst + offsets[ft::radix_digit(ft::radix_traits<value_type>::key(*src), pass)]++) = *src;
+	}
+
+	/* LSD radix sort by radix_traits<value_type>::key, stable. The histograms of all the bytes are made
+	in one scan, then each byte not shared by every key moves the elements between the range and a buffer */
+	template <class RandomIt>
+	void	radix_sort(RandomIt first, RandomIt last)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type		value_type;
+		typedef ft::radix_traits<value_type>							traits;
+		typedef typename traits::key_type								key_type;
+
+		const std::size_t			n = last - first;
+		std::vector<std::size_t>	counts(sizeof(key_type) * 256, 0);
+		std::vector<value_type>		buf;
+		bool						in_range = true;
+
+		if (n < 2)
+			return ;
+		for (RandomIt it = first; it != last; ++it)
+			for (std::size_t pass = 0; pass < sizeof(key_type); pass++)
+				counts[pass * 256 + ft::radix_digit(traits::key(*it), pass)]++;
+		for (std::size_t pass = 0; pass < sizeof(key_type); pass++)
+		{
+			std::size_t		*offsets = &counts[pass * 256];
+			std::size_t		sum = 0;
+
+			if (offsets[ft::radix_digit(traits::key(*first), pass)] == n) // same byte everywhere
+				continue ;
+			for (std::size_t d = 0; d < 256; d++)
+			{
+				std::size_t		count = offsets[d];
+
+				offsets[d] = sum;
+				sum += count;
+			}
+			if (buf.empty())
+				buf.assign(first, last);
+			if (in_range)
+				ft::radix_scatter(first, last, buf.begin(), offsets, pass);
+			else
+				ft::radix_scatter(buf.begin(), buf.end(), first, offsets, pass);
+			in_range = !in_range;
+		}
+		if (in_range == false)
+			std::copy(buf.begin(), buf.end(), first);
+	}
+
+	/* DISPATCH */
+
+	template <bool Radix>
+	struct radix_tag {};
+
+	/* 1 if [first, last) is already sorted, -1 if it is strictly decreasing, 0 otherwise. Stops at the
+	first element out of both orders, so a shuffled range costs a few comparisons */
+	template <class RandomIt>
+	int		presorted(RandomIt first, RandomIt last)
+	{
+		RandomIt	it = first;
+		bool		ascending = true;
+		bool		descending = true;
+
+		if (last - first < 2)
+			return (1);
+		while (++it != last && (ascending || descending))
+		{
+			if (*it < *(it - 1))
+				ascending = false;
+			else
+				descending = false;
+		}
+		if (ascending || descending)
+			return (ascending ? 1 : -1);
+		return (0);
+	}
+
+	template <class RandomIt>
+	void	sort_default(RandomIt first, RandomIt last, radix_tag<false>)
+	{
+		ft::introsort(first, last, std::less<typename ft::iterator_traits<RandomIt>::value_type>());
+	}
+
+	/* the radix sort orders the pairs by first only : the runs of equal firsts are then sorted */
+	template <class RandomIt>
+	void	sort_default(RandomIt first, RandomIt last, radix_tag<true>)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type		value_type;
+		typedef ft::radix_traits<value_type>							traits;
+
+		RandomIt	run;
+		int			order;
+
+		if (static_cast<std::size_t>(last - first) < ft::radix_threshold)
+		{
+			ft::introsort(first, last, std::less<value_type>());
+			return ;
+		}
+		order = ft::presorted(first, last);
+		if (order != 0) // the radix sort would move every element for nothing
+		{
+			if (order < 0)
+				std::reverse(first, last);
+			return ;
+		}
+		ft::radix_sort(first, last);
+		if (traits::whole_value)
+			return ;
+		while (first != last)
+		{
+			run = first + 1;
+			while (run != last && !(traits::key(*first) < traits::key(*run)))
+				++run;
+			if (run - first > 1)
+				ft::introsort(first, run, std::less<value_type>());
+			first = run;
+		}
+	}
+
+	template <class RandomIt, class Compare>
+	void	stable_sort_comp(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type		value_type;
+
+		if (last - first <= 32)
+			ft::insertion_sort(first, last, comp);
+		else
+		{
+			std::vector<value_type>		buf(first, first + (last - first) / 2);
+
+			ft::merge_sort_buffered(first, last, &buf[0], comp);
+		}
+	}
+
+	template <class RandomIt>
+	void	stable_sort_default(RandomIt first, RandomIt last, radix_tag<false>)
+	{
+		ft::stable_sort_comp(first, last, std::less<typename ft::iterator_traits<RandomIt>::value_type>());
+	}
+
+	template <class RandomIt>
+	void	stable_sort_default(RandomIt first, RandomIt last, radix_tag<true>)
+	{
+		int		order;
+
+		if (static_cast<std::size_t>(last - first) < ft::radix_threshold)
+		{
+			ft::insertion_sort(first, last, std::less<typename ft::iterator_traits<RandomIt>::value_type>());
+			return ;
+		}
+		order = ft::presorted(first, last);
+		if (order < 0) // strictly decreasing : no equal values to keep in order
+			std::reverse(first, last);
+		else if (order == 0)
+			ft::radix_sort(first, last);
+	}
+
+	/* SORT AND STABLE SORT */
+
+	template <class RandomIt>
+	void	sort(RandomIt first, RandomIt last)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type		value_type;
+
+		ft::sort_default(first, last, radix_tag<ft::radix_traits<value_type>::sortable>());
+	}
+
+	template <class RandomIt, class Compare>
+	void	sort(RandomIt first, RandomIt last, Compare comp)
+	{
+		ft::introsort(first, last, comp);
+	}
+
+	/* only the integral values are radix sorted : stable for pairs means stable for equal pairs too */
+	template <class RandomIt>
+	void	stable_sort(RandomIt first, RandomIt last)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type		value_type;
+		typedef ft::radix_traits<value_type>							traits;
+
+		ft::stable_sort_default(first, last, radix_tag<traits::sortable && traits::whole_value>());
+	}
+
+	template <class RandomIt, class Compare>
+	void	stable_sort(RandomIt first, RandomIt last, Compare comp)
+	{
+		ft::stable_sort_comp(first, last, comp);
+	}
+}
+
+#endif
@@ -0,0 +1,346 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   threadPool.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:10:18 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 08:52:36 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef THREAD_POOL_HPP
+# define THREAD_POOL_HPP
+
+# include <deque>
+# include <vector>
+# include <new>
+# include <cstddef>
+# include <cstdlib>
+# include <stdexcept>
+# include <pthread.h>
+# include <sched.h>
+# include <unistd.h>
+
+/*
+
+	SYNOPSIS : thread_pool runs a function over the indexes [0, n) with several threads (work stealing).
+
+	=>	thread_pool(std::size_t threads = 0);	// 0 : one thread per online CPU. The calling thread
+												// counts as one of them : threads - 1 are started
+	=>	std::size_t	size(void) const;
+	=>	void		run(std::size_t n, std::size_t grain, range_function f, void *context);
+	=>	std::size_t	steals(void) const;			// tasks taken from another worker since the construction
+
+	run calls f(context, begin, end) on ranges of at most grain indexes covering [0, n) exactly once,
+	and returns when all of them are done. The calling thread works too.
+
+	Every worker owns a deque of ranges. A worker takes the last range it pushed, and halves it while
+	it is bigger than grain : it keeps the left half and pushes the right one. An idle worker steals
+	the oldest range of another worker (the biggest one), picked at random. So the work is only split
+	as much as needed to keep every thread busy.
+
+	A range function must not call run on the same pool. If one of them throws, the others still run,
+	and run throws std::runtime_error once the whole range is done. The deques are locked by a mutex
+	each : the lock is only contended when a range is stolen.
+*/
+
+namespace ft
+{
+	class thread_pool
+	{
+		public:
+
+			typedef void	(*range_function)(void *context, std::size_t begin, std::size_t end);
+
+		/* CONSTRUCTOR, DESTRUCTOR (no copy) */
+
+			explicit	thread_pool(std::size_t threads = 0) : _generation(0), _stop(0), _function(nullptr),
+			_context(nullptr), _grain(1), _remaining(0), _failed(0), _steals(0)
+			{
+				if (threads == 0)
+				{
+					long	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+					threads = (cpus > 0 ? static_cast<std::size_t>(cpus) : 1);
+				}
+				if (pthread_mutex_init(&this->_lock, nullptr) != 0)
+					throw std::runtime_error("thread_pool");
+				if (pthread_cond_init(&this->_wake, nullptr) != 0)
+				{
+					pthread_mutex_destroy(&this->_lock);
+					throw std::runtime_error("thread_pool");
+				}
+				if (pthread_mutex_init(&this->_submit, nullptr) != 0)
+				{
+					pthread_cond_destroy(&this->_wake);
+					pthread_mutex_destroy(&this->_lock);
+					throw std::runtime_error("thread_pool");
+				}
+				try
+				{
+					this->_workers.reserve(threads); // push_back cannot throw after a worker is allocated
+					for (std::size_t i = 0; i < threads; i++)
+					{
+						this->_workers.push_back(this->_newWorker(i));
+						if (i > 0 && pthread_create(&this->_workers[i]->thread, nullptr, &thread_pool::_main,
+							this->_workers[i]) != 0)
+						{
+							_deleteWorker(this->_workers.back());
+							this->_workers.pop_back();
+							throw std::runtime_error("thread_pool");
+						}
+					}
+				}
+				catch (...)
+				{
+					this->_shutdown(); // the workers already started are stopped and joined
+					throw;
+				}
+			}
+
+			~thread_pool()
+			{
+				this->_shutdown();
+			}
+
+		/* GETTERS */
+
+			std::size_t	size(void) const { return (this->_workers.size()); };
+			std::size_t	steals(void) const { return (this->_steals); };
+
+		/* RUN */
+
+			void	run(std::size_t n, std::size_t grain, range_function f, void *context)
+			{
+				_worker		*caller = this->_workers[0];
+				int			failed;
+
+				if (n == 0)
+					return ;
+				if (grain == 0)
+					grain = 1;
+				if (this->size() == 1 || n <= grain)
+				{
+					try
+					{
+						f(context, 0, n);
+					}
+					catch (...)
+					{
+						throw std::runtime_error("thread_pool: a range function threw an exception");
+					}
+					return ;
+				}
+				pthread_mutex_lock(&this->_submit);
+				this->_function = f;
+				this->_context = context;
+				this->_grain = grain;
+				this->_failed = 0;
+				__sync_fetch_and_add(&this->_remaining, n); // full barrier : the job is published before its first range
+				caller->push(0, n);
+				pthread_mutex_lock(&this->_lock);
+				this->_generation++;
+				pthread_cond_broadcast(&this->_wake);
+				pthread_mutex_unlock(&this->_lock);
+				this->_work(caller);
+				failed = this->_failed;
+				pthread_mutex_unlock(&this->_submit);
+				if (failed)
+					throw std::runtime_error("thread_pool: a range function threw an exception");
+			}
+
+		private:
+
+			thread_pool(const thread_pool &original);
+			thread_pool&	operator=(const thread_pool &original);
+
+			struct	_range
+			{
+				std::size_t		begin;
+				std::size_t		end;
+			};
+
+			/* a deque of ranges and its lock, alone on its cache lines */
+			struct	_worker
+			{
+				thread_pool				*pool;
+				std::size_t				index;
+				unsigned long long		seed; // xorshift state to pick the victims
+				pthread_t				thread;
+				pthread_mutex_t			lock;
+				std::deque<_range>		ranges;
+
+				_worker(thread_pool *p, std::size_t i) : pool(p), index(i), seed(0x9e3779b97f4a7c15ULL * (i + 1))
+				{
+					pthread_mutex_init(&this->lock, nullptr);
+				}
+
+				~_worker() { pthread_mutex_destroy(&this->lock); }
+
+				void	push(std::size_t begin, std::size_t end)
+				{
+					_range	r;
+
+					r.begin = begin;
+					r.end = end;
+					pthread_mutex_lock(&this->lock);
+					this->ranges.push_back(r);
+					pthread_mutex_unlock(&this->lock);
+				}
+
+				/* the owner takes the newest range, a thief the oldest one */
+				bool	take(_range &r, bool newest)
+				{
+					bool	found;
+
+					pthread_mutex_lock(&this->lock);
+					found = (this->ranges.empty() == false);
+					if (found && newest)
+					{
+						r = this->ranges.back();
+						this->ranges.pop_back();
+					}
+					else if (found)
+					{
+						r = this->ranges.front();
+						this->ranges.pop_front();
+					}
+					pthread_mutex_unlock(&this->lock);
+					return (found);
+				}
+			} __attribute__((aligned(64)));
+
+			std::vector<_worker *>		_workers; // _workers[0] is the thread calling run
+			pthread_mutex_t				_lock; // sleeping workers
+			pthread_cond_t				_wake;
+			pthread_mutex_t				_submit; // one run at a time
+			volatile unsigned long		_generation; // number of runs started
+			volatile int				_stop;
+			range_function				_function;
+			void						*_context;
+			std::size_t					_grain;
+			volatile std::size_t		_remaining; // indexes of the current run not done yet
+			volatile int				_failed;
+			std::size_t					_steals;
+
+			/* HELPERS */
+
+			static void	*_main(void *arg)
+			{
+				_worker			*self = static_cast<_worker *>(arg);
+				thread_pool		*pool = self->pool;
+				unsigned long	seen = 0;
+
+				while (true)
+				{
+					pthread_mutex_lock(&pool->_lock);
+					while (pool->_stop == 0 && pool->_generation == seen)
+						pthread_cond_wait(&pool->_wake, &pool->_lock);
+					seen = pool->_generation;
+					if (pool->_stop)
+					{
+						pthread_mutex_unlock(&pool->_lock);
+						return (nullptr);
+					}
+					pthread_mutex_unlock(&pool->_lock);
+					pool->_work(self);
+				}
+			}
+
+			/* runs ranges of the current job until all its indexes are done */
+			void	_work(_worker *self)
+			{
+				_range		r;
+
+				while (__atomic_load_n(&this->_remaining, __ATOMIC_ACQUIRE) != 0) // sees the results of the others
+				{
+					if (self->take(r, true) || this->_steal(self, r))
+						this->_execute(self, r);
+					else
+						sched_yield();
+				}
+			}
+
+			/* one attempt on every other worker, starting from a random one */
+			bool	_steal(_worker *self, _range &r)
+			{
+				std::size_t		n = this->_workers.size();
+				std::size_t		start;
+
+				self->seed ^= self->seed >> 12;
+				self->seed ^= self->seed << 25;
+				self->seed ^= self->seed >> 27;
+				start = static_cast<std::size_t>((self->seed * 0x2545f4914f6cdd1dULL) >> 33) % n;
+				for (std::size_t i = 0; i < n; i++)
+				{
+					_worker		*victim = this->_workers[(start + i) % n];
+
+					if (victim != self && victim->take(r, false))
+					{
+						__sync_fetch_and_add(&this->_steals, 1);
+						return (true);
+					}
+				}
+				return (false);
+			}
+
+			/* halves r while it is bigger than the grain (the right halves can be stolen), then runs it */
+			void	_execute(_worker *self, _range r)
+			{
+				while (r.end - r.begin > this->_grain)
+				{
+					std::size_t		mid = r.begin + (r.end - r.begin) / 2;
+
+					self->push(mid, r.end);
+					r.end = mid;
+				}
+				try
+				{
+					this->_function(this->_context, r.begin, r.end);
+				}
+				catch (...)
+				{
+					this->_failed = 1;
+				}
+				__sync_fetch_and_sub(&this->_remaining, r.end - r.begin);
+			}
+
+			/* a worker on its own 64 bytes aligned block (operator new only guarantees the alignment of
+			the fundamental types) */
+			_worker	*_newWorker(std::size_t index)
+			{
+				void	*mem = nullptr;
+
+				if (posix_memalign(&mem, 64, sizeof(_worker)) != 0)
+					throw std::bad_alloc();
+				return (new (mem) _worker(this, index));
+			}
+
+			static void	_deleteWorker(_worker *w)
+			{
+				w->~_worker();
+				free(w);
+			}
+
+			/* stops and joins the started workers, then frees everything */
+			void	_shutdown(void)
+			{
+				pthread_mutex_lock(&this->_lock);
+				this->_stop = 1;
+				pthread_cond_broadcast(&this->_wake);
+				pthread_mutex_unlock(&this->_lock);
+				for (std::size_t i = 1; i < this->_workers.size(); i++)
+					pthread_join(this->_workers[i]->thread, nullptr);
+				for (std::size_t i = 0; i < this->_workers.size(); i++)
+					_deleteWorker(this->_workers[i]);
+				this->_workers.clear();
+				pthread_mutex_destroy(&this->_submit);
+				pthread_cond_destroy(&this->_wake);
+				pthread_mutex_destroy(&this->_lock);
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,231 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bitIterator.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:27:37 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:31:10 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BIT_ITERATOR_HPP
+# define BIT_ITERATOR_HPP
+
+# include "../utils/iteratorTraits.hpp"
+# include "../utils/enableConst.hpp"
+# include "../utils/enableIf.hpp"
+
+# include <climits>
+# include <cstddef>
+# include <iterator>
+
+/* iterator over the bits of a ft::vector<bool> : the address of a word and the index of a bit in it.
+A bit can not be referenced by a bool& : the iterator returns a bit_reference, a proxy which reads
+and writes its bit through the word (the const_iterator returns a plain bool). Random access, the
+arithmetic is done on the index of the bit */
+
+namespace ft
+{
+	typedef unsigned long		bit_word;
+
+	static const std::size_t	bits_per_word = sizeof(bit_word) * CHAR_BIT;
+
+	/* a bit in a word, converts to bool and can be assigned a bool */
+	class bit_reference
+	{
+		public:
+
+			bit_reference(bit_word *word, bit_word mask) : _word(word), _mask(mask) {};
+			bit_reference(const bit_reference &original) : _word(original._word), _mask(original._mask) {};
+			~bit_reference() {};
+
+			operator bool() const { return ((*this->_word & this->_mask) != 0); };
+			bool	operator~() const { return ((*this->_word & this->_mask) == 0); };
+
+			bit_reference&	operator=(bool val)
+			{
+				if (val)
+					*this->_word |= this->_mask;
+				else
+					*this->_word &= ~this->_mask;
+				return (*this);
+			}
+
+			/* copies the value of the bit, not the reference (like a bool&) */
+			bit_reference&	operator=(const bit_reference &original) { return (*this = bool(original)); };
+
+			void	flip(void) { *this->_word ^= this->_mask; };
+
+		private:
+
+			bit_word	*_word;
+			bit_word	_mask;
+	};
+
+	/* swaps the bits, not the proxies (std::reverse, std::iter_swap...) */
+	inline void	swap(bit_reference a, bit_reference b)
+	{
+		bool	tmp = a;
+
+		a = b;
+		b = tmp;
+	}
+
+	template <bool IsConst = false>
+	class bitIterator
+	{
+		public:
+
+			/* ALIASES */
+
+			typedef std::random_access_iterator_tag											iterator_category;
+			typedef bool																	value_type;
+			typedef std::size_t																size_type;
+			typedef std::ptrdiff_t															difference_type;
+			typedef typename ft::enable_const<IsConst, bit_word*, const bit_word*>::type	word_pointer;
+			typedef typename ft::enable_const<IsConst, bit_reference, bool>::type			reference;
+			typedef void																	pointer; // no address for a bit
+
+			/* CONSTRUCTOR, DESTRUCTOR, COPY CONSTRUCTOR, OVERLOAD OPERATOR = */
+			bitIterator(void) : _word(nullptr), _offset(0) {};
+			bitIterator(word_pointer word, unsigned int offset) : _word(word), _offset(offset) {};
+			bitIterator(const bitIterator &original) : _word(original._word), _offset(original._offset) {};
+
+			/* iterator to const_iterator */
+			template <bool OtherConst>
+			bitIterator(const bitIterator<OtherConst> &original,
+				typename ft::enable_if<IsConst && !OtherConst, int>::type = 0) : _word(original.word()),
+				_offset(original.offset()) {};
+
+			~bitIterator() {};
+
+			bitIterator&	operator=(const bitIterator &original)
+			{
+				this->_word = original._word;
+				this->_offset = original._offset;
+				return (*this);
+			}
+
+			/* word holding the bit, and index of the bit in it */
+			word_pointer	word(void) const { return (this->_word); };
+			unsigned int	offset(void) const { return (this->_offset); };
+
+			/* ARITHMETICS OPERATORS */
+
+			bitIterator		operator+(difference_type diff) const { bitIterator tmp(*this); return (tmp += diff); };
+			bitIterator		operator-(difference_type diff) const { bitIterator tmp(*this); return (tmp -= diff); };
+
+			/* INCREMENTATION OPERATORS */
+			bitIterator&	operator++()
+			{
+				if (++this->_offset == ft::bits_per_word)
+				{
+					this->_offset = 0;
+					this->_word++;
+				}
+				return (*this);
+			}
+
+			bitIterator		operator++(int)
+			{
+				bitIterator		tmp(*this);
+
+				++(*this);
+				return (tmp);
+			}
+
+			bitIterator&	operator--()
+			{
+				if (this->_offset-- == 0)
+				{
+					this->_offset = ft::bits_per_word - 1;
+					this->_word--;
+				}
+				return (*this);
+			}
+
+			bitIterator		operator--(int)
+			{
+				bitIterator		tmp(*this);
+
+				--(*this);
+				return (tmp);
+			}
+
+			/* the words are moved by the quotient, rounded down (a negative index borrows a word) */
+			bitIterator&	operator+=(difference_type diff)
+			{
+				difference_type		index = static_cast<difference_type>(this->_offset) + diff;
+				difference_type		words = index / static_cast<difference_type>(ft::bits_per_word);
+
+				index %= static_cast<difference_type>(ft::bits_per_word);
+				if (index < 0)
+				{
+					index += ft::bits_per_word;
+					words--;
+				}
+				this->_word += words;
+				this->_offset = static_cast<unsigned int>(index);
+				return (*this);
+			}
+
+			bitIterator&	operator-=(difference_type diff) { return (*this += -diff); };
+
+			/* OPS WITH REFERENCES */
+			reference		operator*() const { return (reference(*this->_word & (bit_word(1) << this->_offset))); };
+			reference		operator[](difference_type diff) const { return (*(*this + diff)); };
+
+		private:
+
+			word_pointer	_word;
+			unsigned int	_offset;
+	};
+
+	/* the proxy of a non const iterator points to the word, the const one only reads it */
+	template <>
+	inline bitIterator<false>::reference	bitIterator<false>::operator*() const
+	{
+		return (bit_reference(this->_word, bit_word(1) << this->_offset));
+	}
+
+	/* n + a */
+	template <bool IsConst>
+	bitIterator<IsConst>	operator+(typename bitIterator<IsConst>::difference_type diff, const bitIterator<IsConst> &it)
+	{
+		return (it + diff);
+	}
+
+	/* a - b, const and non const mixed */
+	template <bool C1, bool C2>
+	std::ptrdiff_t	operator-(const bitIterator<C1> &lhs, const bitIterator<C2> &rhs)
+	{
+		return ((lhs.word() - rhs.word()) * static_cast<std::ptrdiff_t>(ft::bits_per_word)
+			+ static_cast<std::ptrdiff_t>(lhs.offset()) - static_cast<std::ptrdiff_t>(rhs.offset()));
+	}
+
+	/* EQUIVALENCY OPERATORS, const and non const mixed */
+	template <bool C1, bool C2>
+	bool	operator==(const bitIterator<C1> &lhs, const bitIterator<C2> &rhs)
+	{
+		return (lhs.word() == rhs.word() && lhs.offset() == rhs.offset());
+	}
+
+	template <bool C1, bool C2>
+	bool	operator!=(const bitIterator<C1> &lhs, const bitIterator<C2> &rhs) { return (!(lhs == rhs)); }
+
+	template <bool C1, bool C2>
+	bool	operator<(const bitIterator<C1> &lhs, const bitIterator<C2> &rhs) { return ((lhs - rhs) < 0); }
+
+	template <bool C1, bool C2>
+	bool	operator>(const bitIterator<C1> &lhs, const bitIterator<C2> &rhs) { return ((lhs - rhs) > 0); }
+
+	template <bool C1, bool C2>
+	bool	operator<=(const bitIterator<C1> &lhs, const bitIterator<C2> &rhs) { return ((lhs - rhs) <= 0); }
+
+	template <bool C1, bool C2>
+	bool	operator>=(const bitIterator<C1> &lhs, const bitIterator<C2> &rhs) { return ((lhs - rhs) >= 0); }
+}
+
+#endif
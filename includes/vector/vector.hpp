@@ -6,7 +6,7 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/27 14:25:35 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/14 13:59:13 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:53:35 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,12 +20,17 @@
 # include <cstddef>
 # include <sstream>
 # include <stdexcept>
+# include <iterator>
+# include <algorithm>
 
 /* include other files */
 
 # include "./vectorIterator.hpp"
 # include "../utils/reverseIterator.hpp"
 # include "../utils/compare.hpp"
+# include "../utils/isIntegral.hpp"
+# include "../utils/enableIf.hpp"
+# include "../utils/containerStats.hpp"
 
 /* put synopsis there */
 
@@ -54,31 +59,40 @@ namespace ft // called by ft::Vector
 		/* CONSTRUCTORS, DESTRUCTOR, COPY, OVERLOADING ASSIGNMENT OPERATOR (COPLIEN FORM) */
 
 			/* basic constructor (empty vector) */
-			explicit vector(const allocator_type& alloc = allocator_type()) : _ptr(nullptr), // to test
-			_size(0), _capacity(0), _alloc(alloc) {}
+			explicit vector(const allocator_type& alloc = allocator_type()) : _alloc(alloc), // to test
+			_size(0), _capacity(0), _ptr(nullptr) {}
 
 			/* vector filled with scalar or objects */
 			explicit vector(size_type n, const value_type& val = value_type(),
-				const allocator_type& alloc = allocator_type()) : _ptr(nullptr), _size(0), _capacity(0), _alloc(alloc) // to test
+				const allocator_type& alloc = allocator_type()) : _alloc(alloc), _size(0), _capacity(0), _ptr(nullptr) // to test
 			{
 				this->assign(n, val);
 			}
 
-			/* fill with a range of iterators */
+			/* fill with a range of iterators (not chosen for vector(n, val) with an integral type) */
 			template <class InputIterator>
-			vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type()) // to test
+			vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, int>::type = 0) : _alloc(alloc), // to test
+				_size(0), _capacity(0), _ptr(nullptr)
 			{
 				this->assign(first, last);			
 			}
 
-			/* copy constructor */
-			vector(const vector& x) : _ptr(x._ptr), _size(x._size), _capacity(x._capacity), _alloc(x._alloc) {} // to test
+			/* copy constructor : copies the elements of x in an array of its own */
+			vector(const vector& x) : _alloc(x._alloc), _size(0), _capacity(0), _ptr(nullptr) // to test
+			{
+				this->reserve(x._size);
+				for (size_type i = 0; i < x._size; i++)
+					this->_alloc.construct(this->_ptr + i, x._ptr[i]);
+				this->_size = x._size;
+			}
 
 			/* destructor */
 			virtual ~vector() // to test
 			{
 				this->clear();
-				this->_alloc.deallocate(this->_ptr, this->_capacity);
+				if (this->_ptr != nullptr)
+					this->_alloc.deallocate(this->_ptr, this->_capacity);
 			}
 
 			/* overloading operator = */
@@ -86,10 +100,9 @@ namespace ft // called by ft::Vector
 			{
 				if (this != &x)
 				{
-					this->_alloc = x._alloc;
-					this->_size = x._size;
-					this->_capacity = x._capacity;
-					this->_ptr = x._ptr;
+					vector		tmp(x);
+
+					this->swap(tmp);
 				}
 				return *this;
 			}
@@ -110,19 +123,18 @@ namespace ft // called by ft::Vector
 					return ;
 				if (n > this->max_size())
 					throw std::length_error("vector"); // test this
-				if (n > this->_capacity)
+				if (n > this->_size)
 				{
-					this->_change_mem_allocated(n);
-					for (size_type i = this->_size; i < this->_capacity; i++)
-						this->_alloc.construct(this->_ptn + i, val);
-					this->_size = this->_capacity;
+					this->reserve(n);
+					for (size_type i = this->_size; i < n; i++)
+						this->_alloc.construct(this->_ptr + i, val);
 				}
 				else
 				{
 					for (size_type i = n; i < this->_size; i++)
-						this->_alloc.destroy(this->_ptn + i);
-					this->_size = n;
+						this->_alloc.destroy(this->_ptr + i);
 				}
+				this->_size = n;
 			}
 
 			/* returns the total number of elements that the vector can hold without reallocation */
@@ -148,11 +160,11 @@ namespace ft // called by ft::Vector
 
 			/* returns a reference to the element at position n in the vector container.
 			can segfault if out-of-range-index */
-			reference	operator[](size_type n) { return *(this + n); }; // to test
+			reference	operator[](size_type n) { return (this->_ptr[n]); }; // to test
 
 			/* returns a const reference to the element at position n in the vector container. 
 			can segfault if out-of-range-index */
-			const_reference	operator[](size_type n) const { return *(this + n); }; // to test
+			const_reference	operator[](size_type n) const { return (this->_ptr[n]); }; // to test
 
 			/* returns a reference to the element at position n in the vector container.
 			if index is wrong, throw a out-of-range-index exception */
@@ -179,10 +191,10 @@ namespace ft // called by ft::Vector
 			const_reference	front(void) const { return (*this->_ptr); }; // to test
 
 			/* returns a reference to the last value stored in vector */
-			reference	back(void) { return (*this->_ptr + this->_size); };  // to test
+			reference	back(void) { return (this->_ptr[this->_size - 1]); };  // to test
 						
 			/* returns a reference to the last value stored in vector */
-			const_reference	back(void) const { return (*this->_ptr + this->_size); }; // to test
+			const_reference	back(void) const { return (this->_ptr[this->_size - 1]); }; // to test
 
 			/* returns a pointer to the memory array used internally by the vector */
 			value_type*	data(void) { return this->_ptr ; }; // to test
@@ -193,114 +205,124 @@ namespace ft // called by ft::Vector
 		/* METHODS RELATIVE TO VECTOR MODIFICATION */
 
 			/* assign destroy content if relevant, then push bakc one by one the range of iterators */
+			/* (not chosen for assign(n, val) with an integral type) */
 			template <class InputIterator>
-			void	assign(InputIterator first, InputIterator last) // to test
+			void	assign(InputIterator first, InputIterator last, // to test
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, int>::type = 0)
 			{
 				if (this->empty() == false)
 					this->clear();	
-				for (first; first != last; first++)
+				for (; first != last; first++)
 					this->push_back(*first);
 			}
 
 			void	assign(size_type n, const value_type& val) // to test
 			{
+				value_type		copy(val); // val may be an element destroyed by clear
+
 				if (this->empty() == false)
 					this->clear();
-				for (int i = 0; i < n; i++)
-					this->push_back(val);
+				this->reserve(n);
+				for (size_type i = 0; i < n; i++)
+					this->push_back(copy);
 			}
 
 			void	push_back(const value_type& val) // to test
 			{
-				if (this->size == this->max_size())
-					std::length_error("vector");
+				if (this->_size == this->max_size())
+					throw std::length_error("vector");
 				if (this->_size == this->_capacity)
+				{
+					value_type		copy(val); // val may be an element of the array freed by the reallocation
+
 					this->_expand_mem_allocated();
-				this->_alloc.construct(this->_ptr + this->_size + 1, val);
+					this->_alloc.construct(this->_ptr + this->_size, copy);
+				}
+				else
+					this->_alloc.construct(this->_ptr + this->_size, val);
+				this->_size++;
 			}
 
 			/* undefined behaviour if container is empty */
 			void	pop_back(void)  // to test
 			{ 
-				this->_alloc.destroy(this->_ptr + this->_size); 
 				this->_size--;
+				this->_alloc.destroy(this->_ptr + this->_size); 
 			}
 
 			/* insert a single value at iterator position */
 			iterator	insert(iterator position, const value_type& val) // to test
 			{
-				if (this->size == this->max_size)
-					throw std::length_error("vector");
-				if (this->_size + 1 > this->_capacity)
-					this->_expand_mem_allocated();
-				if (position != this->end())
-					this->_shift_objs_in_vect(position, 1);
-				this->_alloc.construct(this->_ptr + (position - this->_begin()), val);
-				this->_size++;
+				size_type		index = position - this->begin(); // position is lost if the array moves
+
+				this->insert(position, 1, val);
+				return (this->begin() + index);
 			}
 
-			/* insert n times val at iterator position */
+			/* insert n times val at iterator position. val is copied first : it may be an element of the
+			vector, moved by the shift or freed by the reallocation */
 			void	insert(iterator position, size_type n, const value_type& val) // to test
 			{
-				if (this->_size + n > this->max_size())
+				size_type		index = position - this->begin();
+
+				if (n == 0)
+					return ;
+				if (n > this->max_size() - this->_size)
 					throw std::length_error("vector");
-				while (this->capacity() < (this->size() + n))
-					this->_expand_mem_allocated();
-				if (position != this->end())
-					this->_shift_objs_in_vect(position, n);
-				for (std::size_t i = 0; i < n; i++)
-					this->_alloc.construct(this->_ptr + (position - this->begin()) + i, val);
+
+				value_type		copy(val);
+
+				this->_grow_for(n);
+				this->_shift_objs_in_vect(index, n);
+				for (size_type i = 0; i < n; i++)
+					this->_alloc.construct(this->_ptr + index + i, copy);
 				this->_size += n;
 			}
 			
-			/* insert a the range fist/last at iterator position */
+			/* insert a the range fist/last at iterator position (not chosen for insert(pos, n, val) with
+			an integral type) */
 			template <class InputIterator>
-			void	insert(iterator position, InputIterator first, InputIterator last) // to test
+			void	insert(iterator position, InputIterator first, InputIterator last, // to test
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, int>::type = 0)
 			{
-				std::size_t			dist = last - first;
-				
-				if (this->_size + dist > this->max_size())
-					throw std::length_error("vector");
-				while (this->capacity() < (this->size() + dist))
-					this->_expand_mem_allocated();
-				if (position != this->end())
-					this->_shift_objs_in_vect(position, dist);
-				this->_insert_subarray(position, first, last);
-				this->_size += dist;
+				this->_insert_range(position - this->begin(), first, last,
+					typename ft::iterator_traits<InputIterator>::iterator_category());
 			}
 
 			/* erase a single value a iterator position */
 			iterator	erase(iterator position) // to test
 			{
-				this->_supress_subarray(position, 1);
-				this->_shift_objs_in_vect(position, - 1);
-				this->_size--;
+				return (this->erase(position, position + 1));
 			}
 			
 			/* erase a range of values first/last */
 			iterator	erase(iterator first, iterator last) // to test
 			{
-				std::size_t								dist = last - first;
+				size_type		index = first - this->begin();
+				size_type		dist = last - first;
 				
-				this->_supress_subarray(first, dist);
-				if (last != this->end())
-					this->_shift_objs_in_vect(first, dist * (-1));
+				this->_supress_subarray(index, dist);
+				this->_shift_objs_in_vect(index + dist, -static_cast<difference_type>(dist));
 				this->_size -= dist;
+				return (this->begin() + index);
 			}
 
+			/* exchanges the arrays (no element is copied) */
 			void	swap(vector& x) // to test
 			{
-				ft::vector<value_type>		tmp = *this;
-
-				x._alloc = this->_alloc;
-				x._capacity = this->_capacity;
-				x._size = this->_size;
-				x._ptr = this->_ptr;
-		
-				this->_alloc = tmp._alloc;
-				this->_capacity = tmp._capacity;
-				this->_size = tmp._size;
-				this->_ptr = tmp._ptr;
+				allocator_type		alloc = this->_alloc;
+				size_type			size = this->_size;
+				size_type			capacity = this->_capacity;
+				value_type			*ptr = this->_ptr;
+
+				this->_alloc = x._alloc;
+				this->_size = x._size;
+				this->_capacity = x._capacity;
+				this->_ptr = x._ptr;
+				x._alloc = alloc;
+				x._size = size;
+				x._capacity = capacity;
+				x._ptr = ptr;
 			}
 
 			void	clear(void) // to test
@@ -310,6 +332,18 @@ namespace ft // called by ft::Vector
 				this->_size = 0;
 			}
 
+		/* INSTRUMENTATION */
+
+			/* counters of the reallocations and element moves (zeros unless built with FT_CONTAINERS_STATS) */
+			vector_stats	stats(void) const
+			{
+# ifdef FT_CONTAINERS_STATS
+				return (this->_stats);
+# else
+				return (vector_stats());
+# endif
+			}
+
 		/* METHOD TO RETURN AN ALLOCATOR */
 		
 			allocator_type	get_allocator() const { return (this->_alloc); } ; // to test
@@ -317,20 +351,28 @@ namespace ft // called by ft::Vector
 		/* ITERATORS */
 
 			iterator begin(void) { return iterator(this->_ptr); }; // to test
+
+			const_iterator begin(void) const { return const_iterator(this->_ptr); }; // to test
 			
 			const_iterator cbegin(void) const { return const_iterator(this->_ptr); }; // to test
 
 			iterator end(void) { return iterator(this->_ptr + this->_size); }; // to test
+
+			const_iterator end(void) const { return const_iterator(this->_ptr + this->_size); }; // to test
 			
 			const_iterator cend(void) const { return const_iterator(this->_ptr + this->_size); }; // to test
 
-			reverse_iterator rbegin(void) { return reverse_iterator(this->_ptr); }; // to test
+			reverse_iterator rbegin(void) { return reverse_iterator(this->end()); }; // to test
 			
-			const_reverse_iterator rbegin(void) const { return const_reverse_iterator(this->_ptr); }; // to test
+			const_reverse_iterator rbegin(void) const { return const_reverse_iterator(this->end()); }; // to test
 
-			reverse_iterator crend(void) { return reverse_iterator(this->_ptn + this->_size); }; // to test
+			reverse_iterator rend(void) { return reverse_iterator(this->begin()); }; // to test
 			
-			const_reverse_iterator crend(void) const { return const_reverse_iterator(this->_ptn + this->_size); }; // to test
+			const_reverse_iterator rend(void) const { return const_reverse_iterator(this->begin()); }; // to test
+
+			const_reverse_iterator crbegin(void) const { return const_reverse_iterator(this->end()); }; // to test
+			
+			const_reverse_iterator crend(void) const { return const_reverse_iterator(this->begin()); }; // to test
 
 		private: // private member data
 
@@ -338,6 +380,7 @@ namespace ft // called by ft::Vector
 			size_type			_size;
 			size_type			_capacity;
 			value_type			*_ptr;
+			FT_STATS(vector_stats	_stats;)
 
 		private: // private member methods (helpers)
 
@@ -349,10 +392,14 @@ namespace ft // called by ft::Vector
 				value_type		*new_arr;
 				
 				new_arr = this->_alloc.allocate(n); // allocate n contiguous blocks of memory
+				FT_STATS(this->_stats.reallocations++;)
+				FT_STATS(this->_stats.copied += (this->_size < n ? this->_size : n);)
 				for (size_type i = 0; i < this->_size && i < n; i++) // copy obj in new array (don't do it if not enough space)
 					this->_alloc.construct(new_arr + i, this->at(i));
 				for (size_type i = 0; i < this->_size; i++)
 					this->_alloc.destroy(this->_ptr + i); // suppress all objects in old arr
+				if (this->_ptr != nullptr)
+					this->_alloc.deallocate(this->_ptr, this->_capacity); // then the old arr itself
 				if (this->_size > n)
 					this->_size = n;
 				this->_ptr = new_arr;
@@ -362,7 +409,9 @@ namespace ft // called by ft::Vector
 			/* resize the vector capacity by a factor two (good ratio for performance) */
 			void	_expand_mem_allocated(void) // to test
 			{ 
-				if (this->_capacity * 2 <= this->max_size())
+				if (this->_capacity == 0)
+					this->_change_mem_allocated(1);
+				else if (this->_capacity <= this->max_size() / 2)
 					this->_change_mem_allocated(this->_capacity * 2);
 				else if (this->_capacity == this->max_size())
 					return ;
@@ -370,45 +419,90 @@ namespace ft // called by ft::Vector
 					this->_change_mem_allocated(this->max_size());
 			}
 
-			/* change the position of all a sequence of objects in vector 
-			shifts to the right if n positive, left otherwise */
-			void	_shift_objs_in_vect(iterator pos, int n) // to test
+			/* makes room for n more objects with a single reallocation, to at least twice the capacity so
+			that repeated insertions stay amortized (n <= max_size () - size () is checked by the caller) */
+			void	_grow_for(size_type n)
 			{
-				ft::vector<value_type>				tmp;
-				ft::vectorIterator<value_type>		it = this->begin();
-				std::size_t							len = 0;
+				size_type		needed = this->_size + n;
+				size_type		target;
 
-				// copy the arr int a tmp vector
-				for (size_type i = 0; i < this->_size; i++)
-					tmp.push_back(this->at(i));
-				len = pos - it; // test this
-				for (std::size_t i = len; i < this->size(); i++) // shift the vector values by n
+				if (needed <= this->_capacity)
+					return ;
+				target = (this->_capacity <= this->max_size() / 2 ? this->_capacity * 2 : this->max_size());
+				if (target < needed)
+					target = needed;
+				this->_change_mem_allocated(target);
+			}
+
+			/* moves the objects from index pos to the end of the vector by n places : to the right if n
+			is positive (the capacity must hold them, the n places at pos are left free), to the left
+			otherwise (the n places before pos must be free). Each object is constructed in its new place
+			before being destroyed in the old one, from the end when moving right, from pos when moving left */
+			void	_shift_objs_in_vect(size_type pos, difference_type n) // to test
+			{
+				if (n == 0)
+					return ;
+				FT_STATS(this->_stats.shifted += this->_size - pos;)
+				if (n > 0)
 				{
-					this->_alloc.destroy(this->_ptr + i);
-					this->_alloc.construct(this->_ptr + i + n, tmp[i]);
+					for (size_type i = this->_size; i > pos; i--)
+					{
+						this->_alloc.construct(this->_ptr + i - 1 + n, this->_ptr[i - 1]);
+						this->_alloc.destroy(this->_ptr + i - 1);
+					}
+				}
+				else
+				{
+					for (size_type i = pos; i < this->_size; i++)
+					{
+						this->_alloc.construct(this->_ptr + i + n, this->_ptr[i]);
+						this->_alloc.destroy(this->_ptr + i);
+					}
 				}
 			}
 
-			/* insert a subarray first, last at iterator pos (space need to be free before using this method) */
+			/* a single pass range cannot be measured before it is read : it is pushed at the back one
+			element at a time, then rotated into place */
 			template <class InputIterator>
-			void	_insert_subarray(iterator pos, InputIterator first, InputIterator last) // to test
+			void	_insert_range(size_type index, InputIterator first, InputIterator last, std::input_iterator_tag)
 			{
-				std::size_t		dist = pos - this->begin();
-				
-				for (std::size_t i = 0; i < dist; i++)
-				{
-					this->_alloc.construct(this->_ptr + dist + i, *first);
-					first++;
-					if (first == last)
-						break ;
-				}	
+				size_type		old_size = this->_size;
+
+				for (; first != last; ++first)
+					this->push_back(*first);
+				std::rotate(this->begin() + index, this->begin() + old_size, this->end());
+			}
+
+			/* forward iterators can be read twice : the space is made once, then the range is copied in it */
+			template <class ForwardIterator>
+			void	_insert_range(size_type index, ForwardIterator first, ForwardIterator last,
+				std::forward_iterator_tag)
+			{
+				size_type		dist = std::distance(first, last); // constant time for random access iterators
+
+				if (dist == 0)
+					return ;
+				if (dist > this->max_size() - this->_size)
+					throw std::length_error("vector");
+				this->_grow_for(dist);
+				this->_shift_objs_in_vect(index, dist);
+				this->_insert_subarray(index, first, last);
+				this->_size += dist;
+			}
+
+			/* insert a subarray first, last at index pos (space need to be free before using this method) */
+			template <class InputIterator>
+			void	_insert_subarray(size_type pos, InputIterator first, InputIterator last) // to test
+			{
+				for (size_type i = 0; first != last; i++, first++)
+					this->_alloc.construct(this->_ptr + pos + i, *first);
 			}
 
 			/* destroy a subarray pos/n, freeing its content */
-			void	_supress_subarray(iterator pos, std::size_t n) // to test
+			void	_supress_subarray(size_type pos, size_type n) // to test
 			{
-				for (std::size_t i = 0; i < n; i++)
-					this->_alloc.destroy(this->_ptr + (pos - this->begin()) + i);
+				for (size_type i = 0; i < n; i++)
+					this->_alloc.destroy(this->_ptr + pos + i);
 			}
 	};
 	
@@ -426,7 +520,7 @@ namespace ft // called by ft::Vector
 	template <class T, class Alloc>
 	bool operator!=(const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs) // to test
 	{
-		return (!lhs == rhs);
+		return (!(lhs == rhs));
 	}
 	
 	template <class T, class Alloc>
@@ -457,4 +551,7 @@ namespace ft // called by ft::Vector
 	void swap(vector<T,Alloc>& x, vector<T,Alloc>& y) { x.swap(y); }; // to test
 }
 
+/* specialization for bool, one bit per element */
+# include "./vectorBool.hpp"
+
 #endif
@@ -0,0 +1,610 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vectorBool.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:28:25 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:31:10 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VECTOR_BOOL_HPP
+# define VECTOR_BOOL_HPP
+
+# include <limits>
+# include <memory>
+# include <cstring>
+# include <cstddef>
+# include <stdexcept>
+# include <algorithm>
+
+# include "./vector.hpp"
+# include "./bitIterator.hpp"
+# include "../utils/reverseIterator.hpp"
+# include "../utils/compare.hpp"
+# include "../utils/isIntegral.hpp"
+# include "../utils/enableIf.hpp"
+# include "../utils/containerStats.hpp"
+
+/*
+
+	SYNOPSIS : ft::vector<bool> stores one bit per element, in words of 64 bits (bit i of the vector is
+	bit i % 64 of word i / 64). The bits after size() in the last word are always 0 : the word kernels
+	below can work on whole words without masking the end.
+
+	Besides the interface of ft::vector (no insert or erase in the middle : they move every following bit) :
+
+	=>	size_type	count(void) const;					// number of true bits
+	=>	size_type	find_first(void) const;				// index of the first true bit, size() if none
+	=>	size_type	find_next(size_type pos) const;		// first true bit after pos, size() if none
+	=>	void		flip(void);							// every bit
+	=>	vector&		operator&=(const vector &other);	// and |=, ^=, and the &, |, ^ operators : both
+														// vectors must have the same size (invalid_argument)
+	=>	bit_word	*words(void);						// the storage, word_count() words
+	=>	size_type	word_count(void) const;
+
+	count runs popcnt on each word, or with AVX2 a lookup of the bits of each nibble in a 16 entries
+	table (vpshufb : 32 bytes per instruction), summed per 64 bits word with vpsadbw. The bitwise
+	operators go through 4 words per AVX2 instruction. The kernels are chosen at the first call from
+	the CPU features, like the ones of compare.hpp. find_first and find_next skip the null words, then
+	use ctz on the first word with a bit set. assign(n, val) and resize fill whole words at once.
+
+	The iterators (bitIterator.hpp) return a bit_reference proxy : vector<bool>::reference is not a bool&.
+*/
+
+namespace ft
+{
+	/* WORD KERNELS */
+
+	inline std::size_t	count_bits_scalar(const bit_word *words, std::size_t n)
+	{
+		std::size_t		count = 0;
+
+		for (std::size_t i = 0; i < n; i++)
+			count += __builtin_popcountl(words[i]);
+		return (count);
+	}
+
+# if FT_COMPARE_X86
+
+	/* same loop, the builtin becomes one popcnt instruction instead of a call */
+	__attribute__((target("popcnt")))
+	inline std::size_t	count_bits_popcnt(const bit_word *words, std::size_t n)
+	{
+		std::size_t		count = 0;
+
+		for (std::size_t i = 0; i < n; i++)
+			count += __builtin_popcountl(words[i]);
+		return (count);
+	}
+
+	/* 4 words per step : the bits set in each nibble are looked up in a table of 16 bytes, and the
+	bytes of each word are summed by vpsadbw into 4 counters of 64 bits */
+	__attribute__((target("avx2,popcnt")))
+	inline std::size_t	count_bits_avx2(const bit_word *words, std::size_t n)
+	{
+		const __m256i	table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		const __m256i	low_nibbles = _mm256_set1_epi8(0x0F);
+		__m256i			sums = _mm256_setzero_si256();
+		std::size_t		i = 0;
+		std::size_t		count = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m256i		v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + i));
+			__m256i		bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(v, low_nibbles)),
+				_mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low_nibbles)));
+
+			sums = _mm256_add_epi64(sums, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+		}
+		count = static_cast<std::size_t>(_mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1)
+			+ _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3));
+		for (; i < n; i++)
+			count += __builtin_popcountl(words[i]);
+		return (count);
+	}
+
+# endif
+
+	typedef std::size_t	(*count_bits_kernel)(const bit_word *, std::size_t);
+
+	/* widest kernel supported by the CPU running the program */
+	inline count_bits_kernel	select_count_bits(const char **name = nullptr)
+	{
+		const char			*dummy;
+		count_bits_kernel	kernel = count_bits_scalar;
+
+		if (name == nullptr)
+			name = &dummy;
+		*name = "scalar";
+# if FT_COMPARE_X86
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+		{
+			*name = "avx2";
+			kernel = count_bits_avx2;
+		}
+		else if (__builtin_cpu_supports("popcnt"))
+		{
+			*name = "popcnt";
+			kernel = count_bits_popcnt;
+		}
+# endif
+		return (kernel);
+	}
+
+	inline std::size_t	count_bits(const bit_word *words, std::size_t n)
+	{
+		static const count_bits_kernel		kernel = select_count_bits();
+
+		return (kernel(words, n));
+	}
+
+	/* operations of the bitwise kernels, on a word and on 4 words */
+	struct bit_and
+	{
+		static bit_word	word(bit_word a, bit_word b) { return (a & b); }
+# if FT_COMPARE_X86
+		__attribute__((target("avx2")))
+		static __m256i	avx2(__m256i a, __m256i b) { return (_mm256_and_si256(a, b)); }
+# endif
+	};
+
+	struct bit_or
+	{
+		static bit_word	word(bit_word a, bit_word b) { return (a | b); }
+# if FT_COMPARE_X86
+		__attribute__((target("avx2")))
+		static __m256i	avx2(__m256i a, __m256i b) { return (_mm256_or_si256(a, b)); }
+# endif
+	};
+
+	struct bit_xor
+	{
+		static bit_word	word(bit_word a, bit_word b) { return (a ^ b); }
+# if FT_COMPARE_X86
+		__attribute__((target("avx2")))
+		static __m256i	avx2(__m256i a, __m256i b) { return (_mm256_xor_si256(a, b)); }
+# endif
+	};
+
+	/* dst[i] = Op(dst[i], src[i]) */
+	template <class Op>
+	void	bitwise_words_scalar(bit_word *dst, const bit_word *src, std::size_t n)
+	{
+		for (std::size_t i = 0; i < n; i++)
+			dst[i] = Op::word(dst[i], src[i]);
+	}
+
+# if FT_COMPARE_X86
+
+	template <class Op>
+	__attribute__((target("avx2")))
+	void	bitwise_words_avx2(bit_word *dst, const bit_word *src, std::size_t n)
+	{
+		std::size_t		i = 0;
+
+		for (; i + 4 <= n; i += 4)
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), Op::avx2(
+				_mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i)),
+				_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i))));
+		for (; i < n; i++)
+			dst[i] = Op::word(dst[i], src[i]);
+	}
+
+# endif
+
+	/* true if the CPU running the program has AVX2 (checked once) */
+	inline bool	bitwise_words_avx2_supported(void)
+	{
+# if FT_COMPARE_X86
+		static const bool	supported = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+
+		return (supported);
+# else
+		return (false);
+# endif
+	}
+
+	template <class Op>
+	void	bitwise_words(bit_word *dst, const bit_word *src, std::size_t n)
+	{
+# if FT_COMPARE_X86
+		if (ft::bitwise_words_avx2_supported())
+		{
+			ft::bitwise_words_avx2<Op>(dst, src, n);
+			return ;
+		}
+# endif
+		ft::bitwise_words_scalar<Op>(dst, src, n);
+	}
+
+	/* VECTOR OF BITS */
+
+	template <class Alloc>
+	class vector<bool, Alloc>
+	{
+		/* ALIASES */
+		public:
+
+			typedef bool														value_type;
+			typedef Alloc														allocator_type;
+			typedef typename Alloc::template rebind<bit_word>::other			word_allocator_type;
+			typedef ft::bit_reference											reference;
+			typedef bool														const_reference;
+			typedef std::size_t													size_type;
+			typedef std::ptrdiff_t												difference_type;
+			/* aliases for iterators */
+			typedef ft::bitIterator<false>										iterator;
+			typedef ft::bitIterator<true>										const_iterator;
+			typedef typename ft::reverseIterator<iterator>						reverse_iterator;
+			typedef typename ft::reverseIterator<const_iterator>				const_reverse_iterator;
+
+		/* CONSTRUCTORS, DESTRUCTOR, COPY, OVERLOADING ASSIGNMENT OPERATOR (COPLIEN FORM) */
+
+			/* empty vector */
+			explicit vector(const allocator_type& alloc = allocator_type()) : _alloc(alloc), _words(nullptr),
+			_size(0), _word_capacity(0) {}
+
+			/* n bits set to val */
+			explicit vector(size_type n, const value_type& val = value_type(),
+				const allocator_type& alloc = allocator_type()) : _alloc(alloc), _words(nullptr), _size(0),
+				_word_capacity(0)
+			{
+				this->assign(n, val);
+			}
+
+			/* copy of a range of values converting to bool (vector(5, true) is not a range) */
+			template <class InputIterator>
+			vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, int>::type = 0) : _alloc(alloc),
+				_words(nullptr), _size(0), _word_capacity(0)
+			{
+				this->assign(first, last);
+			}
+
+			vector(const vector& x) : _alloc(x._alloc), _words(nullptr), _size(0), _word_capacity(0)
+			{
+				*this = x;
+			}
+
+			virtual ~vector()
+			{
+				if (this->_words != nullptr)
+					this->_alloc.deallocate(this->_words, this->_word_capacity);
+			}
+
+			vector& operator=(const vector& x)
+			{
+				if (this != &x)
+				{
+					this->_size = 0;
+					this->reserve(x._size);
+					if (x._size > 0)
+						std::memcpy(this->_words, x._words, x.word_count() * sizeof(bit_word));
+					this->_size = x._size;
+				}
+				return *this;
+			}
+
+		/* METHODS RELATIVE TO VECTOR CAPACITY */
+
+			size_type	size(void) const { return this->_size; };
+
+			size_type	max_size(void) const
+			{
+				size_type	words = this->_alloc.max_size();
+
+				if (words > std::numeric_limits<size_type>::max() / ft::bits_per_word)
+					words = std::numeric_limits<size_type>::max() / ft::bits_per_word;
+				return (words * ft::bits_per_word);
+			}
+
+			/* the new bits are set to val, a whole word at a time */
+			void	resize(size_type n, value_type val = value_type())
+			{
+				if (n > this->_size)
+				{
+					this->_grow(n);
+					this->_fill(this->_size, n, val);
+				}
+				this->_size = n;
+				this->_clear_tail();
+			}
+
+			size_type	capacity(void) const { return this->_word_capacity * ft::bits_per_word; };
+
+			bool	empty(void) const { return (this->_size == 0); };
+
+			void	reserve(size_type n)
+			{
+				if (n > this->max_size())
+					throw std::length_error("vector");
+				if (n > this->capacity())
+					this->_change_mem_allocated(ft::vector<bool, Alloc>::_words_for(n));
+			}
+
+		/* METHODS RELATIVE TO VECTOR'S ELEMENT ACCESS */
+
+			reference	operator[](size_type n)
+			{
+				return (reference(this->_words + n / ft::bits_per_word, bit_word(1) << (n % ft::bits_per_word)));
+			}
+
+			const_reference	operator[](size_type n) const
+			{
+				return ((this->_words[n / ft::bits_per_word] >> (n % ft::bits_per_word)) & 1);
+			}
+
+			reference	at(size_type n)
+			{
+				if (n >= this->_size)
+					throw std::out_of_range("vector");
+				return (this->operator[](n));
+			}
+
+			const_reference	at(size_type n) const
+			{
+				if (n >= this->_size)
+					throw std::out_of_range("vector");
+				return (this->operator[](n));
+			}
+
+			reference		front(void) { return (this->operator[](0)); };
+			const_reference	front(void) const { return (this->operator[](0)); };
+			reference		back(void) { return (this->operator[](this->_size - 1)); };
+			const_reference	back(void) const { return (this->operator[](this->_size - 1)); };
+
+			/* the words holding the bits (the bits after size() are 0) */
+			bit_word		*words(void) { return (this->_words); };
+			const bit_word	*words(void) const { return (this->_words); };
+			size_type		word_count(void) const { return (ft::vector<bool, Alloc>::_words_for(this->_size)); };
+
+		/* METHODS RELATIVE TO VECTOR MODIFICATION */
+
+			template <class InputIterator>
+			void	assign(InputIterator first, InputIterator last,
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, int>::type = 0)
+			{
+				this->clear();
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			void	assign(size_type n, const value_type& val)
+			{
+				this->clear();
+				this->resize(n, val);
+			}
+
+			void	push_back(const value_type& val)
+			{
+				if (this->_size == this->capacity())
+					this->_grow(this->_size + 1);
+				if (this->_size % ft::bits_per_word == 0)
+					this->_words[this->_size / ft::bits_per_word] = 0;
+				this->_size++;
+				this->back() = val;
+			}
+
+			/* undefined behaviour if container is empty */
+			void	pop_back(void)
+			{
+				this->back() = false;
+				this->_size--;
+			}
+
+			void	swap(vector& x)
+			{
+				std::swap(this->_alloc, x._alloc);
+				std::swap(this->_words, x._words);
+				std::swap(this->_size, x._size);
+				std::swap(this->_word_capacity, x._word_capacity);
+			}
+
+			void	clear(void) { this->_size = 0; };
+
+			void	flip(void)
+			{
+				size_type	n = this->word_count();
+
+				for (size_type i = 0; i < n; i++)
+					this->_words[i] = ~this->_words[i];
+				this->_clear_tail();
+			}
+
+		/* WORD OPERATIONS */
+
+			size_type	count(void) const { return (ft::count_bits(this->_words, this->word_count())); };
+
+			size_type	find_first(void) const { return (this->_find_from(0)); };
+
+			size_type	find_next(size_type pos) const
+			{
+				if (pos + 1 >= this->_size)
+					return (this->_size);
+				return (this->_find_from(pos + 1));
+			}
+
+			vector&	operator&=(const vector &other) { return (this->_bitwise<ft::bit_and>(other)); };
+			vector&	operator|=(const vector &other) { return (this->_bitwise<ft::bit_or>(other)); };
+			vector&	operator^=(const vector &other) { return (this->_bitwise<ft::bit_xor>(other)); };
+
+		/* INSTRUMENTATION */
+
+			/* reallocations, and words copied by them (zeros unless built with FT_CONTAINERS_STATS) */
+			vector_stats	stats(void) const
+			{
+# ifdef FT_CONTAINERS_STATS
+				return (this->_stats);
+# else
+				return (vector_stats());
+# endif
+			}
+
+		/* METHOD TO RETURN AN ALLOCATOR */
+
+			allocator_type	get_allocator() const { return (allocator_type(this->_alloc)); };
+
+		/* ITERATORS */
+
+			iterator				begin(void) { return iterator(this->_words, 0); };
+			const_iterator			begin(void) const { return const_iterator(this->_words, 0); };
+			const_iterator			cbegin(void) const { return const_iterator(this->_words, 0); };
+			iterator				end(void) { return (this->begin() + this->_size); };
+			const_iterator			end(void) const { return (this->cbegin() + this->_size); };
+			const_iterator			cend(void) const { return (this->cbegin() + this->_size); };
+			reverse_iterator		rbegin(void) { return reverse_iterator(this->end()); };
+			const_reverse_iterator	rbegin(void) const { return const_reverse_iterator(this->end()); };
+			reverse_iterator		rend(void) { return reverse_iterator(this->begin()); };
+			const_reverse_iterator	rend(void) const { return const_reverse_iterator(this->begin()); };
+
+		private: // private member data
+
+			word_allocator_type		_alloc;
+			bit_word				*_words;
+			size_type				_size; // in bits
+			size_type				_word_capacity;
+			FT_STATS(vector_stats	_stats;)
+
+		private: // private member methods (helpers)
+
+			static size_type	_words_for(size_type bits) { return ((bits + ft::bits_per_word - 1) / ft::bits_per_word); };
+
+			/* moves the words in an array of n words (n holds the current bits) */
+			void	_change_mem_allocated(size_type n)
+			{
+				bit_word	*new_arr = this->_alloc.allocate(n);
+				size_type	used = this->word_count();
+
+				FT_STATS(this->_stats.reallocations++;)
+				FT_STATS(this->_stats.copied += used;)
+				if (used > 0)
+					std::memcpy(new_arr, this->_words, used * sizeof(bit_word));
+				if (this->_words != nullptr)
+					this->_alloc.deallocate(this->_words, this->_word_capacity);
+				this->_words = new_arr;
+				this->_word_capacity = n;
+			}
+
+			/* room for n bits, doubling the capacity at least */
+			void	_grow(size_type n)
+			{
+				size_type	words;
+
+				if (n > this->max_size())
+					throw std::length_error("vector");
+				words = ft::vector<bool, Alloc>::_words_for(n);
+				if (words <= this->_word_capacity)
+					return ;
+				if (words < this->_word_capacity * 2)
+					words = this->_word_capacity * 2;
+				this->_change_mem_allocated(words);
+			}
+
+			/* sets the bits [first, last) to val (the words must be allocated) */
+			void	_fill(size_type first, size_type last, bool val)
+			{
+				const bit_word	fill = (val ? ~bit_word(0) : 0);
+				size_type		word = first / ft::bits_per_word;
+				size_type		last_word = last / ft::bits_per_word;
+				bit_word		head = ~bit_word(0) << (first % ft::bits_per_word); // bits from first in its word
+
+				if (first == last)
+					return ;
+				if (first % ft::bits_per_word == 0 && first >= this->_size)
+					this->_words[word] = 0; // a word not used yet
+				if (word == last_word)
+				{
+					bit_word	mask = head & ~(~bit_word(0) << (last % ft::bits_per_word));
+
+					this->_words[word] = (this->_words[word] & ~mask) | (fill & mask);
+					return ;
+				}
+				this->_words[word] = (this->_words[word] & ~head) | (fill & head);
+				std::fill(this->_words + word + 1, this->_words + last_word, fill);
+				if (last % ft::bits_per_word != 0)
+					this->_words[last_word] = fill & ~(~bit_word(0) << (last % ft::bits_per_word));
+			}
+
+			/* zeroes the bits after size() in the last word */
+			void	_clear_tail(void)
+			{
+				if (this->_size % ft::bits_per_word != 0)
+					this->_words[this->_size / ft::bits_per_word] &= ~(~bit_word(0) << (this->_size % ft::bits_per_word));
+			}
+
+			/* first true bit from pos (< size()), size() if none */
+			size_type	_find_from(size_type pos) const
+			{
+				size_type	n = this->word_count();
+				size_type	word = pos / ft::bits_per_word;
+				bit_word	bits;
+
+				if (pos >= this->_size)
+					return (this->_size);
+				bits = this->_words[word] & (~bit_word(0) << (pos % ft::bits_per_word));
+				while (bits == 0)
+				{
+					if (++word == n)
+						return (this->_size);
+					bits = this->_words[word];
+				}
+				return (word * ft::bits_per_word + __builtin_ctzl(bits));
+			}
+
+			template <class Op>
+			vector&	_bitwise(const vector &other)
+			{
+				if (other._size != this->_size)
+					throw std::invalid_argument("vector");
+				ft::bitwise_words<Op>(this->_words, other._words, this->word_count());
+				return (*this);
+			}
+	};
+
+	/* OUT OF THE CLASS OPERATORS FOR VECTORS OF BITS */
+
+	template <class Alloc>
+	vector<bool, Alloc>	operator&(const vector<bool, Alloc> &lhs, const vector<bool, Alloc> &rhs)
+	{
+		vector<bool, Alloc>		res(lhs);
+
+		return (res &= rhs);
+	}
+
+	template <class Alloc>
+	vector<bool, Alloc>	operator|(const vector<bool, Alloc> &lhs, const vector<bool, Alloc> &rhs)
+	{
+		vector<bool, Alloc>		res(lhs);
+
+		return (res |= rhs);
+	}
+
+	template <class Alloc>
+	vector<bool, Alloc>	operator^(const vector<bool, Alloc> &lhs, const vector<bool, Alloc> &rhs)
+	{
+		vector<bool, Alloc>		res(lhs);
+
+		return (res ^= rhs);
+	}
+
+	/* the bits after size() are 0 on both sides : the words are compared whole */
+	template <class Alloc>
+	bool	operator==(const vector<bool, Alloc> &lhs, const vector<bool, Alloc> &rhs)
+	{
+		return (lhs.size() == rhs.size() && (lhs.size() == 0
+			|| std::memcmp(lhs.words(), rhs.words(), lhs.word_count() * sizeof(bit_word)) == 0));
+	}
+
+	template <class Alloc>
+	bool	operator!=(const vector<bool, Alloc> &lhs, const vector<bool, Alloc> &rhs)
+	{
+		return (!(lhs == rhs));
+	}
+}
+
+#endif
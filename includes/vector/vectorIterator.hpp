@@ -6,7 +6,7 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/10/27 18:15:58 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/15 11:55:29 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 05:03:49 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,9 +15,14 @@
 
 # include "../utils/iteratorTraits.hpp"
 # include "../utils/enableConst.hpp"
+# include "../utils/enableIf.hpp"
 
 #include <iterator>
 
+/* random access iterator over the array of a vector : a pointer, with the operations of a pointer.
+An iterator converts to a const_iterator (not the opposite), and both can be compared and subtracted
+with each other */
+
 namespace ft
 {
 	template <typename T, bool IsConst = false>
@@ -28,7 +33,7 @@ namespace ft
 			/* ALIASES */
 			
 			/* type of iterator */
-			typedef std::bidirectional_iterator_tag  											iterator_category;
+			typedef std::random_access_iterator_tag  											iterator_category;
 			/* various data */
 			typedef T														 					value_type;
 			typedef std::size_t 																size_type;
@@ -38,68 +43,97 @@ namespace ft
 			typedef typename ft::enable_const<IsConst, value_type&, const value_type&>::type	reference;
 			
 			/* CONSTRUCTOR, DESTRUCTOR, COPY CONSTRUCTOR, OVERLOAD OPERATOR = */
-			vectorIterator(void) : _ptr(nullptr) {}; // useful ?
+			vectorIterator(void) : _ptr(nullptr) {};
 			vectorIterator(pointer ptr) : _ptr(ptr) {};
 			vectorIterator(const vectorIterator& original) : _ptr(original._ptr) {};
+
+			/* iterator to const_iterator */
+			template <bool OtherConst>
+			vectorIterator(const vectorIterator<T, OtherConst> &original,
+				typename ft::enable_if<IsConst && !OtherConst, int>::type = 0) : _ptr(original.base()) {};
 			
-			virtual ~vectorIterator() {};
+			~vectorIterator() {};
 			
 			vectorIterator&	operator=(const vectorIterator& original)
 			{
-				if (this != &original)
-					this->_ptr = original._ptr;
+				this->_ptr = original._ptr;
 				return (*this);
 			}
 
+			/* underlying pointer */
+			pointer		base(void) const { return (this->_ptr); };
+
 			/* ARITHMETICS OPERATORS */
 
-			vectorIterator		operator+(difference_type diff) { return (vectorIterator(_ptr + diff)); }; 	// a + n
-			vectorIterator		operator-(difference_type diff) { return (vectorIterator(_ptr - diff)); }; 	// a - n
-			difference_type		operator-(vectorIterator other) { return _ptr - other._ptr; }; 				// a - b
-			// check for *(1 + it) and *(1 - it)
+			vectorIterator		operator+(difference_type diff) const { return (vectorIterator(this->_ptr + diff)); }; 	// a + n
+			vectorIterator		operator-(difference_type diff) const { return (vectorIterator(this->_ptr - diff)); }; 	// a - n
 
 			/* INCREMENTATION OPERATORS */
-			vectorIterator&	operator++() { _ptr++; return *this; };
+			vectorIterator&	operator++() { this->_ptr++; return *this; };
 			vectorIterator	operator++(int)
 			{
-				vectorIterator		tmp(_ptr);
+				vectorIterator		tmp(this->_ptr);
 
-				_ptr++;
+				this->_ptr++;
 				return	tmp;
 			}
-			vectorIterator&	operator--() { _ptr--; return *this; };
+			vectorIterator&	operator--() { this->_ptr--; return *this; };
 			vectorIterator	operator--(int)
 			{
-				vectorIterator		tmp(_ptr);
+				vectorIterator		tmp(this->_ptr);
 
-				_ptr--;
+				this->_ptr--;
 				return	tmp;
 			}
 
-			vectorIterator&	operator+=(difference_type diff) { _ptr += diff; return *this; };
-			vectorIterator&	operator-=(difference_type diff) { _ptr -= diff; return *this; };
-
-			/* EQUIVALENCY OPERATORS */
-			bool	operator==(vectorIterator const &other) const { return _ptr == other._ptr; };
-			bool	operator!=(vectorIterator const &other) const { return _ptr != other._ptr; };
-			bool	operator<(vectorIterator const &other) const { return _ptr < other._ptr; };
-			bool	operator>(vectorIterator const &other) const { return _ptr > other._ptr; };
-			bool	operator<=(vectorIterator const &other) const { return _ptr <= other._ptr; };
-			bool	operator>=(vectorIterator const &other) const { return _ptr >= other._ptr; };
-
-			/* OPS WITH POINTERS AND REFERENCES */
-			reference			operator*() { return *_ptr; };
-			const reference		operator*() const { return *_ptr; };
-			reference			operator[](difference_type diff) { return *(_ptr + diff); };
-			const reference		operator[](difference_type diff) const { return *(_ptr + diff); };
-			pointer				operator->() { return _ptr; };
-			const pointer		operator->() const { return _ptr; };
+			vectorIterator&	operator+=(difference_type diff) { this->_ptr += diff; return *this; };
+			vectorIterator&	operator-=(difference_type diff) { this->_ptr -= diff; return *this; };
+
+			/* OPS WITH POINTERS AND REFERENCES (the constness of the iterator does not change the elements) */
+			reference			operator*() const { return *this->_ptr; };
+			reference			operator[](difference_type diff) const { return *(this->_ptr + diff); };
+			pointer				operator->() const { return this->_ptr; };
 		
 		private:
 
-			pointer		_ptr; // ?????
+			pointer		_ptr;
 			
 	};
+
+	/* n + a */
+	template <typename T, bool IsConst>
+	vectorIterator<T, IsConst>	operator+(typename vectorIterator<T, IsConst>::difference_type diff,
+		const vectorIterator<T, IsConst> &it)
+	{
+		return (it + diff);
+	}
+
+	/* a - b, const and non const mixed */
+	template <typename T, bool C1, bool C2>
+	typename vectorIterator<T, C1>::difference_type	operator-(const vectorIterator<T, C1> &lhs,
+		const vectorIterator<T, C2> &rhs)
+	{
+		return (lhs.base() - rhs.base());
+	}
+
+	/* EQUIVALENCY OPERATORS, const and non const mixed */
+	template <typename T, bool C1, bool C2>
+	bool	operator==(const vectorIterator<T, C1> &lhs, const vectorIterator<T, C2> &rhs) { return (lhs.base() == rhs.base()); }
+
+	template <typename T, bool C1, bool C2>
+	bool	operator!=(const vectorIterator<T, C1> &lhs, const vectorIterator<T, C2> &rhs) { return (lhs.base() != rhs.base()); }
+
+	template <typename T, bool C1, bool C2>
+	bool	operator<(const vectorIterator<T, C1> &lhs, const vectorIterator<T, C2> &rhs) { return (lhs.base() < rhs.base()); }
+
+	template <typename T, bool C1, bool C2>
+	bool	operator>(const vectorIterator<T, C1> &lhs, const vectorIterator<T, C2> &rhs) { return (lhs.base() > rhs.base()); }
+
+	template <typename T, bool C1, bool C2>
+	bool	operator<=(const vectorIterator<T, C1> &lhs, const vectorIterator<T, C2> &rhs) { return (lhs.base() <= rhs.base()); }
+
+	template <typename T, bool C1, bool C2>
+	bool	operator>=(const vectorIterator<T, C1> &lhs, const vectorIterator<T, C2> &rhs) { return (lhs.base() >= rhs.base()); }
 }
 
 #endif
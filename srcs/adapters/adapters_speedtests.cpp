@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   adapters_speedtests.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:41:02 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:43:12 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include "../test_utils/benchmark.hpp"
+#include <queue>
+#include <stack>
+#include <deque>
+#include <iterator>
+
+/* speedtests of the adapters on the pattern of a BFS scheduler : each round pushes a batch of jobs and
+pops a batch of them. ft::queue and ft::stack with push_range and pop_n, then with push and pop one by
+one, against std::queue and std::stack (both over std::deque). ft::priority_queue with push_range and
+pop_n against std::priority_queue */
+
+static const std::size_t	g_batch_size = 4096;
+static const std::size_t	g_rounds = 1000;
+
+enum e_adapter_mode
+{
+	ONE_BY_ONE,
+	BULK
+};
+
+/* the std adapters have no bulk operations : the round is chosen at compile time */
+template <int Mode>
+struct adapter_mode {};
+
+/* the pops one by one, for each kind of adapter */
+template <class Adapter>
+static std::size_t	pop_one(Adapter &adapter) { std::size_t v = adapter.front(); adapter.pop(); return (v); }
+
+template <class T, class C>
+static std::size_t	pop_one(std::stack<T, C> &adapter) { std::size_t v = adapter.top(); adapter.pop(); return (v); }
+
+template <class T, class C>
+static std::size_t	pop_one(ft::stack<T, C> &adapter) { std::size_t v = adapter.top(); adapter.pop(); return (v); }
+
+template <class T, class C, class P>
+static std::size_t	pop_one(std::priority_queue<T, C, P> &adapter) { std::size_t v = adapter.top(); adapter.pop(); return (v); }
+
+template <class T, class C, class P>
+static std::size_t	pop_one(ft::priority_queue<T, C, P> &adapter) { std::size_t v = adapter.top(); adapter.pop(); return (v); }
+
+/* one round : a batch pushed, three quarters of a batch popped */
+template <class Adapter>
+static std::size_t	scheduler_round(Adapter &adapter, const std::vector<int> &batch, std::vector<int> &popped,
+	adapter_mode<BULK>)
+{
+	adapter.push_range(batch.begin(), batch.end());
+	adapter.pop_n(g_batch_size * 3 / 4, popped.begin());
+	return (popped[0]);
+}
+
+template <class Adapter>
+static std::size_t	scheduler_round(Adapter &adapter, const std::vector<int> &batch, std::vector<int> &popped,
+	adapter_mode<ONE_BY_ONE>)
+{
+	std::size_t		sum = 0;
+
+	(void)popped;
+	for (std::size_t i = 0; i < g_batch_size; i++)
+		adapter.push(batch[i]);
+	for (std::size_t i = 0; i < g_batch_size * 3 / 4; i++)
+		sum += pop_one(adapter);
+	return (sum);
+}
+
+/* benchmark task : g_rounds rounds */
+template <class Adapter, int Mode>
+class scheduler_task
+{
+	public:
+
+		scheduler_task(void) : _popped(g_batch_size)
+		{
+			for (std::size_t i = 0; i < g_batch_size; i++)
+				this->_batch.push_back(static_cast<int>((i * 2654435761u) % 1000000));
+		}
+
+		void	setUp(void) { this->_adapter = Adapter(); }
+
+		void	operator()(void)
+		{
+			std::size_t		sum = 0;
+
+			for (std::size_t round = 0; round < g_rounds; round++)
+				sum += scheduler_round(this->_adapter, this->_batch, this->_popped, adapter_mode<Mode>());
+			doNotOptimize(sum);
+			doNotOptimize(this->_adapter.size());
+		}
+
+	private:
+
+		Adapter				_adapter;
+		std::vector<int>	_batch;
+		std::vector<int>	_popped;
+};
+
+/* runs the bulk and one by one versions of Ft, and Std, compared to Std */
+template <class Ft, class Std>
+static void	compare_adapters(Colors &col, const std::string &name, const std::string &std_name)
+{
+	Benchmark					ft_bench(col, "ft::" + name);
+	Benchmark					std_bench(col, std_name);
+	scheduler_task<Ft, BULK>			bulk;
+	scheduler_task<Ft, ONE_BY_ONE>		one_by_one;
+	scheduler_task<Std, ONE_BY_ONE>		reference;
+	const std::size_t			ops = g_rounds * g_batch_size;
+
+	separator(col);
+	std::cout << "testing " << g_rounds << " rounds of " << g_batch_size << " pushes and " << g_batch_size * 3 / 4
+	<< " pops on ft::" << name << " and " << std_name << "..." << std::endl;
+	BenchmarkResult		bulk_res = ft_bench.run("push_range and pop_n", bulk, ops);
+	BenchmarkResult		one_res = ft_bench.run("push and pop", one_by_one, ops);
+	BenchmarkResult		std_res = std_bench.run("push and pop", reference, ops);
+	ft_bench.compare(bulk_res, std_res);
+	ft_bench.compare(one_res, std_res);
+}
+
+void	adapters_speedtest(Colors &col)
+{
+	std::cout << col.bdYellow() << "Starting speedtest for stack, queue and priority_queue..." << col.reset()
+	<< std::endl;
+	compare_adapters<ft::queue<int>, std::queue<int> >(col, "queue", "std::queue");
+	compare_adapters<ft::stack<int>, std::stack<int> >(col, "stack", "std::stack");
+	compare_adapters<ft::priority_queue<int>, std::priority_queue<int> >(col, "priority_queue",
+		"std::priority_queue");
+	std::cout << col.bdYellow() << "End of speedtest for stack, queue and priority_queue" << col.reset() << std::endl;
+}
@@ -0,0 +1,340 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   adapters_tests.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:40:47 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 08:53:35 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include <stack>
+#include <queue>
+#include <deque>
+#include <list>
+#include <sstream>
+#include <iterator>
+
+/* These tests compare ft::stack, ft::queue and ft::priority_queue to their std counterparts, then check
+the bulk operations (push_range, pop_n) against the same pushes and pops done one by one.
+
+I) stack, and a stack whose derived class iterates over the protected container c
+II) queue
+III) priority_queue, with 2, 4 and 8 children per node
+IV) indexed_priority_queue : decrease_key in a Dijkstra, against a Dijkstra without heap */
+
+/* the MutantStack of bin/main.cpp : iterates over the container of the stack */
+template <typename T>
+class iterable_stack : public ft::stack<T>
+{
+	public:
+
+		typedef typename ft::stack<T>::container_type::iterator		iterator;
+
+		iterator	begin(void) { return (this->c.begin()); };
+		iterator	end(void) { return (this->c.end()); };
+};
+
+/* pops every element of an adapter with top (or front), in a vector */
+template <class Adapter>
+static std::vector<int>	drain_top(Adapter &adapter)
+{
+	std::vector<int>	out;
+
+	while (adapter.empty() == false)
+	{
+		out.push_back(adapter.top());
+		adapter.pop();
+	}
+	return (out);
+}
+
+template <class Adapter>
+static std::vector<int>	drain_front(Adapter &adapter)
+{
+	std::vector<int>	out;
+
+	while (adapter.empty() == false)
+	{
+		out.push_back(adapter.front());
+		adapter.pop();
+	}
+	return (out);
+}
+
+static void	print_values(const std::string &name, const std::vector<int> &values)
+{
+	std::cout << name << " :";
+	for (std::size_t i = 0; i < values.size(); i++)
+		std::cout << " " << values[i];
+	std::cout << std::endl;
+}
+
+/* I - STACK */
+
+static void	test_stack(Colors &col)
+{
+	std::cout << col.bdBlue() << "test stack..." << col.reset() << std::endl;
+
+	ft::stack<int>							stack;
+	std::stack<int>							ref;
+	ft::stack<int, std::list<int> >			list_stack;
+	ft::stack<int, ft::vector<int> >		vector_stack;
+	int										values[] = {10, 20, 30, 40, 50, 60};
+	std::vector<int>						popped;
+
+	for (int i = 0; i < 5; i++)
+	{
+		stack.push(i);
+		ref.push(i);
+		list_stack.push(i);
+		vector_stack.push(i);
+	}
+	std::cout << "size = " << stack.size() << " (std : " << ref.size() << "), top = " << stack.top() << " (std : "
+	<< ref.top() << "), top of the stack over std::list = " << list_stack.top() << std::endl;
+	std::cout << "stack over ft::vector, same elements as std::stack = " << std::boolalpha
+	<< (drain_top(vector_stack) == drain_top(ref)) << std::endl;
+	stack.push_range(values, values + 6);
+	std::cout << "after push_range (10 ... 60) : size = " << stack.size() << ", top = " << stack.top() << std::endl;
+	stack.pop_n(4, std::back_inserter(popped));
+	print_values("pop_n (4, out)", popped);
+	std::cout << "pop_n (100) pops " << stack.pop_n(100) << ", empty = " << std::boolalpha << stack.empty()
+	<< std::endl;
+
+	ft::stack<int>		other;
+
+	stack.push(1);
+	other.push(1);
+	std::cout << "== : " << (stack == other) << ", < : " << (stack < other) << std::endl;
+	other.push(2);
+	std::cout << "after other.push (2), == : " << (stack == other) << ", < : " << (stack < other) << std::endl;
+
+	iterable_stack<char>	letters;
+
+	for (char letter = 'a'; letter <= 'z'; letter++)
+		letters.push(letter);
+	std::cout << "iterable stack : ";
+	for (iterable_stack<char>::iterator it = letters.begin(); it != letters.end(); it++)
+		std::cout << *it;
+	std::cout << std::endl;
+}
+
+/* II - QUEUE */
+
+static void	test_queue(Colors &col)
+{
+	std::cout << col.bdBlue() << "test queue..." << col.reset() << std::endl;
+
+	ft::queue<int>				queue;
+	std::queue<int>				ref;
+	ft::queue<int>				one_by_one;
+	std::vector<int>			batch;
+	std::vector<int>			popped;
+
+	for (int i = 0; i < 10000; i++)
+		batch.push_back(i * 7 % 1000);
+	for (int round = 0; round < 20; round++)
+	{
+		queue.push_range(batch.begin(), batch.end());
+		queue.pop_n(round * 500, std::back_inserter(popped));
+		for (std::size_t i = 0; i < batch.size(); i++)
+		{
+			one_by_one.push(batch[i]);
+			ref.push(batch[i]);
+		}
+		for (int i = 0; i < round * 500 && ref.empty() == false; i++)
+		{
+			one_by_one.pop();
+			ref.pop();
+		}
+	}
+	std::cout << "size = " << queue.size() << " (std : " << ref.size() << "), front = " << queue.front()
+	<< " (std : " << ref.front() << "), back = " << queue.back() << " (std : " << ref.back() << ")" << std::endl;
+	std::cout << "elements popped by pop_n = " << popped.size() << std::endl;
+	std::cout << "same queue with push and pop one by one = " << std::boolalpha << (queue == one_by_one)
+	<< ", same elements as std::queue = " << (drain_front(queue) == drain_front(ref)) << std::endl;
+}
+
+/* III - PRIORITY QUEUE */
+
+/* pushes and pops the same values in a d-ary priority_queue and in a std::priority_queue */
+template <std::size_t Arity>
+static void	test_arity(void)
+{
+	ft::priority_queue<int, ft::vector<int>, std::less<int>, Arity>		heap;
+	std::priority_queue<int>											ref;
+	bool																same = true;
+
+	std::srand(Arity);
+	for (int i = 0; i < 100000; i++)
+	{
+		int		val = std::rand() % 1000;
+
+		if (std::rand() % 3 != 0 || ref.empty())
+		{
+			heap.push(val);
+			ref.push(val);
+		}
+		else
+		{
+			same = same && (heap.top() == ref.top());
+			heap.pop();
+			ref.pop();
+		}
+	}
+	std::vector<int>	values(50000);
+
+	for (std::size_t i = 0; i < values.size(); i++)
+		values[i] = std::rand();
+	ft::make_dary_heap<Arity>(values.begin(), values.end(), std::less<int>());
+	std::cout << Arity << " children per node : size = " << heap.size() << ", same tops as std::priority_queue = "
+	<< std::boolalpha << (same && drain_top(heap) == drain_top(ref)) << ", make_dary_heap gives a heap = "
+	<< ft::is_dary_heap<Arity>(values.begin(), values.end(), std::less<int>()) << std::endl;
+}
+
+static void	test_priority_queue(Colors &col)
+{
+	std::cout << col.bdBlue() << "test priority_queue..." << col.reset() << std::endl;
+
+	int															values[] = {5, 1, 8, 3, 9, 2, 7};
+	ft::priority_queue<int>										heap(values, values + 7);
+	std::priority_queue<int>									ref(values, values + 7);
+	ft::priority_queue<int, ft::deque<int>, std::greater<int> >	min_heap(values, values + 7);
+	std::vector<int>											batch;
+	std::vector<int>											popped;
+
+	std::cout << "top = " << heap.top() << " (std : " << ref.top() << "), top of the min heap over ft::deque = "
+	<< min_heap.top() << std::endl;
+	print_values("min heap", drain_top(min_heap));
+
+	std::istringstream											stream("5 1 8 3 9 2 7");
+	ft::priority_queue<int>										read((std::istream_iterator<int>(stream)),
+		std::istream_iterator<int>());
+
+	print_values("from an istream_iterator (single pass)", drain_top(read));
+	std::srand(42);
+	for (int round = 0; round < 50; round++)
+	{
+		batch.clear();
+		for (int i = 0; i < (round % 5 == 0 ? 3000 : 40); i++)
+			batch.push_back(std::rand() % 100000);
+		heap.push_range(batch.begin(), batch.end());
+		for (std::size_t i = 0; i < batch.size(); i++)
+			ref.push(batch[i]);
+		popped.clear();
+		heap.pop_n(30, std::back_inserter(popped));
+		for (std::size_t i = 0; i < popped.size(); i++)
+		{
+			if (popped[i] != ref.top())
+				std::cout << col.bdRed() << "pop_n differs from std::priority_queue" << col.reset() << std::endl;
+			ref.pop();
+		}
+	}
+	std::cout << "size = " << heap.size() << " (std : " << ref.size() << "), same elements as std::priority_queue = "
+	<< std::boolalpha << (drain_top(heap) == drain_top(ref)) << std::endl;
+	test_arity<2>();
+	test_arity<8>();
+}
+
+/* IV - INDEXED PRIORITY QUEUE */
+
+/* distances from the vertex 0 of a grid of side * side vertices, w[v][0..3] the weights of the edges
+to the right, left, down and up neighbours (0 : no edge) */
+static std::vector<int>	dijkstra(const std::vector<std::vector<int> > &w, int side, bool with_heap)
+{
+	const int												moves[4] = {1, -1, side, -side};
+	std::vector<int>										dist(w.size(), -1);
+	std::vector<bool>										done(w.size(), false);
+	ft::indexed_priority_queue<int, std::greater<int> >		queue(w.size());
+
+	dist[0] = 0;
+	queue.push(0, 0);
+	while (true)
+	{
+		int		u = -1;
+
+		if (with_heap && queue.empty() == false)
+		{
+			u = queue.top_id();
+			queue.pop();
+		}
+		else if (with_heap == false) // the closest vertex not done, in O(V)
+			for (std::size_t v = 0; v < w.size(); v++)
+				if (done[v] == false && dist[v] >= 0 && (u < 0 || dist[v] < dist[u]))
+					u = v;
+		if (u < 0)
+			break ;
+		done[u] = true;
+		for (int m = 0; m < 4; m++)
+		{
+			int		v = u + moves[m];
+
+			if (w[u][m] == 0 || done[v] || (dist[v] >= 0 && dist[v] <= dist[u] + w[u][m]))
+				continue ;
+			dist[v] = dist[u] + w[u][m];
+			if (with_heap)
+				queue.update(v, dist[v]);
+		}
+	}
+	return (dist);
+}
+
+static void	test_indexed_priority_queue(Colors &col)
+{
+	std::cout << col.bdBlue() << "test indexed_priority_queue..." << col.reset() << std::endl;
+
+	ft::indexed_priority_queue<int, std::greater<int>, 8>	timers;
+	const int												side = 60;
+	std::vector<std::vector<int> >							w(side * side, std::vector<int>(4, 0));
+
+	for (std::size_t id = 0; id < 10; id++)
+		timers.push(id, 100 + id * 10);
+	timers.decrease_key(7, 5);
+	timers.update(2, 1000);
+	timers.erase(0);
+	std::cout << "top = " << timers.top() << " (id " << timers.top_id() << "), size = " << timers.size()
+	<< ", contains (0) = " << std::boolalpha << timers.contains(0) << ", priority (2) = " << timers.priority(2)
+	<< std::endl;
+	try
+	{
+		timers.decrease_key(3, 500);
+	}
+	catch (const std::invalid_argument &e)
+	{
+		std::cout << "decrease_key to a lower priority : " << e.what() << " exception thrown" << std::endl;
+	}
+	std::cout << "ids by priority :";
+	while (timers.empty() == false)
+	{
+		std::cout << " " << timers.top_id();
+		timers.pop();
+	}
+	std::cout << std::endl;
+	std::srand(42);
+	for (int v = 0; v < side * side; v++)
+	{
+		w[v][0] = (v % side != side - 1 ? 1 + std::rand() % 9 : 0);
+		w[v][1] = (v % side != 0 ? 1 + std::rand() % 9 : 0);
+		w[v][2] = (v / side != side - 1 ? 1 + std::rand() % 9 : 0);
+		w[v][3] = (v / side != 0 ? 1 + std::rand() % 9 : 0);
+	}
+	std::cout << "Dijkstra on a grid of " << side * side << " vertices with decrease_key, same distances as "
+	<< "without heap = " << (dijkstra(w, side, true) == dijkstra(w, side, false)) << std::endl;
+}
+
+void	adapters_verif_procedure(Colors &col)
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing stack, queue and priority queues..." << col.reset() << std::endl;
+	separator(col);
+	test_stack(col);
+	test_queue(col);
+	test_priority_queue(col);
+	test_indexed_priority_queue(col);
+	separator(col);
+	std::cout << col.bdYellow() << "End of stack, queue and priority queues tests" << col.reset() << std::endl;
+	separator(col);
+}
@@ -0,0 +1,184 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heap_speedtests.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:45:07 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 08:10:13 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include "../test_utils/benchmark.hpp"
+#include <queue>
+#include <algorithm>
+#include <functional>
+#include <sstream>
+
+/* speedtests of the d-ary ft::priority_queue against std::priority_queue (a binary heap) on timer
+events : the hold model pops the next event and schedules a new one later, on a heap of 1K events (in
+the L1 cache) then 4M events (out of every cache). The indexed_priority_queue reschedules the top with
+update instead of a pop and a push. Then the O(n) construction of a heap from a vector of 4M events */
+
+typedef std::greater<int>	event_order; // the earliest event on top
+
+static const std::size_t	g_hold_ops = 2000000;
+static const std::size_t	g_heap_sizes[] = {1000, 4000000};
+
+/* delay of the next event, from a LCG : the events interleave */
+static int	next_delay(unsigned int &seed)
+{
+	seed = seed * 1103515245u + 12345u;
+	return (1 + static_cast<int>((seed >> 16) % 1000));
+}
+
+/* the heap of events, and one hold : the top is popped and rescheduled */
+template <class Heap>
+struct hold_model
+{
+	Heap	heap;
+
+	void	fill(std::size_t n, unsigned int &seed)
+	{
+		for (std::size_t i = 0; i < n; i++)
+			this->heap.push(next_delay(seed));
+	}
+
+	int		hold(unsigned int &seed)
+	{
+		int		now = this->heap.top();
+
+		this->heap.pop();
+		this->heap.push(now + next_delay(seed));
+		return (now);
+	}
+};
+
+template <class T, class C, std::size_t A>
+struct hold_model<ft::indexed_priority_queue<T, C, A> >
+{
+	ft::indexed_priority_queue<T, C, A>		heap;
+
+	void	fill(std::size_t n, unsigned int &seed)
+	{
+		for (std::size_t i = 0; i < n; i++)
+			this->heap.push(i, next_delay(seed));
+	}
+
+	int		hold(unsigned int &seed)
+	{
+		int		now = this->heap.top();
+
+		this->heap.update(this->heap.top_id(), now + next_delay(seed));
+		return (now);
+	}
+};
+
+/* benchmark task : the heap is filled by setUp, operator() does g_hold_ops holds */
+template <class Heap>
+class hold_task
+{
+	public:
+
+		hold_task(std::size_t size) : _size(size), _seed(0) {}
+
+		void	setUp(void)
+		{
+			this->_model = hold_model<Heap>();
+			this->_seed = 42;
+			this->_model.fill(this->_size, this->_seed);
+		}
+
+		void	operator()(void)
+		{
+			long	sum = 0;
+
+			for (std::size_t i = 0; i < g_hold_ops; i++)
+				sum += this->_model.hold(this->_seed);
+			doNotOptimize(sum);
+		}
+
+	private:
+
+		hold_model<Heap>	_model;
+		std::size_t			_size;
+		unsigned int		_seed;
+};
+
+/* benchmark task : builds a heap from a vector of events with the constructor (comp, container) */
+template <class Heap, class Vector>
+class build_task
+{
+	public:
+
+		build_task(std::size_t size) : _events(), _size(size) {}
+
+		void	setUp(void)
+		{
+			unsigned int	seed = 42;
+
+			this->_events = Vector();
+			for (std::size_t i = 0; i < this->_size; i++)
+				this->_events.push_back(next_delay(seed));
+		}
+
+		void	operator()(void)
+		{
+			Heap	heap(event_order(), this->_events);
+
+			doNotOptimize(heap.top());
+		}
+
+	private:
+
+		Vector			_events;
+		std::size_t		_size;
+};
+
+void	heap_speedtest(Colors &col)
+{
+	typedef std::priority_queue<int, std::vector<int>, event_order>				std_heap;
+	typedef ft::priority_queue<int, ft::vector<int>, event_order, 2>			binary_heap;
+	typedef ft::priority_queue<int, ft::vector<int>, event_order, 4>			quaternary_heap;
+	typedef ft::priority_queue<int, ft::vector<int>, event_order, 8>			octonary_heap;
+	typedef ft::indexed_priority_queue<int, event_order, 4>						indexed_heap;
+	Benchmark																	ft_bench(col, "ft::priority_queue");
+	Benchmark																	std_bench(col, "std::priority_queue");
+
+	std::cout << col.bdYellow() << "Starting speedtest for d-ary heaps..." << col.reset() << std::endl;
+	for (std::size_t s = 0; s < sizeof(g_heap_sizes) / sizeof(g_heap_sizes[0]); s++)
+	{
+		std::ostringstream			suffix;
+		hold_task<std_heap>			std_task(g_heap_sizes[s]);
+		hold_task<binary_heap>		binary_task(g_heap_sizes[s]);
+		hold_task<quaternary_heap>	quaternary_task(g_heap_sizes[s]);
+		hold_task<octonary_heap>	octonary_task(g_heap_sizes[s]);
+		hold_task<indexed_heap>		indexed_task(g_heap_sizes[s]);
+
+		suffix << ", " << g_heap_sizes[s] << " events";
+		separator(col);
+		std::cout << "testing " << g_hold_ops << " holds (pop the next event, push a later one) on a heap of "
+		<< g_heap_sizes[s] << " events..." << std::endl;
+		BenchmarkResult		std_res = std_bench.run("hold" + suffix.str(), std_task, g_hold_ops);
+		ft_bench.compare(ft_bench.run("hold, 2-ary" + suffix.str(), binary_task, g_hold_ops), std_res);
+		ft_bench.compare(ft_bench.run("hold, 4-ary" + suffix.str(), quaternary_task, g_hold_ops), std_res);
+		ft_bench.compare(ft_bench.run("hold, 8-ary" + suffix.str(), octonary_task, g_hold_ops), std_res);
+		ft_bench.compare(ft_bench.run("hold, indexed 4-ary (update of the top)" + suffix.str(), indexed_task,
+			g_hold_ops), std_res);
+	}
+	{
+		const std::size_t									size = g_heap_sizes[1];
+		build_task<std_heap, std::vector<int> >				std_build(size);
+		build_task<quaternary_heap, ft::vector<int> >		quaternary_build(size);
+		build_task<octonary_heap, ft::vector<int> >			octonary_build(size);
+
+		separator(col);
+		std::cout << "testing the construction of a heap from a vector of " << size << " events..." << std::endl;
+		BenchmarkResult		std_res = std_bench.run("make heap", std_build, size);
+		ft_bench.compare(ft_bench.run("make heap, 4-ary", quaternary_build, size), std_res);
+		ft_bench.compare(ft_bench.run("make heap, 8-ary", octonary_build, size), std_res);
+	}
+	std::cout << col.bdYellow() << "End of speedtest for d-ary heaps" << col.reset() << std::endl;
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque_speedtests.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:34:39 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:38:00 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include "../test_utils/benchmark.hpp"
+#include <deque>
+
+/* speedtests of ft::deque against std::deque : growth at both ends, a FIFO queue (push_back and
+pop_front, the block emptied at the front is taken back at the back from the free list), random
+access and iteration. The memory part counts the allocations of the FIFO queue */
+
+enum e_deque_feature
+{
+	DEQUE_PUSH_BACK,
+	DEQUE_PUSH_FRONT,
+	DEQUE_FIFO,
+	DEQUE_RANDOM_ACCESS,
+	DEQUE_ITERATION,
+	DEQUE_FEATURES
+};
+
+static const char	*g_deque_features[DEQUE_FEATURES] = {
+	"push_back",
+	"push_front",
+	"FIFO queue of 1000 elements (push_back, pop_front)",
+	"random access (operator[])",
+	"iteration (begin to end)"
+};
+
+static const std::size_t	g_deque_size = 4000000;
+static const std::size_t	g_fifo_length = 1000;
+
+/* benchmark task : the deque is built by setUp for the features reading it */
+template <class Deque>
+class deque_task
+{
+	public:
+
+		deque_task(void) : _feature(DEQUE_PUSH_BACK) {}
+
+		void	feature(int f) { this->_feature = f; }
+
+		void	setUp(void)
+		{
+			Deque	empty;
+
+			this->_deque.swap(empty);
+			if (this->_feature == DEQUE_FIFO)
+				this->_deque.resize(g_fifo_length, 0);
+			else if (this->_feature >= DEQUE_RANDOM_ACCESS)
+				for (std::size_t i = 0; i < g_deque_size; i++)
+					this->_deque.push_back(static_cast<int>(i));
+		}
+
+		void	operator()(void)
+		{
+			std::size_t		sum = 0;
+
+			switch (this->_feature)
+			{
+				case DEQUE_PUSH_BACK:
+					for (std::size_t i = 0; i < g_deque_size; i++)
+						this->_deque.push_back(static_cast<int>(i));
+					break ;
+				case DEQUE_PUSH_FRONT:
+					for (std::size_t i = 0; i < g_deque_size; i++)
+						this->_deque.push_front(static_cast<int>(i));
+					break ;
+				case DEQUE_FIFO:
+					for (std::size_t i = 0; i < g_deque_size; i++)
+					{
+						this->_deque.push_back(static_cast<int>(i));
+						sum += this->_deque.front();
+						this->_deque.pop_front();
+					}
+					break ;
+				case DEQUE_RANDOM_ACCESS:
+					for (std::size_t i = 0, j = 0; i < g_deque_size; i++, j = (j + 7919) % g_deque_size)
+						sum += this->_deque[j];
+					break ;
+				case DEQUE_ITERATION:
+					for (typename Deque::iterator it = this->_deque.begin(); it != this->_deque.end(); ++it)
+						sum += *it;
+					break ;
+			}
+			doNotOptimize(sum);
+			doNotOptimize(this->_deque.size());
+		}
+
+	private:
+
+		Deque	_deque;
+		int		_feature;
+};
+
+void	deque_speedtest(Colors &col)
+{
+	Benchmark									ft_bench(col, "ft::deque");
+	Benchmark									std_bench(col, "std::deque");
+	deque_task<ft::deque<int> >					ft_task;
+	deque_task<std::deque<int> >				std_task;
+
+	std::cout << col.bdYellow() << "Starting speedtest for deques..." << col.reset() << std::endl;
+	{
+		deque_task<ft::deque<int, ft::counting_allocator<int> > >		ft_fifo;
+		deque_task<std::deque<int, ft::counting_allocator<int> > >		std_fifo;
+
+		ft_fifo.feature(DEQUE_FIFO);
+		std_fifo.feature(DEQUE_FIFO);
+		std::cout << "memory of a FIFO queue of " << g_fifo_length << " elements through " << g_deque_size
+		<< " pushes, ft::deque then std::deque..." << std::endl;
+		ft_bench.memory(ft_fifo, g_deque_size, g_fifo_length);
+		std_bench.memory(std_fifo, g_deque_size, g_fifo_length);
+	}
+	for (int f = 0; f < DEQUE_FEATURES; f++)
+	{
+		std::string		name = g_deque_features[f];
+
+		separator(col);
+		std::cout << "testing " << name << " on " << g_deque_size << " elements..." << std::endl;
+		ft_task.feature(f);
+		std_task.feature(f);
+		BenchmarkResult		ft_res = ft_bench.run(name, ft_task, g_deque_size);
+		BenchmarkResult		std_res = std_bench.run(name, std_task, g_deque_size);
+		ft_bench.compare(ft_res, std_res);
+	}
+	std::cout << col.bdYellow() << "End of speedtest for deques" << col.reset() << std::endl;
+}
@@ -0,0 +1,287 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque_tests.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:34:22 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:38:00 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include <deque>
+#include <string>
+#include <cstdlib>
+
+/* These tests compare ft::deque to std::deque : both are printed side by side, or compared after the
+same operations.
+
+I) Constructors and assignation
+II) Iterators (arithmetics across the blocks, reverse and const iterators)
+III) Both ends : push and pop, references kept valid by push_back and push_front
+IV) Insert and erase in the middle
+V) Random operations against std::deque, non-member function overloads */
+
+template <class Deque>
+static void	print_deque(const std::string &name, const Deque &deq)
+{
+	std::cout << name << " (size " << deq.size() << ") :";
+	for (typename Deque::const_iterator it = deq.begin(); it != deq.end(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
+
+template <class T>
+static bool	same_content(const ft::deque<T> &ft_deq, const std::deque<T> &std_deq)
+{
+	if (ft_deq.size() != std_deq.size())
+		return (false);
+	for (std::size_t i = 0; i < std_deq.size(); i++)
+		if (!(ft_deq[i] == std_deq[i]))
+			return (false);
+	return (true);
+}
+
+/* I - CONSTRUCTORS */
+
+static void	test_constructors(Colors &col)
+{
+	std::cout << col.bdBlue() << "test constructors..." << col.reset() << std::endl;
+
+	ft::deque<int>				empty;
+	ft::deque<int>				fill(5, 42);
+	std::deque<int>				std_fill(5, 42);
+	int							values[] = {1, 2, 3, 4, 5, 6, 7};
+	ft::deque<int>				range(values, values + 7);
+	ft::deque<int>				copy(range);
+	ft::deque<std::string>		words(3, "block");
+
+	std::cout << "empty : size = " << empty.size() << ", empty = " << std::boolalpha << empty.empty() << std::endl;
+	print_deque("ft::deque (5, 42)", fill);
+	print_deque("std::deque (5, 42)", std_fill);
+	print_deque("ft::deque (first, last)", range);
+	print_deque("copy", copy);
+	print_deque("ft::deque<std::string> (3, \"block\")", words);
+	copy = fill;
+	print_deque("copy = ft::deque (5, 42)", copy);
+	copy.assign(values + 2, values + 5);
+	print_deque("copy.assign (3, 4, 5)", copy);
+}
+
+/* II - ITERATORS */
+
+static void	test_iterators(Colors &col)
+{
+	std::cout << col.bdBlue() << "test iterators..." << col.reset() << std::endl;
+
+	const std::size_t					block = ft::deque_block_size<int>::value;
+	ft::deque<int>						deq;
+	ft::deque<int>::iterator			it;
+	ft::deque<int>::const_iterator		cit;
+
+	for (std::size_t i = 0; i < 3 * block + 10; i++)
+		deq.push_back(i);
+	for (std::size_t i = 0; i < 5; i++)
+		deq.push_front(-1 - i);
+	std::cout << "elements per block = " << block << ", size = " << deq.size() << std::endl;
+	std::cout << "end - begin = " << deq.end() - deq.begin() << std::endl;
+	it = deq.begin() + block;
+	std::cout << "*(begin + " << block << ") = " << *it << ", it[-6] = " << it[-6] << ", *(it - " << block
+	<< ") = " << *(it - block) << std::endl;
+	it += 2 * block;
+	std::cout << "*(it += " << 2 * block << ") = " << *it << ", end - it = " << deq.end() - it << std::endl;
+	cit = it;
+	std::cout << "const_iterator from iterator : " << *cit << ", cit == it = " << std::boolalpha << (cit == it)
+	<< ", begin < cit = " << (deq.begin() < cit) << std::endl;
+
+	std::size_t		steps = 0;
+
+	for (ft::deque<int>::iterator i = deq.begin(); i != deq.end(); ++i)
+		steps++;
+	std::cout << "++ from begin to end : " << steps << " steps" << std::endl;
+	steps = 0;
+	for (ft::deque<int>::iterator i = deq.end(); i != deq.begin(); --i)
+		steps++;
+	std::cout << "-- from end to begin : " << steps << " steps" << std::endl;
+	std::cout << "reverse : *rbegin = " << *deq.rbegin() << ", *(rend - 1) = " << *(deq.rend() - 1)
+	<< ", rend - rbegin = " << deq.rend() - deq.rbegin() << std::endl;
+}
+
+/* III - BOTH ENDS */
+
+static void	test_ends(Colors &col)
+{
+	std::cout << col.bdBlue() << "test push and pop at both ends..." << col.reset() << std::endl;
+
+	ft::deque<std::string>		deq;
+	std::deque<std::string>		ref;
+
+	for (int i = 0; i < 20000; i++)
+	{
+		std::string		val(1, 'a' + i % 26);
+
+		if (i % 3 == 0)
+		{
+			deq.push_front(val);
+			ref.push_front(val);
+		}
+		else
+		{
+			deq.push_back(val);
+			ref.push_back(val);
+		}
+	}
+	std::cout << "front = " << deq.front() << " (std : " << ref.front() << "), back = " << deq.back()
+	<< " (std : " << ref.back() << ")" << std::endl;
+	for (int i = 0; i < 5000; i++)
+	{
+		deq.pop_front();
+		ref.pop_front();
+		deq.pop_back();
+		ref.pop_back();
+	}
+	std::cout << "after 5000 pop_front and pop_back, same content as std::deque = " << std::boolalpha
+	<< same_content(deq, ref) << std::endl;
+	try
+	{
+		deq.at(deq.size());
+	}
+	catch (const std::out_of_range &e)
+	{
+		std::cout << "at (size) : " << e.what() << " exception thrown" << std::endl;
+	}
+
+	ft::deque<int>		stable;
+	int					*first;
+	int					*last;
+
+	stable.push_back(1);
+	first = &stable.front();
+	last = &stable.back();
+	for (int i = 0; i < 100000; i++)
+	{
+		stable.push_back(i);
+		stable.push_front(-i);
+	}
+	std::cout << "address of the first element kept by 200000 pushes = " << std::boolalpha
+	<< (first == &stable[100000] && last == first) << ", value = " << *first << std::endl;
+	stable.clear();
+	std::cout << "clear : size = " << stable.size() << ", empty = " << stable.empty() << std::endl;
+	stable.shrink_to_fit();
+	stable.resize(4, 7);
+	print_deque("resize (4, 7) after clear", stable);
+}
+
+/* IV - INSERT AND ERASE */
+
+static void	test_insert_erase(Colors &col)
+{
+	std::cout << col.bdBlue() << "test insert and erase..." << col.reset() << std::endl;
+
+	ft::deque<int>			deq;
+	std::deque<int>			ref;
+	int						values[] = {100, 200, 300};
+
+	for (int i = 0; i < 10; i++)
+	{
+		deq.push_back(i);
+		ref.push_back(i);
+	}
+	std::cout << "insert (begin + 2, 42) returns " << *deq.insert(deq.begin() + 2, 42) << std::endl;
+	ref.insert(ref.begin() + 2, 42);
+	deq.insert(deq.end() - 1, 3, 7);
+	ref.insert(ref.end() - 1, 3, 7);
+	deq.insert(deq.begin() + 5, values, values + 3);
+	ref.insert(ref.begin() + 5, values, values + 3);
+	print_deque("ft::deque ", deq);
+	print_deque("std::deque", ref);
+	std::cout << "erase (begin + 1) returns " << *deq.erase(deq.begin() + 1) << std::endl;
+	ref.erase(ref.begin() + 1);
+	deq.erase(deq.end() - 5, deq.end() - 2);
+	ref.erase(ref.end() - 5, ref.end() - 2);
+	print_deque("ft::deque ", deq);
+	print_deque("std::deque", ref);
+}
+
+/* V - RANDOM OPERATIONS AND NON-MEMBER OVERLOADS */
+
+static void	test_random(Colors &col)
+{
+	std::cout << col.bdBlue() << "test random operations against std::deque..." << col.reset() << std::endl;
+
+	ft::deque<int>		deq;
+	std::deque<int>		ref;
+	std::size_t			errors = 0;
+
+	std::srand(42);
+	for (int i = 0; i < 200000; i++)
+	{
+		int		op = std::rand() % 10;
+		int		val = std::rand();
+
+		if (op < 3)
+		{
+			deq.push_back(val);
+			ref.push_back(val);
+		}
+		else if (op < 6)
+		{
+			deq.push_front(val);
+			ref.push_front(val);
+		}
+		else if (op < 8 && ref.empty() == false)
+		{
+			deq.pop_back();
+			ref.pop_back();
+		}
+		else if (op < 9 && ref.empty() == false)
+		{
+			deq.pop_front();
+			ref.pop_front();
+		}
+		else if (ref.size() < 1000)
+		{
+			std::size_t		pos = std::rand() % (ref.size() + 1);
+
+			deq.insert(deq.begin() + pos, val);
+			ref.insert(ref.begin() + pos, val);
+		}
+		else
+		{
+			std::size_t		pos = std::rand() % ref.size();
+
+			deq.erase(deq.begin() + pos);
+			ref.erase(ref.begin() + pos);
+		}
+		if (i % 1000 == 0 && same_content(deq, ref) == false)
+			errors++;
+	}
+	std::cout << "size = " << deq.size() << ", differences with std::deque = " << errors + !same_content(deq, ref)
+	<< std::endl;
+
+	ft::deque<int>		other(deq);
+
+	std::cout << "copy == deque = " << std::boolalpha << (other == deq) << std::endl;
+	other.push_back(0);
+	std::cout << "after push_back : copy == deque = " << (other == deq) << ", deque < copy = " << (deq < other)
+	<< ", copy >= deque = " << (other >= deq) << std::endl;
+	swap(other, deq);
+	std::cout << "after swap : sizes = " << other.size() << " and " << deq.size() << std::endl;
+}
+
+void	deque_verif_procedure(Colors &col)
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing deque..." << col.reset() << std::endl;
+	separator(col);
+	test_constructors(col);
+	test_iterators(col);
+	test_ends(col);
+	test_insert_erase(col);
+	test_random(col);
+	separator(col);
+	std::cout << col.bdYellow() << "End of deque tests" << col.reset() << std::endl;
+	separator(col);
+}
@@ -0,0 +1,255 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_speedtests.cpp                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:31:20 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 08:10:25 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/* multithreaded speedtests for maps. clock() adds up the CPU time of all threads, so the wall time is
+measured with clock_gettime (POSIX) instead. Each thread runs the same number of operations on
+random keys (its own xorshift generator, rand() being shared), the result is the total throughput.
+One operation out of 16 is timed alone in the histogram of its thread, merged after the join */
+
+/* the reference : one map behind a single mutex */
+class	locked_map
+{
+	public:
+
+		locked_map(void) { pthread_mutex_init(&this->_lock, nullptr); }
+		~locked_map() { pthread_mutex_destroy(&this->_lock); }
+
+		bool	lookup(const int &k, int &out)
+		{
+			bool	found;
+
+			pthread_mutex_lock(&this->_lock);
+			ft::map<int, int>::iterator		it = this->_map.find(k);
+			found = (it != this->_map.end());
+			if (found)
+				out = it->second;
+			pthread_mutex_unlock(&this->_lock);
+			return (found);
+		}
+
+		bool	insert(const ft::pair<const int, int> &val)
+		{
+			bool	inserted;
+
+			pthread_mutex_lock(&this->_lock);
+			inserted = this->_map.insert(val).second;
+			pthread_mutex_unlock(&this->_lock);
+			return (inserted);
+		}
+
+		std::size_t	erase(const int &k)
+		{
+			std::size_t		erased;
+
+			pthread_mutex_lock(&this->_lock);
+			erased = this->_map.erase(k);
+			pthread_mutex_unlock(&this->_lock);
+			return (erased);
+		}
+
+	private:
+
+		pthread_mutex_t		_lock;
+		ft::map<int, int>	_map;
+};
+
+/* the lock-free skip list, with the same interface as the two others */
+class	skiplist_map
+{
+	public:
+
+		bool	lookup(const int &k, int &out)
+		{
+			ft::concurrent_skiplist_map<int, int>::guard			guard(this->_map);
+			ft::concurrent_skiplist_map<int, int>::iterator		it = this->_map.find(k);
+
+			if (it == this->_map.end())
+				return (false);
+			out = it->second;
+			return (true);
+		}
+
+		bool	insert(const ft::pair<const int, int> &val) { return (this->_map.insert(val).second); };
+		std::size_t	erase(const int &k) { return (this->_map.erase(k)); };
+
+	private:
+
+		ft::concurrent_skiplist_map<int, int>	_map;
+};
+
+/* what a thread has to do, and what it found */
+template <class Target>
+struct	worker_job
+{
+	Target			*target;
+	unsigned int	seed;
+	std::size_t		ops;
+	int				key_range;
+	int				read_percent; // the rest is split between insertions and erasures
+	std::size_t		hits;
+	double			overhead; // of a Benchmark::now() call
+	LatencyHistogram	latency;
+};
+
+static double	wall_time(void)
+{
+	struct timespec		ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static unsigned int	xorshift(unsigned int &state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return (state);
+}
+
+template <class Target>
+static void	*worker(void *arg)
+{
+	worker_job<Target>	*job = static_cast<worker_job<Target>*>(arg);
+	unsigned int		state = job->seed;
+	int					value;
+
+	double				start = 0;
+	double				duration;
+
+	for (std::size_t i = 0; i < job->ops; i++)
+	{
+		int		key = xorshift(state) % job->key_range;
+		int		dice = xorshift(state) % 100;
+
+		if (i % 16 == 0)
+			start = Benchmark::now();
+		if (dice < job->read_percent)
+			job->hits += job->target->lookup(key, value);
+		else if (dice % 2)
+			job->hits += job->target->insert(ft::make_pair<const int, int>(key, key));
+		else
+			job->hits += job->target->erase(key);
+		if (i % 16 == 0)
+		{
+			duration = Benchmark::now() - start;
+			job->latency.record(duration > job->overhead ? duration - job->overhead : 0);
+		}
+	}
+	return (nullptr);
+}
+
+/* runs threads workers on target, returns the throughput in millions of operations per second.
+The latencies sampled by the threads are merged in latency */
+template <class Target>
+static double	run_workers(Target &target, int threads, std::size_t ops, int key_range,
+	int read_percent, std::size_t &hits, LatencyHistogram &latency)
+{
+	double								overhead = Benchmark::timerOverhead();
+	std::vector<pthread_t>				ids(threads);
+	std::vector<worker_job<Target> >	jobs(threads);
+	double								start;
+	double								duration;
+
+	for (int i = 0; i < threads; i++)
+	{
+		jobs[i].target = &target;
+		jobs[i].seed = 2463534242U + i * 7919;
+		jobs[i].ops = ops;
+		jobs[i].key_range = key_range;
+		jobs[i].read_percent = read_percent;
+		jobs[i].hits = 0;
+		jobs[i].overhead = overhead;
+	}
+	start = wall_time();
+	for (int i = 0; i < threads; i++)
+		pthread_create(&ids[i], nullptr, &worker<Target>, &jobs[i]);
+	for (int i = 0; i < threads; i++)
+	{
+		pthread_join(ids[i], nullptr);
+		hits += jobs[i].hits;
+		latency.merge(jobs[i].latency);
+	}
+	duration = wall_time() - start;
+	return ((double)ops * threads / duration / 1e6);
+}
+
+/* fills half of the key range (the even keys), like a service already running. The keys come in a
+scrambled order : in order, they would turn the unbalanced tree of ft::map into a list */
+template <class Target>
+static void	prefill(Target &target, int key_range)
+{
+	const long	count = key_range / 2;
+	const long	stride = 7919; // a prime : i * stride % count visits every index once, unless it divides count
+
+	for (long i = 0; i < count; i++)
+	{
+		int		k = static_cast<int>((count % stride ? i * stride % count : i) * 2);
+
+		target.insert(ft::make_pair<const int, int>(k, k));
+	}
+}
+
+/* compares a map behind one mutex with a sharded map (16 shards) and a lock-free skip list, from 1 thread up to the number of
+online CPUs (doubling), with a read-mostly (90% lookups) and a write-heavy (50% lookups) mix */
+void	concurrent_map_speedtest(Colors &col)
+{
+	const std::size_t	ops = 1000000; // per thread
+	const int			key_range = 1000000;
+	const int			mixes[2] = {90, 50};
+	long				cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	std::size_t			hits = 0;
+
+	std::cout << col.bdYellow() << "Starting concurrent speedtest for maps..." << col.reset() << std::endl;
+	if (cpus < 1)
+		cpus = 1;
+	for (int m = 0; m < 2; m++)
+	{
+		separator(col);
+		std::cout << mixes[m] << "% lookups, " << (100 - mixes[m]) << "% insertions and erasures, "
+		<< ops << " operations per thread (throughput in Mops/s)" << std::endl;
+		for (int threads = 1; threads <= cpus; threads *= 2)
+		{
+			locked_map						locked;
+			ft::sharded_map<int, int, 16>	sharded;
+			skiplist_map					skiplist;
+			double							locked_rate;
+			double							sharded_rate;
+			double							skiplist_rate;
+			LatencyHistogram				latency[3];
+
+			prefill(locked, key_range);
+			prefill(sharded, key_range);
+			prefill(skiplist, key_range);
+			locked_rate = run_workers(locked, threads, ops, key_range, mixes[m], hits, latency[0]);
+			sharded_rate = run_workers(sharded, threads, ops, key_range, mixes[m], hits, latency[1]);
+			skiplist_rate = run_workers(skiplist, threads, ops, key_range, mixes[m], hits, latency[2]);
+			std::cout << col.bdYellow() << threads << " thread(s) : map + mutex " << locked_rate
+			<< ", sharded_map " << sharded_rate << " (x" << sharded_rate / locked_rate << ")"
+			<< ", concurrent_skiplist_map " << skiplist_rate << " (x" << skiplist_rate / locked_rate << ")"
+			<< col.end() << std::endl;
+			std::cout << "    p99 / p99.9 latency (ns) : map + mutex " << latency[0].percentile(99) << " / "
+			<< latency[0].percentile(99.9) << ", sharded_map " << latency[1].percentile(99) << " / "
+			<< latency[1].percentile(99.9) << ", concurrent_skiplist_map " << latency[2].percentile(99) << " / "
+			<< latency[2].percentile(99.9) << std::endl;
+			if (threads * 2 > cpus && threads != cpus)
+				threads = cpus / 2; // the last round uses every CPU
+		}
+	}
+	separator(col);
+	std::cout << "hits (not a result, prevents the operations to be optimized out) : " << hits << std::endl;
+}
@@ -6,14 +6,624 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/01 16:34:51 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/15 17:43:51 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:10:25 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "../includes/test_includes.hpp"
+#include "../../includes/test_includes.hpp"
+#include "../test_utils/benchmark.hpp"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <time.h>
+#include <stdlib.h>
+
+/* includes speedtests for maps. The operations speedtest is measured by the Benchmark harness (see
+test_utils/benchmark.hpp), the others use the C style clock in the header <time.h>, std::chrono being C++11 */
+
+/* print the result of the test */
+static void	speedtest_result(Colors &col, std::string feature, double duration)
+{
+	std::cout << col.bdYellow() << "The time necessary for the " << feature << " feature is " 
+	<< duration << col.end() << std::endl;
+}
+
+/* compares a loop of single find calls with find_many and count_many, with a batch of 10.000 keys
+looked up 100 times in a map of 1.000.000 random keys. Half of the batch keys are missing.
+The batch is tested twice : in random order (interleaved descents) and sorted (merge walk) */
+static void	batch_lookup_speedtest(Colors &col)
+{
+	const std::size_t						map_size = 1000000;
+	const std::size_t						batch_size = 10000;
+	const std::size_t						rounds = 100;
+	ft::map<int, int>						test;
+	std::vector<int>						batch;
+	std::vector<ft::map<int, int>::iterator>	res(batch_size);
+	std::vector<std::size_t>				counts(batch_size);
+	std::size_t								hits = 0;
+	clock_t									t;
+	double									exec_time;
+
+	std::cout << col.bdYellow() << "Starting batch lookup speedtest for maps..." << col.reset() << std::endl;
+	srand(42);
+	for (std::size_t i = 0; i < map_size; i++)
+		test.insert(ft::make_pair<int, int>((rand() % (RAND_MAX / 2)) * 2, i)); // even keys only
+	for (std::size_t i = 0; i < batch_size; i++)
+		batch.push_back((rand() % (RAND_MAX / 2)) * 2 + (i % 2)); // odd keys are always missing
+
+	for (int sorted = 0; sorted < 2; sorted++)
+	{
+		if (sorted)
+			std::sort(batch.begin(), batch.end());
+		std::cout << "testing " << (sorted ? "a sorted" : "an unsorted") << " batch of "
+		<< batch_size << " keys, " << rounds << " times..." << std::endl;
+
+		t = clock();
+		for (std::size_t r = 0; r < rounds; r++)
+			for (std::size_t i = 0; i < batch_size; i++)
+				res[i] = test.find(batch[i]);
+		t = clock() - t;
+		exec_time = ((double)t)/CLOCKS_PER_SEC;
+		speedtest_result(col, "loop of single find", exec_time);
+
+		t = clock();
+		for (std::size_t r = 0; r < rounds; r++)
+			test.find_many(batch.begin(), batch.end(), res.begin());
+		t = clock() - t;
+		exec_time = ((double)t)/CLOCKS_PER_SEC;
+		speedtest_result(col, "find_many", exec_time);
+
+		t = clock();
+		for (std::size_t r = 0; r < rounds; r++)
+			test.count_many(batch.begin(), batch.end(), counts.begin());
+		t = clock() - t;
+		exec_time = ((double)t)/CLOCKS_PER_SEC;
+		speedtest_result(col, "count_many", exec_time);
+
+		for (std::size_t i = 0; i < batch_size; i++) // keeps the results alive
+			hits += counts[i] + (res[i] != test.end());
+		separator(col);
+	}
+	std::cout << "hits (not a result, prevents the lookups to be optimized out) : " << hits << std::endl;
+}
+
+/* compares the lookup latency of a map of 1.000.000 random keys with its frozen copies (Eytzinger and
+van Emde Boas layouts), with 10.000.000 random lookups (half of them on missing keys). Also prints
+the memory used by the nodes of the map and by the arrays of the frozen maps */
+static void	frozen_map_speedtest(Colors &col)
+{
+	typedef ft::map<int, int>::binary_tree::node	node;
+
+	const std::size_t						map_size = 1000000;
+	const std::size_t						lookups = 10000000;
+	ft::map<int, int>						test;
+	std::vector<int>						keys;
+	std::size_t								hits = 0;
+	clock_t									t;
+	double									exec_time;
+
+	std::cout << col.bdYellow() << "Starting frozen map speedtest..." << col.reset() << std::endl;
+	srand(42);
+	for (std::size_t i = 0; i < map_size; i++)
+		test.insert(ft::make_pair<int, int>((rand() % (RAND_MAX / 2)) * 2, i));
+	for (std::size_t i = 0; i < lookups; i++)
+		keys.push_back((rand() % (RAND_MAX / 2)) * 2 + (i % 2));
+
+	ft::frozen_map<int, int>				eytzinger(test, ft::frozen_map<int, int>::EYTZINGER);
+	ft::frozen_map<int, int>				veb(test, ft::frozen_map<int, int>::VAN_EMDE_BOAS);
+
+	std::cout << "memory used by the map nodes         : " << test.size() * sizeof(node) << " bytes" << std::endl;
+	std::cout << "memory used by the Eytzinger layout  : " << eytzinger.footprint() << " bytes" << std::endl;
+	std::cout << "memory used by the van Emde Boas one : " << veb.footprint() << " bytes" << std::endl;
+	separator(col);
+
+	std::cout << "testing " << lookups << " lookups with find..." << std::endl;
+	t = clock();
+	for (std::size_t i = 0; i < lookups; i++)
+		hits += (test.find(keys[i]) != test.end());
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "map find", exec_time);
+
+	t = clock();
+	for (std::size_t i = 0; i < lookups; i++)
+		hits += (eytzinger.find(keys[i]) != eytzinger.end());
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "frozen map find (Eytzinger)", exec_time);
+
+	t = clock();
+	for (std::size_t i = 0; i < lookups; i++)
+		hits += (veb.find(keys[i]) != veb.end());
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "frozen map find (van Emde Boas)", exec_time);
+	separator(col);
+
+	std::cout << "testing " << lookups << " lookups with lower_bound..." << std::endl;
+	t = clock();
+	for (std::size_t i = 0; i < lookups; i++)
+		hits += (test.lower_bound(keys[i]) != test.end());
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "map lower_bound", exec_time);
+
+	t = clock();
+	for (std::size_t i = 0; i < lookups; i++)
+		hits += (eytzinger.lower_bound(keys[i]) != eytzinger.end());
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "frozen map lower_bound (Eytzinger)", exec_time);
+
+	t = clock();
+	for (std::size_t i = 0; i < lookups; i++)
+		hits += (veb.lower_bound(keys[i]) != veb.end());
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "frozen map lower_bound (van Emde Boas)", exec_time);
+	separator(col);
+	std::cout << "hits (not a result, prevents the lookups to be optimized out) : " << hits << std::endl;
+}
+
+/* compares insertions and erasures in a persistent map (path copying) with the ones of a map,
+then measures the cost of a snapshot and of updates made while 100 snapshots are held */
+static void	persistent_map_speedtest(Colors &col)
+{
+	const std::size_t						map_size = 1000000;
+	const std::size_t						snapshots = 1000000;
+	ft::map<int, int>						test;
+	ft::persistent_map<int, int>			persistent;
+	std::vector<ft::persistent_map<int, int> >	held;
+	std::vector<int>						keys;
+	std::size_t								total = 0;
+	clock_t									t;
+	double									exec_time;
+
+	std::cout << col.bdYellow() << "Starting persistent map speedtest..." << col.reset() << std::endl;
+	srand(42);
+	for (std::size_t i = 0; i < map_size; i++)
+		keys.push_back(rand());
+
+	std::cout << "testing insertion of " << map_size << " random keys..." << std::endl;
+	t = clock();
+	for (std::size_t i = 0; i < map_size; i++)
+		test.insert(ft::make_pair<int, int>(keys[i], i));
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "map insert", exec_time);
+
+	t = clock();
+	for (std::size_t i = 0; i < map_size; i++)
+		persistent.insert(ft::make_pair<const int, int>(keys[i], i));
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "persistent map insert", exec_time);
+	separator(col);
+
+	std::cout << "testing " << snapshots << " snapshots of the persistent map..." << std::endl;
+	t = clock();
+	for (std::size_t i = 0; i < snapshots; i++)
+	{
+		ft::persistent_map<int, int>	snap = persistent.snapshot();
+
+		total += snap.size();
+	}
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "snapshot", exec_time);
+	separator(col);
+
+	std::cout << "testing erasure of half the keys, with and without 100 snapshots held..." << std::endl;
+	ft::persistent_map<int, int>			copy = persistent;
+	t = clock();
+	for (std::size_t i = 0; i < map_size / 2; i++)
+		persistent.erase(keys[i]);
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "persistent map erase", exec_time);
+
+	for (std::size_t i = 0; i < map_size / 2; i++)
+	{
+		copy.erase(keys[i]);
+		if (i % (map_size / 200) == 0)
+			held.push_back(copy.snapshot());
+	}
+	t = clock();
+	for (std::size_t i = 0; i < map_size / 2; i++)
+		test.erase(keys[i]);
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "map erase", exec_time);
+
+	t = clock();
+	held.clear();
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "reclaiming 100 snapshots", exec_time);
+	separator(col);
+	std::cout << "total (not a result, prevents the snapshots to be optimized out) : " << total << std::endl;
+}
+
+/* measures the copy of a map of 10.000.000 random keys (copy constructor and operator=), and compares
+it with a std::map copy and with a memcpy of as many bytes as the map nodes, which gives the memory
+bandwidth bound of the copy */
+static void	map_copy_speedtest(Colors &col)
+{
+	typedef ft::map<int, int>::binary_tree::node	node;
+
+	const std::size_t						map_size = 10000000;
+	ft::map<int, int>						test;
+	std::map<int, int>						stl_test;
+	std::size_t								total = 0;
+	clock_t									t;
+	double									exec_time;
+
+	std::cout << col.bdYellow() << "Starting copy speedtest for maps..." << col.reset() << std::endl;
+	srand(42);
+	for (std::size_t i = 0; i < map_size; i++)
+	{
+		int		key = rand();
+
+		test.insert(ft::make_pair<int, int>(key, i));
+		stl_test.insert(std::make_pair(key, static_cast<int>(i)));
+	}
+
+	std::size_t								bytes = test.size() * sizeof(node);
+	char									*src = new char[bytes];
+	char									*dst = new char[bytes];
+
+	std::cout << "copying a map of " << test.size() << " elements (" << bytes << " bytes of nodes)..." << std::endl;
+	std::memset(src, 42, bytes);
+	std::memset(dst, 0, bytes);
+	t = clock();
+	std::memcpy(dst, src, bytes);
+	t = clock() - t;
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "memcpy of the same size (bandwidth bound)", exec_time);
+	total += dst[bytes / 2];
+	delete [] src;
+	delete [] dst;
+
+	t = clock();
+	{
+		ft::map<int, int>					copy(test);
+
+		total += copy.size();
+		t = clock() - t;
+	}
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "map copy constructor", exec_time);
+
+	{
+		ft::map<int, int>					assigned;
+
+		assigned.insert(ft::make_pair<int, int>(42, 42));
+		t = clock();
+		assigned = test;
+		t = clock() - t;
+		total += assigned.size();
+	}
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "map operator=", exec_time);
+
+	t = clock();
+	{
+		std::map<int, int>					stl_copy(stl_test);
+
+		total += stl_copy.size();
+		t = clock() - t;
+	}
+	exec_time = ((double)t)/CLOCKS_PER_SEC;
+	speedtest_result(col, "std::map copy constructor", exec_time);
+	separator(col);
+	std::cout << "total (not a result, prevents the copies to be optimized out) : " << total << std::endl;
+}
+
+/* features measured by map_operations_speedtest */
+enum	e_map_feature
+{
+	INSERT_RANDOM,
+	INSERT_SORTED,
+	INSERT_REVERSE,
+	FIND_HIT,
+	FIND_MISS,
+	ACCESS_OPERATOR,
+	LOWER_BOUND,
+	UPPER_BOUND,
+	ITERATION,
+	COPY,
+	SWAP,
+	ERASE_KEY,
+	ERASE_ITERATOR,
+	ERASE_RANGE,
+	CLEAR,
+	MIXED,
+	MAP_FEATURES
+};
+
+static const char	*g_map_features[MAP_FEATURES] = {
+	"insert (workload keys)",
+	"insert (sorted keys)",
+	"insert (reverse sorted keys)",
+	"find (existing keys)",
+	"find (missing keys)",
+	"operator[] (existing keys)",
+	"lower_bound",
+	"upper_bound",
+	"iteration from begin to end",
+	"copy constructor",
+	"swap (size times)",
+	"erase (key)",
+	"erase (iterator position), always begin",
+	"erase (iterator first, iterator last)",
+	"clear",
+	"mixed find / insert / erase (workload mix)"
+};
+
+/* ft::map sits on an unbalanced binary search tree : keys inserted in order build a list, so the sorted
+insertions are quadratic and leave a tree as deep as the map. They are measured up to this size only */
+static const std::size_t	g_degenerate_size = 10000;
+
+/* benchmark task : setUp prepares the map for the feature, operator() does the measured work.
+keys are the existing keys in the order of the workload (even numbers), misses the missing ones (odd
+numbers), ops the operations of the workload. Works with ft::map and std::map : only the common
+interface is used */
+template <class Map>
+class map_task
+{
+	public:
+
+		typedef typename Map::value_type	value_type;
+		typedef typename Map::iterator		iterator;
+
+		map_task(const std::vector<int> &keys, const std::vector<int> &misses, const std::vector<WorkloadOp> &ops)
+		: _keys(keys), _misses(misses), _ops(ops), _copy(nullptr), _feature(INSERT_RANDOM), _full(0),
+		_checksum(0) {}
+
+		~map_task() { delete this->_copy; }
+
+		void	feature(int f) { this->_feature = f; }
+
+		std::size_t	checksum(void) const { return (this->_checksum); }
+
+		void	setUp(void)
+		{
+			const int		n = this->_keys.size();
+
+			delete this->_copy;
+			this->_copy = nullptr;
+			if (this->_feature == INSERT_RANDOM || this->_feature == INSERT_SORTED
+				|| this->_feature == INSERT_REVERSE)
+				this->_map.clear();
+			else if (this->_map.empty() || this->_map.size() != this->_full || this->_feature == MIXED)
+			{
+				this->_map.clear();
+				for (int i = 0; i < n; i++)
+					this->_map.insert(value_type(this->_keys[i], i));
+				this->_full = this->_map.size(); // changed by the previous feature, the keys may repeat
+			}
+			if (this->_feature == SWAP)
+				this->_copy = new Map(this->_map);
+		}
+
+		void	operator()(void)
+		{
+			const int		n = this->_keys.size();
+
+			switch (this->_feature)
+			{
+				case INSERT_RANDOM:
+					for (int i = 0; i < n; i++)
+						this->_map.insert(value_type(this->_keys[i], i));
+					break ;
+				case INSERT_SORTED:
+					for (int i = 0; i < n; i++)
+						this->_map.insert(value_type(i * 2, i));
+					break ;
+				case INSERT_REVERSE:
+					for (int i = n - 1; i >= 0; i--)
+						this->_map.insert(value_type(i * 2, i));
+					break ;
+				case FIND_HIT:
+					for (int i = 0; i < n; i++)
+						this->_checksum += (this->_map.find(this->_keys[i]) != this->_map.end());
+					break ;
+				case FIND_MISS:
+					for (int i = 0; i < n; i++)
+						this->_checksum += (this->_map.find(this->_misses[i]) != this->_map.end());
+					break ;
+				case ACCESS_OPERATOR:
+					for (int i = 0; i < n; i++)
+						this->_checksum += this->_map[this->_keys[i]]++;
+					break ;
+				case LOWER_BOUND:
+					for (int i = 0; i < n; i++)
+						this->_checksum += (this->_map.lower_bound(this->_misses[i]) != this->_map.end());
+					break ;
+				case UPPER_BOUND:
+					for (int i = 0; i < n; i++)
+						this->_checksum += (this->_map.upper_bound(this->_keys[i]) != this->_map.end());
+					break ;
+				case ITERATION:
+					for (iterator it = this->_map.begin(); it != this->_map.end(); it++)
+						this->_checksum += it->second;
+					break ;
+				case COPY:
+					this->_copy = new Map(this->_map);
+					break ;
+				case SWAP:
+					for (int i = 0; i < n; i++)
+						this->_copy->swap(this->_map);
+					break ;
+				case ERASE_KEY:
+					for (int i = 0; i < n; i++)
+						this->_checksum += this->_map.erase(this->_keys[i]);
+					break ;
+				case ERASE_ITERATOR:
+					while (this->_map.empty() == false)
+						this->_map.erase(this->_map.begin());
+					break ;
+				case ERASE_RANGE:
+					this->_map.erase(this->_map.begin(), this->_map.end());
+					break ;
+				case CLEAR:
+					this->_map.clear();
+					break ;
+				case MIXED:
+					for (std::size_t i = 0; i < this->_ops.size(); i++)
+					{
+						if (this->_ops[i].op == WL_READ)
+							this->_checksum += (this->_map.find(this->_ops[i].key * 2) != this->_map.end());
+						else if (this->_ops[i].op == WL_WRITE)
+							this->_map.insert(value_type(this->_ops[i].key * 2, i));
+						else
+							this->_checksum += this->_map.erase(this->_ops[i].key * 2);
+					}
+					break ;
+			}
+			doNotOptimize(this->_checksum);
+			clobberMemory();
+		}
+
+	private:
+
+		map_task(const map_task &original);
+		map_task&	operator=(const map_task &original);
+
+		const std::vector<int>			&_keys;
+		const std::vector<int>			&_misses;
+		const std::vector<WorkloadOp>	&_ops;
+		Map								_map;
+		Map								*_copy;
+		int								_feature;
+		std::size_t						_full;
+		std::size_t						_checksum;
+};
+
+/* allocations of one call of feature, for a Map using a default constructed ft::counting_allocator.
+The task lives only for this call, so that the live bytes counted are the ones of its map alone.
+elements is the number of distinct keys (the size of a full map) */
+template <class Map>
+static void	map_memory(Benchmark &bench, int feature, const std::vector<int> &keys, const std::vector<int> &misses,
+	const std::vector<WorkloadOp> &ops, std::size_t elements)
+{
+	map_task<Map>	task(keys, misses, ops);
+
+	task.feature(feature);
+	bench.memory(task, keys.size(), elements);
+}
+
+/* ft::map against std::map for every feature of map_task, with 10^3 to 10^6 keys of the workload chosen
+by Benchmark::config() (a replayed trace is measured once, with its own keys). Each feature is measured
+Benchmark::config().reps times : the median and the ratio ft / std of the medians are printed */
+void	map_operations_speedtest(Colors &col)
+{
+	Benchmark		ft_bench(col, "ft::map");
+	Benchmark		std_bench(col, "std::map");
+	std::size_t		checksum = 0;
+
+	std::cout << col.bdYellow() << "Starting operations speedtest for maps (ft::map vs std::map)..."
+	<< col.reset() << std::endl;
+	for (std::size_t size = 1000; size <= 1000000; size *= 10)
+	{
+		Workload			workload(Benchmark::config().workload, size, size, Benchmark::config().mix);
+		std::size_t			n = workload.keys().size();
+		std::vector<int>	keys(n);
+		std::vector<int>	misses(n);
+		std::vector<int>	distinct(workload.keys());
+		std::ostringstream	suffix;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			keys[i] = workload.keys()[i] * 2;
+			misses[i] = workload.keys()[n - 1 - i] * 2 + 1;
+		}
+		std::sort(distinct.begin(), distinct.end());
+		distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+		suffix << " [" << workload.name() << ", " << n << "]";
+		separator(col);
+		std::cout << "maps of " << n << " " << workload.name() << " keys" << std::endl;
+
+		map_task<ft::map<int, int> >	ft_task(keys, misses, workload.ops());
+		map_task<std::map<int, int> >	std_task(keys, misses, workload.ops());
+
+		for (int f = 0; f < MAP_FEATURES; f++)
+		{
+			if ((f == INSERT_SORTED || f == INSERT_REVERSE) && n > g_degenerate_size)
+				continue ;
+			ft_task.feature(f);
+			std_task.feature(f);
+			BenchmarkResult		ft_res = ft_bench.run(g_map_features[f] + suffix.str(), ft_task, n);
+			map_memory<ft::map<int, int, std::less<int>, ft::counting_allocator<ft::pair<const int, int> > > >
+				(ft_bench, f, keys, misses, workload.ops(), distinct.size());
+			BenchmarkResult		std_res = std_bench.run(g_map_features[f] + suffix.str(), std_task, n);
+			map_memory<std::map<int, int, std::less<int>, ft::counting_allocator<std::pair<const int, int> > > >
+				(std_bench, f, keys, misses, workload.ops(), distinct.size());
+
+			ft_bench.compare(ft_res, std_res);
+		}
+		checksum += ft_task.checksum() + std_task.checksum();
+		if (workload.name().compare(0, 7, "replay:") == 0)
+			break ;
+	}
+	separator(col);
+	std::cout << "checksum (not a result, prevents the operations to be optimized out) : " << checksum << std::endl;
+}
+
+/* latency of each insert, find and erase of the workload keys, in this order, on a Map */
+template <class Map>
+static void	map_latency(Colors &col, const std::string &name, const std::vector<int> &keys, double overhead)
+{
+	typedef typename Map::value_type	value_type;
+
+	Map					test;
+	LatencyHistogram	latency[3];
+	std::size_t			checksum = 0;
+	double				start;
+	double				duration;
+
+	for (int op = 0; op < 3; op++)
+	{
+		for (std::size_t i = 0; i < keys.size(); i++)
+		{
+			start = Benchmark::now();
+			if (op == 0)
+				checksum += test.insert(value_type(keys[i], i)).second;
+			else if (op == 1)
+				checksum += (test.find(keys[i]) != test.end());
+			else
+				checksum += test.erase(keys[i]);
+			duration = Benchmark::now() - start;
+			latency[op].record(duration > overhead ? duration - overhead : 0);
+		}
+	}
+	doNotOptimize(checksum);
+	latency[0].print(col, name + " insert");
+	latency[1].print(col, name + " find");
+	latency[2].print(col, name + " erase");
+}
+
+/* latency of single operations (percentiles), with 10^6 keys of the workload of Benchmark::config() */
+static void	map_latency_speedtest(Colors &col)
+{
+	Workload			workload(Benchmark::config().workload, 1000000, 1000000, Benchmark::config().mix);
+	double				overhead = Benchmark::timerOverhead();
+
+	std::cout << col.bdYellow() << "Starting latency speedtest for maps (" << workload.keys().size() << " "
+	<< workload.name() << " keys)..." << col.reset() << std::endl;
+	map_latency<ft::map<int, int> >(col, "ft::map", workload.keys(), overhead);
+	map_latency<std::map<int, int> >(col, "std::map", workload.keys(), overhead);
+	separator(col);
+}
 
 /* includes speedtest for maps */
 void	map_speedtest(Colors &col)
 {
-	// TO IMPLEMENT
+	map_operations_speedtest(col);
+	map_latency_speedtest(col);
+	batch_lookup_speedtest(col);
+	frozen_map_speedtest(col);
+	persistent_map_speedtest(col);
+	map_copy_speedtest(col);
+	concurrent_map_speedtest(col);
 }
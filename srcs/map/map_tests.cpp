@@ -6,7 +6,7 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/01 15:45:02 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/15 17:18:44 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:59:04 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -56,7 +56,34 @@ VII)	Operations
 => count
 => lower_bound
 => upper_bound
-=> equal_range */
+=> equal_range
+
+VIII)	Batched operations (ft::map only)
+
+=> find_many
+=> count_many
+
+IX)		Frozen map (ft::frozen_map only)
+
+=> construction from a map, in both layouts
+=> find, count, lower_bound, upper_bound, at
+
+X)		Persistent map (ft::persistent_map only)
+
+=> insert, update, erase
+=> snapshots unchanged by later updates
+
+XI)		Sharded map (ft::sharded_map only)
+
+=> insert, assign, erase, lookup, count
+=> spread of the keys over the shards
+=> ordered iteration over all shards (snapshot_guard)
+
+XII)	Concurrent skip list map (ft::concurrent_skiplist_map only)
+
+=> insert, erase, find, count, lower_bound, upper_bound
+=> ordered iteration under a guard
+=> more maps alive at once than pthread keys */
 
 /* I - Constructors */
 
@@ -418,7 +445,14 @@ void	test_access(Colors &col) // to test
 	std::cout << "test.at(55)  = " << test.at(55)  << std::endl;
 
 	std::cout << "Testing test at with invalid key value" << std::endl;
+	try
+	{
 		std::cout << test.at(666) << std::endl;
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << "exception caught : " << e.what() << std::endl;
+	}
 
 	separator(col);
 	std::cout << std::endl << col.bdYellow() << "access methods tests over" << col.reset() << std::endl;
@@ -443,7 +477,7 @@ void	test_insert(Colors &col) // to test
 	std::pair<std::map<int, std::string>::iterator, bool>		feedback;
 	feedback = test.insert(std::make_pair<int, std::string>(4, "one val"));
 	std::cout << "printing iterator position and check whether the insertion was successful" << std::endl;
-	std::cout << "verif bool = " << std::boolalpha << feedback.second << ", *iterator = " << *feedback.first  // check this
+	std::cout << "verif bool = " << std::boolalpha << feedback.second << ", *iterator = " << feedback.first->first << " => " << feedback.first->second
 	<< std::endl;
 	std::cout << "test.size() = " << test.size() << "and key added = " << test[4] << std::endl << std::endl;
 
@@ -452,7 +486,7 @@ void	test_insert(Colors &col) // to test
 	std::pair<std::map<int, std::string>::iterator, bool>		feedback2;
 	feedback2 = test.insert(std::make_pair<int, std::string>(65, "2nd val"));
 	std::cout << "printing iterator position and check whether the insertion was successful" << std::endl;
-	std::cout << "verif bool = " << std::boolalpha << feedback2.second << ", *iterator = " << *feedback2.first  // check this
+	std::cout << "verif bool = " << std::boolalpha << feedback2.second << ", *iterator = " << feedback2.first->first << " => " << feedback2.first->second
 	<< std::endl;
 	std::cout << "test.size() = " << test.size() << "and key added = " << test[65] << std::endl << std::endl;
 
@@ -461,7 +495,7 @@ void	test_insert(Colors &col) // to test
 	std::pair<std::map<int, std::string>::iterator, bool>		feedback3;
 	feedback3 = test.insert(std::make_pair<int, std::string>(65, "2nd val"));
 	std::cout << "printing iterator position and check whether the insertion was successful" << std::endl;
-	std::cout << "verif bool = " << std::boolalpha << feedback2.second << ", *iterator = " << *feedback2.first  // check this
+	std::cout << "verif bool = " << std::boolalpha << feedback2.second << ", *iterator = " << feedback2.first->first << " => " << feedback2.first->second
 	<< std::endl;
 	std::cout << "test.size() = " << test.size() << "and key added = " << test[65] << std::endl << std::endl;
 	
@@ -546,7 +580,7 @@ void	test_erase(Colors &col) // to test
 	std::cout << std::endl;
 	
 	std::cout << "erase the last value" << std::endl;
-	test.erase(test.end());
+	test.erase(--test.end());
 	std::cout << "displaying the updated map" << std::endl;
 	it = test.begin();
 	while (it != test.end())
@@ -915,6 +949,324 @@ void	test_bounds(Colors &col) // to test
 	separator(col);
 }
 
+/* VIII - BATCHED OPERATIONS */
+
+/* test find_many and count_many, with a sorted and an unsorted batch. std::map has no batched
+lookups, so this test uses ft::map and checks the results against single find calls */
+void	test_batch_lookup(Colors &col) // to test
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing find_many and count_many..." << col.reset() << std::endl;
+	separator(col);
+
+	std::cout << "Create a map to test on it" << std::endl;
+	ft::map<int, std::string>							test;
+
+	test.insert(ft::make_pair<int, std::string>(4, "this"));
+	test.insert(ft::make_pair<int, std::string>(-65, "is"));
+	test.insert(ft::make_pair<int, std::string>(47, "a"));
+	test.insert(ft::make_pair<int, std::string>(21, " "));
+	test.insert(ft::make_pair<int, std::string>(34, "test"));
+
+	int													unsorted[] = {47, 999999, -65, 21, 0, 4, 34, 47};
+	int													sorted[] = {-999999, -65, 0, 4, 4, 21, 34, 47, 666};
+	std::vector<ft::map<int, std::string>::iterator>	res(9);
+	std::vector<std::size_t>							counts(9);
+
+	std::cout << "find_many with an unsorted batch (47, 999999, -65, 21, 0, 4, 34, 47)" << std::endl;
+	test.find_many(unsorted, unsorted + 8, res.begin());
+	test.count_many(unsorted, unsorted + 8, counts.begin());
+	for (std::size_t i = 0; i < 8; i++)
+	{
+		if (res[i] != test.end())
+			std::cout << "key " << unsorted[i] << " => " << (*res[i]).second;
+		else
+			std::cout << "key " << unsorted[i] << " => end reached";
+		std::cout << " | count = " << counts[i] << " | same as find : " << std::boolalpha
+		<< (res[i] == test.find(unsorted[i])) << std::endl;
+	}
+
+	std::cout << std::endl << "find_many with a sorted batch (-999999, -65, 0, 4, 4, 21, 34, 47, 666)" << std::endl;
+	test.find_many(sorted, sorted + 9, res.begin());
+	test.count_many(sorted, sorted + 9, counts.begin());
+	for (std::size_t i = 0; i < 9; i++)
+	{
+		if (res[i] != test.end())
+			std::cout << "key " << sorted[i] << " => " << (*res[i]).second;
+		else
+			std::cout << "key " << sorted[i] << " => end reached";
+		std::cout << " | count = " << counts[i] << " | same as find : " << std::boolalpha
+		<< (res[i] == test.find(sorted[i])) << std::endl;
+	}
+
+	std::cout << std::endl << "find_many and count_many on an empty map (every key is missing)" << std::endl;
+	ft::map<int, std::string>							empty;
+	bool												all_missing = true;
+
+	empty.find_many(sorted, sorted + 9, res.begin());
+	empty.count_many(sorted, sorted + 9, counts.begin());
+	for (std::size_t i = 0; i < 9; i++)
+		all_missing = all_missing && res[i] == empty.end() && counts[i] == 0;
+	std::cout << "every key => end reached, count = 0 : " << std::boolalpha << all_missing << std::endl;
+
+	std::cout << std::endl << "find_many with a map ordered by std::greater, batch sorted for std::greater "
+	<< "(666, 47, 34, 21, 4, 4, 0, -65, -999999)" << std::endl;
+	typedef ft::map<int, std::string, std::greater<int> >	greater_map;
+	greater_map											reversed(test.begin(), test.end());
+	int													desc[] = {666, 47, 34, 21, 4, 4, 0, -65, -999999};
+	std::vector<greater_map::iterator>					rres(9);
+
+	reversed.find_many(desc, desc + 9, rres.begin());
+	reversed.count_many(desc, desc + 9, counts.begin());
+	for (std::size_t i = 0; i < 9; i++)
+	{
+		if (rres[i] != reversed.end())
+			std::cout << "key " << desc[i] << " => " << (*rres[i]).second;
+		else
+			std::cout << "key " << desc[i] << " => end reached";
+		std::cout << " | count = " << counts[i] << " | same as find : " << std::boolalpha
+		<< (rres[i] == reversed.find(desc[i])) << std::endl;
+	}
+
+	separator(col);
+	std::cout << std::endl << col.bdYellow() << "find_many and count_many tests over" 
+	<< col.reset() << std::endl;
+	separator(col);
+}
+
+/* IX - FROZEN MAP */
+
+/* build a frozen_map from a map in both layouts, then check that its lookups match the map ones */
+void	test_frozen_map(Colors &col) // to test
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing frozen_map..." << col.reset() << std::endl;
+	separator(col);
+
+	std::cout << "Create a map to test on it" << std::endl;
+	ft::map<int, std::string>				test;
+
+	test.insert(ft::make_pair<int, std::string>(4, "this"));
+	test.insert(ft::make_pair<int, std::string>(-65, "is"));
+	test.insert(ft::make_pair<int, std::string>(47, "a"));
+	test.insert(ft::make_pair<int, std::string>(21, " "));
+	test.insert(ft::make_pair<int, std::string>(34, "test"));
+
+	int										keys[] = {-999999, -65, 0, 4, 21, 33, 34, 47, 666};
+	typedef ft::frozen_map<int, std::string>	frozen_type;
+	frozen_type::layout_type				layouts[] = {frozen_type::EYTZINGER, frozen_type::VAN_EMDE_BOAS};
+
+	for (std::size_t l = 0; l < 2; l++)
+	{
+		frozen_type							frozen(test, layouts[l]);
+
+		std::cout << col.yellow() << (layouts[l] == frozen_type::EYTZINGER ? "Eytzinger" : "van Emde Boas")
+		<< " layout" << col.reset() << std::endl;
+		std::cout << "frozen.size() = " << frozen.size() << " (should be " << test.size() << ")" << std::endl;
+		std::cout << "iterating over the frozen map :";
+		for (ft::frozen_map<int, std::string>::const_iterator it = frozen.begin(); it != frozen.end(); it++)
+			std::cout << " [" << it->first << "]";
+		std::cout << std::endl;
+		for (std::size_t i = 0; i < 9; i++)
+		{
+			std::cout << "key " << keys[i] << " : count = " << frozen.count(keys[i]) << " (map : "
+			<< test.count(keys[i]) << ") | lower_bound = ";
+			if (frozen.lower_bound(keys[i]) != frozen.end())
+				std::cout << frozen.lower_bound(keys[i])->first;
+			else
+				std::cout << "end";
+			std::cout << " | upper_bound = ";
+			if (frozen.upper_bound(keys[i]) != frozen.end())
+				std::cout << frozen.upper_bound(keys[i])->first;
+			else
+				std::cout << "end";
+			std::cout << std::endl;
+		}
+		std::cout << "frozen.at(47) = " << frozen.at(47) << std::endl;
+		try
+		{
+			frozen.at(666);
+			std::cout << "at(666) should have thrown" << std::endl;
+		}
+		catch (const std::out_of_range &e)
+		{
+			std::cout << "at(666) throws out_of_range as expected" << std::endl;
+		}
+	}
+
+	separator(col);
+	std::cout << std::endl << col.bdYellow() << "frozen_map tests over" << col.reset() << std::endl;
+	separator(col);
+}
+
+/* X - PERSISTENT MAP */
+
+/* prints every pair of a persistent map on a single line */
+static void	print_persistent_map(const ft::persistent_map<int, std::string> &target)
+{
+	for (ft::persistent_map<int, std::string>::const_iterator it = target.begin(); it != target.end(); it++)
+		std::cout << " [" << it->first << " => " << it->second << "]";
+	std::cout << " (size = " << target.size() << ")" << std::endl;
+}
+
+/* updates a persistent map after taking snapshots of it : snapshots should keep their content */
+void	test_persistent_map(Colors &col) // to test
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing persistent_map..." << col.reset() << std::endl;
+	separator(col);
+
+	ft::persistent_map<int, std::string>		test;
+
+	std::cout << "insert 5 pairs, a duplicate key (4) should not be inserted" << std::endl;
+	test.insert(ft::make_pair<const int, std::string>(4, "this"));
+	test.insert(ft::make_pair<const int, std::string>(-65, "is"));
+	test.insert(ft::make_pair<const int, std::string>(47, "a"));
+	test.insert(ft::make_pair<const int, std::string>(21, " "));
+	test.insert(ft::make_pair<const int, std::string>(34, "test"));
+	std::cout << "insert(4, \"duplicate\") = " << std::boolalpha
+	<< test.insert(ft::make_pair<const int, std::string>(4, "duplicate")) << std::endl;
+	print_persistent_map(test);
+
+	std::cout << "take a snapshot, then update 4, erase 47 and insert 666" << std::endl;
+	ft::persistent_map<int, std::string>		snap = test.snapshot();
+
+	test.update(ft::make_pair<const int, std::string>(4, "that"));
+	test.erase(47);
+	test.insert(ft::make_pair<const int, std::string>(666, "new"));
+	std::cout << "map      :";
+	print_persistent_map(test);
+	std::cout << "snapshot :";
+	print_persistent_map(snap);
+
+	std::cout << "lookups on the map : count(47) = " << test.count(47) << ", at(4) = " << test.at(4)
+	<< ", lower_bound(22) = " << test.lower_bound(22)->first << std::endl;
+	std::cout << "lookups on the snapshot : count(47) = " << snap.count(47) << ", at(4) = " << snap.at(4)
+	<< ", upper_bound(34) = " << snap.upper_bound(34)->first << std::endl;
+
+	std::cout << "clear the map, the snapshot should not change" << std::endl;
+	test.clear();
+	std::cout << "map      :";
+	print_persistent_map(test);
+	std::cout << "snapshot :";
+	print_persistent_map(snap);
+
+	separator(col);
+	std::cout << std::endl << col.bdYellow() << "persistent_map tests over" << col.reset() << std::endl;
+	separator(col);
+}
+
+/* XI - Sharded map */
+
+void	test_sharded_map(Colors &col) // to test
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing sharded_map..." << col.reset() << std::endl;
+	separator(col);
+
+	typedef ft::sharded_map<int, std::string, 4>	sharded;
+
+	sharded			test;
+	std::string		value;
+
+	std::cout << "insert 6 pairs in a map of " << test.shard_count() << " shards" << std::endl;
+	test.insert(ft::make_pair<const int, std::string>(4, "this"));
+	test.insert(ft::make_pair<const int, std::string>(-65, "is"));
+	test.insert(ft::make_pair<const int, std::string>(47, "a"));
+	test.insert(ft::make_pair<const int, std::string>(21, "sharded"));
+	test.insert(ft::make_pair<const int, std::string>(34, "map"));
+	test.insert(ft::make_pair<const int, std::string>(16, "test"));
+	std::cout << "size = " << test.size() << ", insert(4, \"duplicate\") = " << std::boolalpha
+	<< test.insert(ft::make_pair<const int, std::string>(4, "duplicate")) << std::endl;
+	for (std::size_t i = 0; i < test.shard_count(); i++)
+	{
+		sharded::read_guard		guard(test, i);
+
+		std::cout << "shard " << i << " holds " << guard->size() << " keys" << std::endl;
+	}
+
+	std::cout << "assign(4, \"that\"), erase(47) then lookups" << std::endl;
+	test.assign(ft::make_pair<const int, std::string>(4, "that"));
+	test.erase(47);
+	std::cout << "lookup(4) = " << test.lookup(4, value) << " (" << value << "), count(47) = "
+	<< test.count(47) << ", size = " << test.size() << std::endl;
+
+	std::cout << "all keys in order :";
+	{
+		sharded::snapshot_guard		snapshot(test);
+
+		for (sharded::merged_iterator it = snapshot.begin(); it != snapshot.end(); it++)
+			std::cout << " " << it->first << "=" << it->second;
+	}
+	std::cout << std::endl;
+
+	test.clear();
+	std::cout << "after clear, empty = " << test.empty() << std::endl;
+
+	separator(col);
+	std::cout << std::endl << col.bdYellow() << "sharded_map tests over" << col.reset() << std::endl;
+	separator(col);
+}
+
+/* XII - Concurrent skip list map */
+
+void	test_concurrent_skiplist_map(Colors &col) // to test
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing concurrent_skiplist_map..." << col.reset() << std::endl;
+	separator(col);
+
+	typedef ft::concurrent_skiplist_map<int, std::string>	skiplist;
+
+	skiplist		test;
+
+	std::cout << "insert 6 pairs, a duplicate key (4) should not be inserted" << std::endl;
+	test.insert(ft::make_pair<const int, std::string>(4, "this"));
+	test.insert(ft::make_pair<const int, std::string>(-65, "is"));
+	test.insert(ft::make_pair<const int, std::string>(47, "a"));
+	test.insert(ft::make_pair<const int, std::string>(21, "skip"));
+	test.insert(ft::make_pair<const int, std::string>(34, "list"));
+	test.insert(ft::make_pair<const int, std::string>(16, "test"));
+	std::cout << "insert(4, \"duplicate\") = " << std::boolalpha
+	<< test.insert(ft::make_pair<const int, std::string>(4, "duplicate")).second
+	<< ", size = " << test.size() << std::endl;
+
+	std::cout << "erase(47) = " << test.erase(47) << ", erase(47) again = " << test.erase(47) << std::endl;
+	{
+		skiplist::guard		guard(test); // iterators are only used under a guard
+
+		std::cout << "find(21) = " << test.find(21)->second << ", count(47) = " << test.count(47)
+		<< ", lower_bound(17) = " << test.lower_bound(17)->first
+		<< ", upper_bound(21) = " << test.upper_bound(21)->first << std::endl;
+		std::cout << "all keys in order :";
+		for (skiplist::iterator it = test.begin(); it != test.end(); it++)
+			std::cout << " " << it->first << "=" << it->second;
+		std::cout << std::endl;
+	}
+
+	std::cout << "1100 maps alive at once (more than PTHREAD_KEYS_MAX), one insert each" << std::endl;
+	{
+		std::vector<skiplist*>	many;
+		std::size_t				total = 0;
+
+		for (int i = 0; i < 1100; i++)
+		{
+			many.push_back(new skiplist());
+			many.back()->insert(ft::make_pair<const int, std::string>(i, "key"));
+		}
+		for (std::size_t i = 0; i < many.size(); i++)
+		{
+			total += many[i]->size();
+			delete many[i];
+		}
+		std::cout << "keys in all the maps = " << total << std::endl;
+	}
+
+	separator(col);
+	std::cout << std::endl << col.bdYellow() << "concurrent_skiplist_map tests over" << col.reset() << std::endl;
+	separator(col);
+}
+
 /* will verif all map features and function */
 void	map_verif_procedure(Colors &col)
 {	
@@ -934,6 +1286,11 @@ void	map_verif_procedure(Colors &col)
 	test_comparators(col);
 	test_find_count(col);
 	test_bounds(col);
+	test_batch_lookup(col);
+	test_frozen_map(col);
+	test_persistent_map(col);
+	test_sharded_map(col);
+	test_concurrent_skiplist_map(col);
 
 	separator(col);
 	std::cout << std::endl << col.bdYellow() << "Map tests over" << col.reset() << std::endl;
@@ -1,19 +0,0 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   tree_speedtests.c                                  :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2022/12/15 17:17:03 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/15 17:20:29 by cjulienn         ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/test_includes.hpp"
-
-/* includes speedtest for maps */
-void	tree_speedtest(Colors &col)
-{
-	// TO IMPLEMENT
-}
@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tree_speedtests.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2022/12/15 17:17:03 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 04:40:19 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include <algorithm>
+#include <stdlib.h>
+#include <time.h>
+
+/* tree level speedtests : the three engines (binarySearchTree, AVLTree, redBlackTree) are driven
+directly, without map, with the same key streams. For each one, the time per operation of insertion,
+search and deletion, and the shape of the tree once filled : height, average depth of the nodes
+(the cost of an average search) and rotations made to keep it balanced */
+
+typedef ft::binarySearchTree<int, int>		bst_engine;
+typedef ft::AVLTree<int, int>				avl_engine;
+typedef ft::redBlackTree<int, int>			rbt_engine;
+
+/* the engines do not share all their method names */
+template <class Tree>
+static void	engine_insert(Tree &tree, int key)
+{
+	tree.treeInsertion(ft::make_pair<const int, int>(key, key));
+}
+
+static void	engine_insert(bst_engine &tree, int key)
+{
+	tree.binarySearchTreeInsertion(ft::make_pair<const int, int>(key, key));
+}
+
+template <class Tree>
+static std::size_t	engine_rotations(Tree &tree)
+{
+	return (tree.getRotations());
+}
+
+static std::size_t	engine_rotations(bst_engine &)
+{
+	return (0);
+}
+
+/* height and average depth (root at depth 1) of a tree, without recursion : a degenerated tree
+can be as deep as its number of nodes */
+template <class Node>
+static void	tree_shape(Node *root, std::size_t &height, double &average_depth)
+{
+	std::vector<std::pair<Node *, std::size_t> >	stack;
+	std::size_t										nodes = 0;
+	double											depths = 0;
+
+	height = 0;
+	if (root != nullptr)
+		stack.push_back(std::make_pair(root, 1));
+	while (stack.empty() == false)
+	{
+		Node			*current = stack.back().first;
+		std::size_t		depth = stack.back().second;
+
+		stack.pop_back();
+		nodes++;
+		depths += depth;
+		height = std::max(height, depth);
+		if (current->_left != nullptr)
+			stack.push_back(std::make_pair(current->_left, depth + 1));
+		if (current->_right != nullptr)
+			stack.push_back(std::make_pair(current->_right, depth + 1));
+	}
+	average_depth = (nodes > 0 ? depths / nodes : 0);
+}
+
+static double	ns_per_op(clock_t start, std::size_t ops)
+{
+	return (((double)(clock() - start)) / CLOCKS_PER_SEC * 1e9 / ops);
+}
+
+/* inserts, searches then deletes the given streams of keys in an empty tree */
+template <class Tree>
+static void	tree_engine_speedtest(Colors &col, std::string name, const std::vector<int> &inserted,
+	const std::vector<int> &searched, const std::vector<int> &deleted)
+{
+	Tree			tree;
+	clock_t			t;
+	double			insert_time;
+	double			search_time;
+	double			delete_time;
+	std::size_t		insert_rotations;
+	std::size_t		height;
+	double			average_depth;
+	std::size_t		found = 0;
+
+	t = clock();
+	for (std::size_t i = 0; i < inserted.size(); i++)
+		engine_insert(tree, inserted[i]);
+	insert_time = ns_per_op(t, inserted.size());
+	insert_rotations = engine_rotations(tree);
+	tree_shape(tree.getRoot(), height, average_depth);
+
+	t = clock();
+	for (std::size_t i = 0; i < searched.size(); i++)
+		found += tree.IsKeyAlreadyExisting(searched[i]);
+	search_time = ns_per_op(t, searched.size());
+
+	t = clock();
+	for (std::size_t i = 0; i < deleted.size(); i++)
+		tree.deleteNode(deleted[i]);
+	delete_time = ns_per_op(t, deleted.size());
+
+	std::cout << col.bdYellow() << name << " : insert " << insert_time << " ns/op, search " << search_time
+	<< " ns/op, delete " << delete_time << " ns/op" << col.end() << std::endl;
+	std::cout << "    height " << height << ", average depth " << average_depth << ", rotations "
+	<< insert_rotations << " (insert) + " << engine_rotations(tree) - insert_rotations << " (delete), "
+	<< found << " keys found" << std::endl;
+}
+
+static void	tree_stream_speedtest(Colors &col, std::string stream, const std::vector<int> &inserted)
+{
+	std::vector<int>	searched(inserted);
+	std::vector<int>	deleted(inserted);
+
+	std::random_shuffle(searched.begin(), searched.end());
+	std::random_shuffle(deleted.begin(), deleted.end());
+	separator(col);
+	std::cout << "inserting " << inserted.size() << " " << stream
+	<< " keys, then searching and deleting them in random order" << std::endl;
+	tree_engine_speedtest<bst_engine>(col, "binary search tree", inserted, searched, deleted);
+	tree_engine_speedtest<avl_engine>(col, "AVL tree          ", inserted, searched, deleted);
+	tree_engine_speedtest<rbt_engine>(col, "red-black tree    ", inserted, searched, deleted);
+}
+
+/* random keys show the cost of the balancing, sorted keys the worst case of the binary search
+tree (a list : the sorted stream is kept small for it) */
+void	tree_speedtest(Colors &col)
+{
+	const std::size_t	random_size = 1000000;
+	const std::size_t	sorted_size = 20000;
+	std::vector<int>	keys;
+
+	std::cout << col.bdYellow() << "Starting speedtest for tree engines..." << col.reset() << std::endl;
+	srand(42);
+	for (std::size_t i = 0; i < random_size; i++)
+		keys.push_back(i);
+	std::random_shuffle(keys.begin(), keys.end());
+	tree_stream_speedtest(col, "random", keys);
+	keys.clear();
+	for (std::size_t i = 0; i < sorted_size; i++)
+		keys.push_back(i);
+	tree_stream_speedtest(col, "sorted", keys);
+	separator(col);
+}
@@ -6,7 +6,7 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/01 15:54:59 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/16 15:20:55 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:10:25 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -28,11 +28,11 @@ static void	binary_search_tree_verification(Colors &col)
 	tree.printTree();
 
 	std::cout << "lets add 5 pairs to the tree" << std::endl;
-	tree.binarySearchTreeInsertion(std::make_pair<int, std::string>(5, "this"));
-	tree.binarySearchTreeInsertion(std::make_pair<int, std::string>(-6666, "is"));
-	tree.binarySearchTreeInsertion(std::make_pair<int, std::string>(54, "a"));
-	tree.binarySearchTreeInsertion(std::make_pair<int, std::string>(5232, "bloody"));
-	tree.binarySearchTreeInsertion(std::make_pair<int, std::string>(0, "test"));
+	tree.binarySearchTreeInsertion(ft::make_pair<int, std::string>(5, "this"));
+	tree.binarySearchTreeInsertion(ft::make_pair<int, std::string>(-6666, "is"));
+	tree.binarySearchTreeInsertion(ft::make_pair<int, std::string>(54, "a"));
+	tree.binarySearchTreeInsertion(ft::make_pair<int, std::string>(5232, "bloody"));
+	tree.binarySearchTreeInsertion(ft::make_pair<int, std::string>(0, "test"));
 
 	std::cout << "print the tree" << std::endl;
 	tree.printTree();
@@ -40,14 +40,110 @@ static void	binary_search_tree_verification(Colors &col)
 	std::cout << "print max and min" << std::endl;
 	std::cout << tree.getMin() << "|" << tree.getMax() << std::endl;
 
+	std::cout << "copy the tree (deep copy), the copy should have the same shape" << std::endl;
+	ft::binarySearchTree<int, std::string>			copy(tree);
+
+	copy.printTree();
+	std::cout << "the roots should be different nodes : " << std::boolalpha
+	<< (copy.getRoot() != tree.getRoot()) << std::endl;
+
+	std::cout << "delete 54 from the original tree, then print both trees (copy should keep 54)" << std::endl;
+	tree.deleteNode(54);
+	tree.printTree();
+	copy.printTree();
+
+	std::cout << "assign the modified tree to the copy, then print the copy" << std::endl;
+	copy = tree;
+	copy.printTree();
+
 	separator(col);
 	std::cout << std::endl << col.bdYellow() << "BST tests over" << col.reset() << std::endl;
 	separator(col);
 }
 
+/* hot path counters of a tree, only filled when built with make STATS=1 */
+template <class Tree>
+static void	print_tree_stats(const Tree &tree)
+{
+	const ft::tree_stats	stats = tree.stats();
+
+	if (FT_STATS_ENABLED == 0)
+	{
+		std::cout << "stats : not compiled in (make re STATS=1)" << std::endl;
+		return ;
+	}
+	std::cout << "stats : " << stats.searches << " searches, " << stats.nodes_visited
+	<< " nodes visited, " << stats.rotations << " rotations, " << stats.rebalances
+	<< " rebalancing steps, " << stats.allocations << " node allocations" << std::endl;
+}
+
+/* AVL verifs : sorted insertions (the worst case of a BST) must give a balanced tree */
+static void	avl_tree_verification(Colors &col)
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing AVL tree..." << col.reset() << std::endl;
+	separator(col);
+
+	ft::AVLTree<int, std::string>			tree;
+
+	std::cout << "insert keys 0 to 9 in order, then print the tree ([key|balance factor])" << std::endl;
+	for (int i = 0; i < 10; i++)
+		tree.treeInsertion(ft::make_pair<const int, std::string>(i, "truc"));
+	tree.printTree();
+	std::cout << "insert 5 again (should be refused) : " << std::boolalpha
+	<< tree.treeInsertion(ft::make_pair<const int, std::string>(5, "duplicate")) << std::endl;
+	std::cout << "rotations made : " << tree.getRotations() << std::endl;
+
+	std::cout << "delete 3 (two children), 0 and 1, then print the tree" << std::endl;
+	tree.deleteNode(3);
+	tree.deleteNode(0);
+	tree.deleteNode(1);
+	tree.printTree();
+	std::cout << "size = " << tree.getSize() << ", key 3 exists : " << tree.IsKeyAlreadyExisting(3)
+	<< ", rotations made : " << tree.getRotations() << std::endl;
+	print_tree_stats(tree);
+
+	separator(col);
+	std::cout << std::endl << col.bdYellow() << "AVL tests over" << col.reset() << std::endl;
+	separator(col);
+}
+
+/* red-black tree verifs, same sequence as the AVL one ([key|color]) */
+static void	red_black_tree_verification(Colors &col)
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing red-black tree..." << col.reset() << std::endl;
+	separator(col);
+
+	ft::redBlackTree<int, std::string>		tree;
+
+	std::cout << "insert keys 0 to 9 in order, then print the tree ([key|color])" << std::endl;
+	for (int i = 0; i < 10; i++)
+		tree.treeInsertion(ft::make_pair<const int, std::string>(i, "truc"));
+	tree.printTree();
+	std::cout << "insert 5 again (should be refused) : " << std::boolalpha
+	<< tree.treeInsertion(ft::make_pair<const int, std::string>(5, "duplicate")) << std::endl;
+	std::cout << "rotations made : " << tree.getRotations() << std::endl;
+
+	std::cout << "delete 3 (two children), 0 and 1, then print the tree" << std::endl;
+	tree.deleteNode(3);
+	tree.deleteNode(0);
+	tree.deleteNode(1);
+	tree.printTree();
+	std::cout << "size = " << tree.getSize() << ", key 3 exists : " << tree.IsKeyAlreadyExisting(3)
+	<< ", rotations made : " << tree.getRotations() << std::endl;
+	print_tree_stats(tree);
+
+	separator(col);
+	std::cout << std::endl << col.bdYellow() << "red-black tree tests over" << col.reset() << std::endl;
+	separator(col);
+}
+
 
 /* check the map red black tree to check whether there are errors within it */
 void	tree_verification(Colors &col)
 {
 	binary_search_tree_verification(col);
+	avl_tree_verification(col);
+	red_black_tree_verification(col);
 }
@@ -0,0 +1,326 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   benchmark.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:41:28 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 08:56:22 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "benchmark.hpp"
+#include <algorithm>
+#include <fstream>
+#include <cmath>
+#include <cstdlib>
+#include <time.h>
+
+std::size_t		Benchmark::_compared = 0;
+std::size_t		Benchmark::_regressions = 0;
+bool			Benchmark::_header_written = false;
+
+/* quotes a CSV field when it contains a comma or a quote (feature names often do) */
+static std::string	csv_field(const std::string &field)
+{
+	std::string		res = "\"";
+
+	if (field.find_first_of(",\"") == std::string::npos)
+		return (field);
+	for (std::size_t i = 0; i < field.size(); i++)
+	{
+		if (field[i] == '"')
+			res += '"';
+		res += field[i];
+	}
+	return (res + "\"");
+}
+
+/* escapes the quotes and backslashes of a JSON string */
+static std::string	json_string(const std::string &str)
+{
+	std::string		res = "\"";
+
+	for (std::size_t i = 0; i < str.size(); i++)
+	{
+		if (str[i] == '"' || str[i] == '\\')
+			res += '\\';
+		res += str[i];
+	}
+	return (res + "\"");
+}
+
+/* splits a CSV line written by _write (fields quoted by csv_field) */
+static std::vector<std::string>	csv_split(const std::string &line)
+{
+	std::vector<std::string>	fields(1);
+	bool						quoted = false;
+
+	for (std::size_t i = 0; i < line.size(); i++)
+	{
+		if (line[i] == '"' && quoted && i + 1 < line.size() && line[i + 1] == '"')
+			fields.back() += line[i++];
+		else if (line[i] == '"')
+			quoted = !quoted;
+		else if (line[i] == ',' && quoted == false)
+			fields.push_back("");
+		else if (line[i] != '\r')
+			fields.back() += line[i];
+	}
+	return (fields);
+}
+
+/* default settings : 5 measures after 1 warm-up run, printed as text, 10% regression threshold,
+shuffled keys with 80% of reads, 15% of writes and 5% of erases, counters read */
+BenchmarkConfig	&Benchmark::config(void)
+{
+	static BenchmarkConfig	config = { 5, 1, BENCH_TEXT, "", 0.10, "shuffled", { 80, 15, 5 }, true };
+
+	return (config);
+}
+
+double	Benchmark::now(void)
+{
+	struct timespec		ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+std::map<std::string, BenchmarkResult>	&Benchmark::_baseline(void)
+{
+	static std::map<std::string, BenchmarkResult>	baseline;
+
+	return (baseline);
+}
+
+/* the stdout of the process, where the CSV or JSON results go when there is no output file */
+std::ostream	&Benchmark::_records(void)
+{
+	static std::ostream		records(std::cout.rdbuf());
+
+	return (records);
+}
+
+/* CSV or JSON results on stdout : the progress text of the suites (std::cout) goes to stderr instead,
+so that stdout holds only the results */
+void	Benchmark::separateOutput(void)
+{
+	if (config().format == BENCH_TEXT || config().output.empty() == false)
+		return ;
+	_records(); // keeps the buffer of stdout before std::cout leaves it
+	std::cout.flush();
+	std::cout.rdbuf(std::cerr.rdbuf());
+}
+
+/* reads the results of a CSV file : suite,name,ops,reps,min_ns,median_ns,p95_ns,mean_ns,stddev_ns, then
+the counters (missing in the files written before them). Header lines (several files can be
+concatenated) are skipped. Returns false if nothing was read */
+bool	Benchmark::loadBaseline(const std::string &file)
+{
+	std::ifstream		in(file.c_str());
+	std::string			line;
+
+	if (!in)
+		return (false);
+	while (std::getline(in, line))
+	{
+		std::vector<std::string>	fields = csv_split(line);
+		BenchmarkResult				res;
+
+		if ((fields.size() != 9 && fields.size() != 9 + PERF_COUNTERS) || fields[0] == "suite")
+			continue ;
+		res.suite = fields[0];
+		res.name = fields[1];
+		res.ops = std::strtoul(fields[2].c_str(), nullptr, 10);
+		res.reps = std::strtoul(fields[3].c_str(), nullptr, 10);
+		res.min = std::strtod(fields[4].c_str(), nullptr);
+		res.median = std::strtod(fields[5].c_str(), nullptr);
+		res.p95 = std::strtod(fields[6].c_str(), nullptr);
+		res.mean = std::strtod(fields[7].c_str(), nullptr);
+		res.stddev = std::strtod(fields[8].c_str(), nullptr);
+		for (int c = 0; c < PERF_COUNTERS; c++)
+			res.counters[c] = (fields.size() > 9 ? std::strtod(fields[9 + c].c_str(), nullptr) : -1);
+		_baseline()[res.suite + "," + res.name] = res;
+	}
+	return (_baseline().empty() == false);
+}
+
+/* number of results compared to the baseline */
+std::size_t	Benchmark::compared(void)
+{
+	return (_compared);
+}
+
+/* number of results slower than the baseline (see the SYNOPSIS) */
+std::size_t	Benchmark::regressions(void)
+{
+	return (_regressions);
+}
+
+/* smallest difference between two consecutive calls of now(), to be removed from the latencies
+of single operations */
+double	Benchmark::timerOverhead(void)
+{
+	double	best = now();
+	double	start;
+	double	end;
+
+	best = now() - best;
+	for (int i = 0; i < 1000; i++)
+	{
+		start = now();
+		end = now();
+		if (end - start < best)
+			best = end - start;
+	}
+	return (best);
+}
+
+Benchmark::Benchmark(Colors &col, const std::string &suite) : _col(col), _suite(suite) {}
+
+/* CSV and JSON results are appended to the output file, so that several suites can share it */
+Benchmark::~Benchmark()
+{
+	if (config().format == BENCH_TEXT || this->_results.empty())
+		return ;
+	if (config().output.empty())
+	{
+		this->_write(_records(), _header_written == false); // CSV header only once per stream
+		_header_written = true;
+		return ;
+	}
+
+	std::ofstream	file(config().output.c_str(), std::ios::out | std::ios::app);
+
+	if (!file)
+	{
+		std::cerr << this->_col.bdRed() << "Benchmark : can not open " << config().output
+		<< this->_col.reset() << std::endl;
+		return ;
+	}
+	file.seekp(0, std::ios::end);
+	this->_write(file, file.tellp() == 0); // CSV header only once per file
+}
+
+void	Benchmark::compare(const BenchmarkResult &tested, const BenchmarkResult &reference)
+{
+	if (config().format != BENCH_TEXT || reference.median <= 0)
+		return ;
+	std::cout << "    " << tested.suite << " / " << reference.suite << " = "
+	<< tested.median / reference.median << std::endl;
+}
+
+const std::vector<BenchmarkResult>	&Benchmark::results(void) const
+{
+	return (this->_results);
+}
+
+/* sorts the samples and computes the statistics */
+BenchmarkResult	Benchmark::_record(const std::string &name, std::size_t ops, std::vector<double> &samples,
+	const double *totals)
+{
+	BenchmarkResult		res;
+	std::size_t			n = samples.size();
+	double				sum = 0;
+	double				squares = 0;
+
+	res.suite = this->_suite;
+	res.name = name;
+	res.ops = ops;
+	res.reps = n;
+	res.min = 0;
+	res.median = 0;
+	res.p95 = 0;
+	res.mean = 0;
+	res.stddev = 0;
+	for (int c = 0; c < PERF_COUNTERS; c++)
+		res.counters[c] = (n > 0 && totals[c] >= 0 ? totals[c] / n / (ops > 0 ? ops : 1) : -1);
+	if (n > 0)
+	{
+		std::sort(samples.begin(), samples.end());
+		for (std::size_t i = 0; i < n; i++)
+			sum += samples[i];
+		res.mean = sum / n;
+		for (std::size_t i = 0; i < n; i++)
+			squares += (samples[i] - res.mean) * (samples[i] - res.mean);
+		res.min = samples[0];
+		res.median = (n % 2 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2);
+		res.p95 = samples[std::min(n - 1, (std::size_t)std::ceil(0.95 * n) - 1)];
+		res.stddev = (n > 1 ? std::sqrt(squares / (n - 1)) : 0);
+	}
+	this->_results.push_back(res);
+	if (config().format == BENCH_TEXT)
+		std::cout << this->_col.bdYellow() << this->_suite << " " << name << " : median " << res.median
+		<< " ns/op" << this->_col.end() << " (min " << res.min << ", p95 " << res.p95 << ", stddev "
+		<< res.stddev << ", " << n << " runs)" << std::endl;
+	if (config().format == BENCH_TEXT && config().counters)
+		this->_printCounters(res);
+	this->_checkBaseline(res);
+	return (res);
+}
+
+/* counters per operation of res, the unavailable ones are not printed */
+void	Benchmark::_printCounters(const BenchmarkResult &res) const
+{
+	std::cout << "    per op :";
+	for (int c = 0; c < PERF_COUNTERS; c++)
+		if (res.counters[c] >= 0)
+			std::cout << " " << PerfCounters::name(c) << " " << res.counters[c];
+	if (this->_counters.hardware() == false)
+		std::cout << " (no hardware counters)";
+	std::cout << std::endl;
+}
+
+/* compares res to the baseline result of the same name, if any. Printed with the progress text : on
+stderr when the results themselves are written on stdout (see separateOutput), so that they stay parsable */
+void	Benchmark::_checkBaseline(const BenchmarkResult &res)
+{
+	std::map<std::string, BenchmarkResult>::const_iterator	it = _baseline().find(res.suite + "," + res.name);
+	double													ratio;
+	bool													regressed;
+
+	if (it == _baseline().end() || it->second.median <= 0)
+		return ;
+	ratio = res.median / it->second.median;
+	regressed = (ratio > 1 + config().threshold && res.min > it->second.p95);
+	_compared++;
+	if (regressed)
+		_regressions++;
+	std::cout << (regressed ? this->_col.bdRed() : this->_col.bdGreen()) << "    baseline " << it->second.median
+	<< " ns/op, ratio " << ratio << (regressed ? " : REGRESSION" : "") << this->_col.reset() << std::endl;
+}
+
+void	Benchmark::_write(std::ostream &out, bool header) const
+{
+	if (config().format == BENCH_CSV && header)
+	{
+		out << "suite,name,ops,reps,min_ns,median_ns,p95_ns,mean_ns,stddev_ns";
+		for (int c = 0; c < PERF_COUNTERS; c++)
+			out << "," << PerfCounters::name(c);
+		out << std::endl;
+	}
+	for (std::size_t i = 0; i < this->_results.size(); i++)
+	{
+		const BenchmarkResult	&r = this->_results[i];
+
+		if (config().format == BENCH_CSV)
+		{
+			out << csv_field(r.suite) << "," << csv_field(r.name) << "," << r.ops << "," << r.reps << "," << r.min << ","
+			<< r.median << "," << r.p95 << "," << r.mean << "," << r.stddev;
+			for (int c = 0; c < PERF_COUNTERS; c++)
+				out << "," << r.counters[c];
+		}
+		else
+		{
+			out << "{\"suite\": " << json_string(r.suite) << ", \"name\": " << json_string(r.name) << ", \"ops\": " << r.ops
+			<< ", \"reps\": " << r.reps << ", \"min_ns\": " << r.min << ", \"median_ns\": " << r.median
+			<< ", \"p95_ns\": " << r.p95 << ", \"mean_ns\": " << r.mean << ", \"stddev_ns\": " << r.stddev;
+			for (int c = 0; c < PERF_COUNTERS; c++)
+				out << ", \"" << PerfCounters::name(c) << "\": " << r.counters[c];
+			out << "}";
+		}
+		out << std::endl;
+	}
+}
@@ -0,0 +1,200 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   benchmark.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:41:28 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 08:56:22 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCHMARK_HPP
+# define BENCHMARK_HPP
+
+#include	<string>
+#include	<vector>
+#include	<map>
+#include	<iostream>
+
+#include	"colors.hpp"
+#include	"workload.hpp"
+#include	"perfCounters.hpp"
+#include	"../../includes/utils/countingAllocator.hpp"
+
+/* output formats of the results : TEXT is printed on stdout as the tests go, CSV and JSON (one
+object per line) are written when the Benchmark is destroyed, in the output file or on stdout. On
+stdout, separateOutput() sends everything else to stderr and the CSV header is written once */
+# define BENCH_TEXT		1
+# define BENCH_CSV		2
+# define BENCH_JSON		3
+
+/*
+
+	SYNOPSIS : Benchmark measures tasks several times and reports statistics on the samples.
+
+	A task is any object with two methods :
+
+	=>	void	setUp(void);		// not timed : prepares the task (fills a container...)
+	=>	void	operator()(void);	// timed : the measured work
+
+	run(name, task, ops) calls the task config().warmup times without measuring it, then config().reps
+	times with the monotonic clock (clock_gettime, the time really elapsed, in nanoseconds). Each sample
+	is divided by ops (the number of operations done by one call), and the result keeps the minimum,
+	median, 95th percentile, mean and standard deviation of the samples, in ns per operation.
+
+	If config().counters is true, the PerfCounters (cycles, cache misses...) are read around each
+	measured call too, and the result keeps their mean per operation (-1 when a counter is unavailable).
+
+	memory(task, ops, elements) runs the task once more, out of the timings, for a task whose container
+	uses a default constructed ft::counting_allocator : it prints the allocations per operation, the
+	peak of live bytes per element and the number of growths of this call.
+
+	The results of the measured work must reach doNotOptimize (or memory, see clobberMemory), otherwise
+	the compiler may remove the work.
+
+	Regression gate : loadBaseline(file) reads a CSV written by a previous run (format BENCH_CSV). Each
+	new result with the same suite and name is compared to it and the ratio of the medians is printed.
+	A result regresses when its median is more than config().threshold slower than the baseline median
+	AND its fastest run is still slower than the baseline p95 : the two distributions do not overlap,
+	so a noisy run alone does not fail the gate. regressions() counts them.
+*/
+
+/* settings shared by all the Benchmark objects (can be changed from the command line) */
+struct	BenchmarkConfig
+{
+	std::size_t		reps;
+	std::size_t		warmup;
+	int				format;
+	std::string		output; // file for CSV or JSON results, empty for stdout
+	double			threshold; // regression gate : 0.10 means 10% slower than the baseline
+	std::string		workload; // name of the Workload of the benchmarks
+	WorkloadMix		mix; // operations of the workload
+	bool			counters; // reads the PerfCounters around the measured calls
+};
+
+/* statistics of one measure, in ns per operation */
+struct	BenchmarkResult
+{
+	std::string		suite;
+	std::string		name;
+	std::size_t		ops;
+	std::size_t		reps;
+	double			min;
+	double			median;
+	double			p95;
+	double			mean;
+	double			stddev;
+	double			counters[PERF_COUNTERS]; // mean count per operation, -1 if unavailable
+};
+
+/* the compiler has to compute value, and can not keep it in a register across the call */
+template <class T>
+inline void	doNotOptimize(const T &value)
+{
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/* the compiler has to write all pending stores to memory */
+inline void	clobberMemory(void)
+{
+	asm volatile("" : : : "memory");
+}
+
+class Benchmark
+{
+	public:
+
+		Benchmark(Colors &col, const std::string &suite);
+		~Benchmark();
+
+		static BenchmarkConfig	&config(void);
+		static double			now(void); // monotonic time in nanoseconds
+		static double			timerOverhead(void); // cost of a call of now()
+		static void				separateOutput(void); // call once the format and the output are set
+
+		/* regression gate */
+		static bool				loadBaseline(const std::string &file);
+		static std::size_t		compared(void);
+		static std::size_t		regressions(void);
+
+		/* measures task, ops operations per call */
+		template <class Task>
+		BenchmarkResult	run(const std::string &name, Task &task, std::size_t ops)
+		{
+			std::vector<double>		samples;
+			double					totals[PERF_COUNTERS] = {0};
+			double					start;
+
+			for (std::size_t i = 0; i < config().warmup; i++)
+			{
+				task.setUp();
+				task();
+			}
+			for (std::size_t i = 0; i < config().reps; i++)
+			{
+				task.setUp();
+				clobberMemory();
+				if (config().counters)
+					this->_counters.start();
+				start = now();
+				task();
+				clobberMemory();
+				samples.push_back((now() - start) / (ops > 0 ? ops : 1));
+				if (config().counters)
+					this->_counters.stop();
+				for (int c = 0; c < PERF_COUNTERS; c++)
+					totals[c] = (config().counters && totals[c] >= 0 && this->_counters.value(c) >= 0
+						? totals[c] + this->_counters.value(c) : -1);
+			}
+			return (this->_record(name, ops, samples, totals));
+		}
+
+		/* allocations of one call of task, counted by ft::default_allocation_stats() */
+		template <class Task>
+		void	memory(Task &task, std::size_t ops, std::size_t elements)
+		{
+			ft::allocation_stats	&stats = ft::default_allocation_stats();
+			ft::allocation_stats	before;
+
+			task.setUp();
+			before = stats;
+			stats.peak_bytes = stats.live_bytes;
+			task();
+			if (config().format != BENCH_TEXT)
+				return ;
+			std::cout << "    memory : " << (double)(stats.allocations - before.allocations) / (ops > 0 ? ops : 1)
+			<< " allocations per op, " << (double)stats.peak_bytes / (elements > 0 ? elements : 1)
+			<< " bytes per element, " << stats.growths - before.growths << " growth(s)" << std::endl;
+		}
+
+		/* prints the ratio tested / reference of the medians (TEXT format only) */
+		void	compare(const BenchmarkResult &tested, const BenchmarkResult &reference);
+
+		const std::vector<BenchmarkResult>	&results(void) const;
+
+	private:
+
+		Benchmark(const Benchmark &original);
+		Benchmark&	operator=(const Benchmark &original);
+
+		BenchmarkResult	_record(const std::string &name, std::size_t ops, std::vector<double> &samples,
+			const double *totals);
+		void			_write(std::ostream &out, bool header) const;
+		void			_printCounters(const BenchmarkResult &res) const;
+		void			_checkBaseline(const BenchmarkResult &res);
+
+		static std::map<std::string, BenchmarkResult>	&_baseline(void);
+		static std::ostream								&_records(void);
+		static std::size_t								_compared;
+		static std::size_t								_regressions;
+		static bool										_header_written;
+
+		Colors							&_col;
+		std::string						_suite;
+		std::vector<BenchmarkResult>	_results;
+		PerfCounters					_counters;
+};
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/14 12:24:59 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/15 11:58:13 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:10:25 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,7 +23,7 @@ _bdBlue(original._bdBlue), _end(original._end), _reset(original._reset) {}
 
 Colors::~Colors() {}
 
-Colors&		Colors::operator=(const Colors& original) { return *this; }; // should not be used, all member variables are constant
+Colors&		Colors::operator=(const Colors& original) { (void)original; return *this; }; // should not be used, all member variables are constant
 
 /* main colors */
 
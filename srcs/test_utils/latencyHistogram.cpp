@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latencyHistogram.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:55:19 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 04:56:47 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "latencyHistogram.hpp"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+LatencyHistogram::LatencyHistogram() : _counts(LH_BUCKETS, 0), _count(0), _sum(0), _min(~0ULL), _max(0) {}
+
+LatencyHistogram::~LatencyHistogram() {}
+
+void	LatencyHistogram::merge(const LatencyHistogram &other)
+{
+	for (std::size_t i = 0; i < LH_BUCKETS; i++)
+		this->_counts[i] += other._counts[i];
+	this->_count += other._count;
+	this->_sum += other._sum;
+	if (other._max > this->_max)
+		this->_max = other._max;
+	if (other._min < this->_min)
+		this->_min = other._min;
+}
+
+void	LatencyHistogram::reset(void)
+{
+	this->_counts.assign(LH_BUCKETS, 0);
+	this->_count = 0;
+	this->_sum = 0;
+	this->_min = ~0ULL;
+	this->_max = 0;
+}
+
+unsigned long long	LatencyHistogram::count(void) const
+{
+	return (this->_count);
+}
+
+unsigned long long	LatencyHistogram::min(void) const
+{
+	return (this->_count ? this->_min : 0);
+}
+
+unsigned long long	LatencyHistogram::max(void) const
+{
+	return (this->_max);
+}
+
+double	LatencyHistogram::mean(void) const
+{
+	return (this->_count ? (double)this->_sum / this->_count : 0);
+}
+
+/* p in percents (99.9 for the p99.9) */
+unsigned long long	LatencyHistogram::percentile(double p) const
+{
+	unsigned long long	rank = std::ceil(p / 100 * this->_count);
+	unsigned long long	seen = 0;
+
+	if (this->_count == 0)
+		return (0);
+	if (rank < 1)
+		rank = 1;
+	for (std::size_t i = 0; i < LH_BUCKETS; i++)
+	{
+		seen += this->_counts[i];
+		if (seen >= rank)
+			return (std::min(_highest(i), this->_max));
+	}
+	return (this->_max);
+}
+
+void	LatencyHistogram::print(Colors &col, const std::string &name) const
+{
+	std::cout << col.bdYellow() << name << " latency (ns) : p50 " << this->percentile(50) << ", p90 "
+	<< this->percentile(90) << ", p99 " << this->percentile(99) << ", p99.9 " << this->percentile(99.9)
+	<< ", max " << this->_max << col.end() << " (" << this->_count << " operations, mean " << this->mean()
+	<< ")" << std::endl;
+}
+
+/* highest value counted in the bucket index */
+unsigned long long	LatencyHistogram::_highest(std::size_t index)
+{
+	std::size_t		octave;
+	int				shift;
+
+	if (index < LH_LINEAR)
+		return (index);
+	octave = (index - LH_LINEAR) / LH_HALF;
+	shift = octave + 1;
+	return ((((index - LH_LINEAR) % LH_HALF + LH_HALF) << shift) + (1ULL << shift) - 1);
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latencyHistogram.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:55:19 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 04:56:47 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LATENCYHISTOGRAM_HPP
+# define LATENCYHISTOGRAM_HPP
+
+#include	<vector>
+#include	<string>
+
+#include	"colors.hpp"
+
+/* values below 2^LH_SUB_BITS have their own bucket, above, each power of two is split in
+2^(LH_SUB_BITS - 1) buckets : 1.6% of precision with 7 bits, 3776 buckets for 64 bits values */
+# define LH_SUB_BITS		7
+# define LH_LINEAR			(1ULL << LH_SUB_BITS)
+# define LH_HALF			(1ULL << (LH_SUB_BITS - 1))
+# define LH_BUCKETS			(LH_LINEAR + (64 - LH_SUB_BITS) * LH_HALF)
+
+/*
+
+	SYNOPSIS : LatencyHistogram counts latencies (in nanoseconds) in logarithmic buckets, like
+	HdrHistogram : the memory and the relative error are fixed whatever the range of the values.
+
+	=>	record(value) is a few shifts and one increment : it can be called on every operation.
+	=>	percentile(p) returns the highest value of the bucket holding the p-th percentile (capped by the
+		maximum recorded), so it is never below the real percentile, and at most 1.6% above.
+	=>	merge(other) adds the counts of other : each thread fills its own histogram, and they are merged
+		when the threads are joined.
+	=>	print(col, name) prints the count, p50, p90, p99, p99.9 and the maximum.
+*/
+
+class LatencyHistogram
+{
+	public:
+
+		LatencyHistogram();
+		~LatencyHistogram();
+
+		void	record(unsigned long long value)
+		{
+			this->_counts[_index(value)]++;
+			this->_count++;
+			this->_sum += value;
+			if (value > this->_max)
+				this->_max = value;
+			if (value < this->_min)
+				this->_min = value;
+		}
+
+		void	merge(const LatencyHistogram &other);
+		void	reset(void);
+
+		unsigned long long	count(void) const;
+		unsigned long long	min(void) const;
+		unsigned long long	max(void) const;
+		double				mean(void) const;
+		unsigned long long	percentile(double p) const;
+
+		void	print(Colors &col, const std::string &name) const;
+
+	private:
+
+		static std::size_t	_index(unsigned long long value)
+		{
+			int		msb;
+
+			if (value < LH_LINEAR)
+				return (value);
+			msb = 63 - __builtin_clzll(value);
+			return (LH_LINEAR + (msb - LH_SUB_BITS) * LH_HALF + ((value >> (msb - LH_SUB_BITS + 1)) - LH_HALF));
+		}
+
+		static unsigned long long	_highest(std::size_t index);
+
+		std::vector<unsigned long long>		_counts;
+		unsigned long long					_count;
+		unsigned long long					_sum;
+		unsigned long long					_min;
+		unsigned long long					_max;
+};
+
+#endif
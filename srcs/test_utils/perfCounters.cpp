@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perfCounters.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:51:32 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 04:52:17 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "perfCounters.hpp"
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#include <stdint.h>
+
+static const char	*g_perf_counters[PERF_COUNTERS] = { "cycles", "instructions", "l1d_misses",
+	"llc_misses", "branch_misses", "page_faults", "context_switches" };
+
+/* value, time enabled and time running (PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING) */
+struct	perf_read_format
+{
+	uint64_t	value;
+	uint64_t	enabled;
+	uint64_t	running;
+};
+
+PerfCounters::PerfCounters() : _usage(false)
+{
+	const unsigned long long	l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+		| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+	this->_fd[PERF_CYCLES] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+	this->_fd[PERF_INSTRUCTIONS] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+	this->_fd[PERF_L1D_MISSES] = _open(PERF_TYPE_HW_CACHE, l1d_read_miss);
+	this->_fd[PERF_LLC_MISSES] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+	this->_fd[PERF_BRANCH_MISSES] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+	this->_fd[PERF_PAGE_FAULTS] = _open(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+	this->_fd[PERF_CONTEXT_SWITCHES] = _open(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES);
+	if (this->_fd[PERF_PAGE_FAULTS] < 0 || this->_fd[PERF_CONTEXT_SWITCHES] < 0)
+		this->_usage = true;
+	for (int i = 0; i < PERF_COUNTERS; i++)
+		this->_values[i] = -1;
+	std::memset(&this->_start, 0, sizeof(this->_start));
+}
+
+PerfCounters::~PerfCounters()
+{
+	for (int i = 0; i < PERF_COUNTERS; i++)
+		if (this->_fd[i] >= 0)
+			close(this->_fd[i]);
+}
+
+const char	*PerfCounters::name(int counter)
+{
+	return (g_perf_counters[counter]);
+}
+
+bool	PerfCounters::available(int counter) const
+{
+	if (counter == PERF_PAGE_FAULTS || counter == PERF_CONTEXT_SWITCHES)
+		return (true); // getrusage at least
+	return (this->_fd[counter] >= 0);
+}
+
+bool	PerfCounters::hardware(void) const
+{
+	for (int i = PERF_CYCLES; i <= PERF_BRANCH_MISSES; i++)
+		if (this->_fd[i] >= 0)
+			return (true);
+	return (false);
+}
+
+void	PerfCounters::start(void)
+{
+	if (this->_usage)
+		getrusage(RUSAGE_SELF, &this->_start);
+	for (int i = 0; i < PERF_COUNTERS; i++)
+	{
+		if (this->_fd[i] < 0)
+			continue ;
+		ioctl(this->_fd[i], PERF_EVENT_IOC_RESET, 0);
+		ioctl(this->_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+	}
+}
+
+void	PerfCounters::stop(void)
+{
+	struct rusage			end;
+	struct perf_read_format	data;
+
+	for (int i = 0; i < PERF_COUNTERS; i++)
+		if (this->_fd[i] >= 0)
+			ioctl(this->_fd[i], PERF_EVENT_IOC_DISABLE, 0);
+	for (int i = 0; i < PERF_COUNTERS; i++)
+	{
+		this->_values[i] = -1;
+		if (this->_fd[i] < 0 || read(this->_fd[i], &data, sizeof(data)) != sizeof(data))
+			continue ;
+		if (data.running > 0 && data.running < data.enabled) // multiplexed
+			this->_values[i] = (double)data.value * data.enabled / data.running;
+		else
+			this->_values[i] = data.value;
+	}
+	if (this->_usage)
+	{
+		getrusage(RUSAGE_SELF, &end);
+		this->_values[PERF_PAGE_FAULTS] = (end.ru_minflt - this->_start.ru_minflt)
+			+ (end.ru_majflt - this->_start.ru_majflt);
+		this->_values[PERF_CONTEXT_SWITCHES] = (end.ru_nvcsw - this->_start.ru_nvcsw)
+			+ (end.ru_nivcsw - this->_start.ru_nivcsw);
+	}
+}
+
+double	PerfCounters::value(int counter) const
+{
+	return (this->_values[counter]);
+}
+
+/* counter of the calling thread, on any cpu, disabled until start() */
+int	PerfCounters::_open(unsigned int type, unsigned long long config)
+{
+	struct perf_event_attr	attr;
+
+	std::memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = 1;
+	attr.exclude_kernel = (type != PERF_TYPE_SOFTWARE); // page faults and context switches happen in the kernel
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	return (syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perfCounters.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:51:32 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 04:52:17 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PERFCOUNTERS_HPP
+# define PERFCOUNTERS_HPP
+
+#include	<sys/resource.h>
+
+/* counters measured by PerfCounters, in the order of the results */
+# define PERF_CYCLES			0
+# define PERF_INSTRUCTIONS		1
+# define PERF_L1D_MISSES		2
+# define PERF_LLC_MISSES		3
+# define PERF_BRANCH_MISSES		4
+# define PERF_PAGE_FAULTS		5
+# define PERF_CONTEXT_SWITCHES	6
+# define PERF_COUNTERS			7
+
+/*
+
+	SYNOPSIS : PerfCounters reads the Linux perf_event counters of the calling thread between
+	start() and stop().
+
+	Hardware counters : cycles, instructions, L1 data cache read misses, last level cache misses and
+	branch misses (user space only). Software counters : page faults and context switches.
+
+	A counter which can not be opened (no PMU in a virtual machine, perf_event_paranoid too high,
+	kernel without perf_event...) is unavailable : value() returns -1. If the software counters are
+	unavailable too, page faults and context switches are taken from getrusage (whole process).
+
+	When the kernel multiplexes the hardware counters (more events than registers), the values are
+	scaled by the time each counter really ran.
+*/
+
+class PerfCounters
+{
+	public:
+
+		PerfCounters();
+		~PerfCounters();
+
+		static const char	*name(int counter);
+
+		bool	available(int counter) const;
+		bool	hardware(void) const; // true if at least one hardware counter is available
+
+		void	start(void);
+		void	stop(void);
+
+		/* count between the last start and stop, -1 if the counter is unavailable */
+		double	value(int counter) const;
+
+	private:
+
+		PerfCounters(const PerfCounters &original);
+		PerfCounters&	operator=(const PerfCounters &original);
+
+		static int	_open(unsigned int type, unsigned long long config);
+
+		int				_fd[PERF_COUNTERS];
+		double			_values[PERF_COUNTERS];
+		bool			_usage; // page faults and context switches from getrusage
+		struct rusage	_start;
+};
+
+#endif
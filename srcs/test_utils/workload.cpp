@@ -0,0 +1,226 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   workload.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:49:23 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:08:59 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include "workload.hpp"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+
+static const char	*g_workloads[] = { "shuffled", "uniform", "zipf", "sorted", "reverse", "clustered",
+	"sawtooth", nullptr };
+
+static const char	g_trace_magic[4] = { 'F', 'T', 'W', 'L' };
+static const uint32_t	g_trace_version = 1;
+
+Workload::Workload(const std::string &name, std::size_t count, std::size_t range, const WorkloadMix &mix)
+: _name(name), _seed(0x9e3779b97f4a7c15ULL)
+{
+	if (name.compare(0, 7, "replay:") == 0)
+	{
+		this->_load(name.substr(7));
+		return ;
+	}
+	if (isKnown(name) == false)
+		throw std::invalid_argument("Workload : unknown workload " + name);
+	if (range == 0)
+		range = 1;
+	this->_generateKeys(count, range);
+	this->_generateOps(mix);
+}
+
+Workload::~Workload() {}
+
+bool	Workload::isKnown(const std::string &name)
+{
+	if (name.compare(0, 7, "replay:") == 0)
+		return (name.size() > 7);
+	for (std::size_t i = 0; g_workloads[i]; i++)
+		if (!name.compare(g_workloads[i]))
+			return (true);
+	return (false);
+}
+
+std::string	Workload::names(void)
+{
+	std::string		res;
+
+	for (std::size_t i = 0; g_workloads[i]; i++)
+		res = res + g_workloads[i] + ", ";
+	return (res + "replay:file");
+}
+
+const char	*Workload::distribution(std::size_t i)
+{
+	if (i >= sizeof(g_workloads) / sizeof(*g_workloads))
+		return (nullptr);
+	return (g_workloads[i]);
+}
+
+const std::string	&Workload::name(void) const
+{
+	return (this->_name);
+}
+
+const std::vector<int>	&Workload::keys(void) const
+{
+	return (this->_keys);
+}
+
+const std::vector<WorkloadOp>	&Workload::ops(void) const
+{
+	return (this->_ops);
+}
+
+/* writes the operations as a trace which can be replayed with "replay:file" */
+bool	Workload::save(const std::string &file) const
+{
+	std::ofstream	out(file.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	uint64_t		count = this->_ops.size();
+
+	if (!out)
+		return (false);
+	out.write(g_trace_magic, sizeof(g_trace_magic));
+	out.write(reinterpret_cast<const char *>(&g_trace_version), sizeof(g_trace_version));
+	out.write(reinterpret_cast<const char *>(&count), sizeof(count));
+	for (std::size_t i = 0; i < this->_ops.size(); i++)
+	{
+		int32_t		key = this->_ops[i].key;
+
+		out.write(reinterpret_cast<const char *>(&this->_ops[i].op), 1);
+		out.write(reinterpret_cast<const char *>(&key), sizeof(key));
+	}
+	return (out.good());
+}
+
+/* xorshift64* */
+unsigned long long	Workload::_random(void)
+{
+	this->_seed ^= this->_seed >> 12;
+	this->_seed ^= this->_seed << 25;
+	this->_seed ^= this->_seed >> 27;
+	return (this->_seed * 0x2545f4914f6cdd1dULL);
+}
+
+void	Workload::_generateKeys(std::size_t count, std::size_t range)
+{
+	if (!this->_name.compare("shuffled"))
+	{
+		this->_keys.resize(range);
+		for (std::size_t i = 0; i < range; i++)
+			this->_keys[i] = i;
+		for (std::size_t i = range - 1; i > 0; i--) // Fisher-Yates
+			std::swap(this->_keys[i], this->_keys[this->_random() % (i + 1)]);
+		return ;
+	}
+	if (!this->_name.compare("zipf"))
+		return (this->_zipf(count, range));
+	this->_keys.resize(count);
+	for (std::size_t i = 0; i < count; i++)
+	{
+		if (!this->_name.compare("uniform"))
+			this->_keys[i] = this->_random() % range;
+		else if (!this->_name.compare("sorted"))
+			this->_keys[i] = (unsigned long long)i * range / count;
+		else if (!this->_name.compare("reverse"))
+			this->_keys[i] = (unsigned long long)(count - 1 - i) * range / count;
+		else if (!this->_name.compare("clustered") && i % 32 == 0)
+			this->_keys[i] = this->_random() % range;
+		else if (!this->_name.compare("clustered"))
+			this->_keys[i] = (this->_keys[i - i % 32] + this->_random() % 64) % range;
+		else // sawtooth
+		{
+			std::size_t		ramp = std::max<std::size_t>(count / 8, 1);
+
+			this->_keys[i] = (unsigned long long)(i % ramp) * range / ramp;
+		}
+	}
+}
+
+/* zipfian ranks computed like the YCSB generator (Gray et al., "Quickly generating billion-record
+synthetic databases"), then scrambled so that the hot keys are not the smallest ones */
+void	Workload::_zipf(std::size_t count, std::size_t range)
+{
+	const double	theta = 0.99;
+	double			zetan = 0;
+	double			zeta2 = 1 + std::pow(0.5, theta);
+	double			alpha = 1 / (1 - theta);
+	double			eta;
+
+	for (std::size_t i = 1; i <= range; i++)
+		zetan += 1 / std::pow((double)i, theta);
+	eta = (1 - std::pow(2.0 / range, 1 - theta)) / (1 - zeta2 / zetan);
+	this->_keys.resize(count);
+	for (std::size_t i = 0; i < count; i++)
+	{
+		double			u = (this->_random() >> 11) * (1.0 / 9007199254740992.0); // [0, 1)
+		double			uz = u * zetan;
+		std::size_t		rank;
+
+		if (uz < 1)
+			rank = 0;
+		else if (uz < zeta2)
+			rank = 1;
+		else
+			rank = std::min<std::size_t>(range * std::pow(eta * u - eta + 1, alpha), range - 1);
+		this->_keys[i] = ft::hash_mix(rank) % range;
+	}
+}
+
+void	Workload::_generateOps(const WorkloadMix &mix)
+{
+	unsigned int	total = mix.read + mix.write + mix.erase;
+
+	this->_ops.resize(this->_keys.size());
+	for (std::size_t i = 0; i < this->_keys.size(); i++)
+	{
+		unsigned int	draw = (total ? this->_random() % total : 0);
+
+		this->_ops[i].key = this->_keys[i];
+		if (draw < mix.read || total == 0)
+			this->_ops[i].op = WL_READ;
+		else if (draw < mix.read + mix.write)
+			this->_ops[i].op = WL_WRITE;
+		else
+			this->_ops[i].op = WL_ERASE;
+	}
+}
+
+void	Workload::_load(const std::string &file)
+{
+	std::ifstream	in(file.c_str(), std::ios::in | std::ios::binary);
+	char			magic[4];
+	uint32_t		version = 0;
+	uint64_t		count = 0;
+
+	in.read(magic, sizeof(magic));
+	in.read(reinterpret_cast<char *>(&version), sizeof(version));
+	in.read(reinterpret_cast<char *>(&count), sizeof(count));
+	if (!in || std::memcmp(magic, g_trace_magic, sizeof(magic)) || version != g_trace_version)
+		throw std::invalid_argument("Workload : can not read the trace " + file);
+	for (uint64_t i = 0; i < count; i++)
+	{
+		WorkloadOp		op;
+		int32_t			key;
+
+		in.read(reinterpret_cast<char *>(&op.op), 1);
+		in.read(reinterpret_cast<char *>(&key), sizeof(key));
+		if (!in || op.op > WL_ERASE)
+			throw std::invalid_argument("Workload : truncated or corrupted trace " + file);
+		op.key = key;
+		this->_ops.push_back(op);
+		this->_keys.push_back(key);
+	}
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   workload.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:49:23 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:08:59 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WORKLOAD_HPP
+# define WORKLOAD_HPP
+
+#include	<string>
+#include	<vector>
+
+/* operations of a workload */
+# define WL_READ		0
+# define WL_WRITE		1
+# define WL_ERASE		2
+
+/*
+
+	SYNOPSIS : Workload generates the keys and the operations used by the benchmarks.
+
+	The keys follow a distribution chosen by name :
+
+	=>	shuffled	: every key of [0, range) once, in random order (count is then range)
+	=>	uniform		: keys drawn uniformly in [0, range)
+	=>	zipf		: zipfian keys (theta 0.99, like YCSB) : a few hot keys are drawn most of the time.
+					  Ranks are scrambled with hash_mix, so the hot keys are spread in [0, range)
+	=>	sorted		: increasing keys, spread over [0, range)
+	=>	reverse		: decreasing keys, spread over [0, range)
+	=>	clustered	: runs of 32 close keys (less than 64 apart) around random centers
+	=>	sawtooth	: 8 increasing ramps over [0, range)
+	=>	replay:file	: the keys and operations of a trace saved by save(file)
+
+	Each key comes with an operation (WL_READ, WL_WRITE or WL_ERASE) drawn with the percentages of the
+	mix. The generation is deterministic (fixed seed) : two runs measure the same stream.
+
+	Trace file (native byte order) : "FTWL", a 32 bits version (1), a 64 bits count of operations,
+	then count times an 8 bits operation followed by its 32 bits key.
+*/
+
+/* percentages of reads, writes and erases */
+struct	WorkloadMix
+{
+	unsigned int	read;
+	unsigned int	write;
+	unsigned int	erase;
+};
+
+struct	WorkloadOp
+{
+	unsigned char	op;
+	int				key;
+};
+
+class Workload
+{
+	public:
+
+		/* throws std::invalid_argument if name is unknown or the trace can not be read */
+		Workload(const std::string &name, std::size_t count, std::size_t range, const WorkloadMix &mix);
+		~Workload();
+
+		static bool			isKnown(const std::string &name);
+		static std::string	names(void); // known names, for the usage
+		static const char	*distribution(std::size_t i); // i-th generated distribution, nullptr past the last
+
+		const std::string				&name(void) const;
+		const std::vector<int>			&keys(void) const;
+		const std::vector<WorkloadOp>	&ops(void) const;
+
+		bool	save(const std::string &file) const;
+
+	private:
+
+		Workload(const Workload &original);
+		Workload&	operator=(const Workload &original);
+
+		unsigned long long	_random(void);
+		void				_generateKeys(std::size_t count, std::size_t range);
+		void				_zipf(std::size_t count, std::size_t range);
+		void				_generateOps(const WorkloadMix &mix);
+		void				_load(const std::string &file);
+
+		std::string					_name;
+		unsigned long long			_seed;
+		std::vector<int>			_keys;
+		std::vector<WorkloadOp>		_ops;
+};
+
+#endif
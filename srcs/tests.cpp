@@ -6,11 +6,13 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/14 11:24:34 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/15 17:57:44 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:56:22 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../includes/test_includes.hpp"
+#include <cstdlib>
+#include <cstdio>
 
 #if 1 //CREATE A REAL STL EXAMPLE
 	#include <map>
@@ -26,11 +28,118 @@
 /* case wrong instructions, to explain to user how to use it */
 void	print_usage(void)
 {
-	std::cout << "Add only one arg when launching the program" << std::endl;
+	std::cout << "Add one test name when launching the program, then the options if any" << std::endl;
 	std::cout << "Choose one of those : " << std::endl;
 	std::cout << "map    : triggers maps tests" << std::endl;
 	std::cout << "tree   : triggers binary search tree tests" << std::endl;
 	std::cout << "vector : triggers vectors tests" << std::endl;
+	std::cout << "deque  : triggers deques tests" << std::endl;
+	std::cout << "adapters : triggers stack, queue and priority queues tests" << std::endl;
+	std::cout << "bench  : triggers the benchmarks of vectors, sorts and maps only" << std::endl;
+	std::cout << "sort   : triggers the benchmarks of ft::sort against std::sort on every key distribution"
+	<< std::endl;
+	std::cout << "arena  : triggers the benchmarks of the arena allocator against std::allocator" << std::endl;
+	std::cout << "ring   : triggers the benchmarks of the ring buffers between threads" << std::endl;
+	std::cout << "parallel : triggers the benchmarks of the parallel algorithms from 1 thread to one per CPU"
+	<< std::endl;
+	std::cout << "Options of the benchmarks (after the test name) : " << std::endl;
+	std::cout << "--reps n          : measures each benchmark n times (default 5)" << std::endl;
+	std::cout << "--warmup n        : runs each benchmark n times before measuring it (default 1)" << std::endl;
+	std::cout << "--format f        : text, csv or json (default text)" << std::endl;
+	std::cout << "--output file     : appends the csv or json results to file" << std::endl;
+	std::cout << "--baseline file   : compares the results to a csv file of a previous run" << std::endl;
+	std::cout << "--threshold pct   : a benchmark more than pct % slower than the baseline regresses (default 10)"
+	<< std::endl;
+	std::cout << "--workload name   : keys of the benchmarks, one of " << Workload::names() << " (default shuffled)"
+	<< std::endl;
+	std::cout << "--mix r/w/e       : percentages of reads, writes and erases of the workload (default 80/15/5)"
+	<< std::endl;
+	std::cout << "--counters on|off : reads the perf_event counters (cycles, cache misses...) (default on)"
+	<< std::endl;
+	std::cout << "With --baseline, each benchmark is measured 15 times unless --reps is given, and the program"
+	<< " exits with 1 if one of them regresses" << std::endl;
+}
+
+/* true if name is a workload which can be generated (or a trace which can be read) */
+static bool	is_workload(const std::string &name)
+{
+	if (Workload::isKnown(name) == false)
+		return (false);
+	try
+	{
+		Workload	workload(name, 0, 0, Benchmark::config().mix);
+	}
+	catch (const std::exception &e)
+	{
+		return (false);
+	}
+	return (true);
+}
+
+/* reads the options of the benchmarks, returns false if one is wrong */
+static bool	parse_options(int argc, char **argv, Colors &col)
+{
+	BenchmarkConfig		&config = Benchmark::config();
+	bool				reps = false;
+	bool				baseline = false;
+
+	for (int i = 2; i < argc; i += 2)
+	{
+		std::string		opt(argv[i]);
+		std::string		val(i + 1 < argc ? argv[i + 1] : "");
+		char			*end = nullptr;
+		char			extra;
+		bool			valid = (i + 1 < argc);
+
+		if (valid == false)
+			;
+		else if (!opt.compare("--reps"))
+		{
+			config.reps = std::strtoul(val.c_str(), &end, 10);
+			valid = (*end == '\0' && config.reps > 0);
+			reps = true;
+		}
+		else if (!opt.compare("--warmup"))
+		{
+			config.warmup = std::strtoul(val.c_str(), &end, 10);
+			valid = (*end == '\0');
+		}
+		else if (!opt.compare("--threshold"))
+		{
+			config.threshold = std::strtod(val.c_str(), &end) / 100;
+			valid = (*end == '\0' && config.threshold >= 0);
+		}
+		else if (!opt.compare("--output"))
+			config.output = val;
+		else if (!opt.compare("--format") && !val.compare("text"))
+			config.format = BENCH_TEXT;
+		else if (!opt.compare("--format") && !val.compare("csv"))
+			config.format = BENCH_CSV;
+		else if (!opt.compare("--format") && !val.compare("json"))
+			config.format = BENCH_JSON;
+		else if (!opt.compare("--counters") && (!val.compare("on") || !val.compare("off")))
+			config.counters = !val.compare("on");
+		else if (!opt.compare("--workload"))
+		{
+			config.workload = val;
+			valid = is_workload(val);
+		}
+		else if (!opt.compare("--mix"))
+			valid = (std::sscanf(val.c_str(), "%u/%u/%u%c", &config.mix.read, &config.mix.write,
+				&config.mix.erase, &extra) == 3 && config.mix.read + config.mix.write + config.mix.erase > 0);
+		else if (!opt.compare("--baseline"))
+			valid = baseline = Benchmark::loadBaseline(val);
+		else
+			valid = false;
+		if (valid == false)
+		{
+			std::cout << col.bdRed() << "Wrong option : " << opt << " " << val << col.reset() << std::endl;
+			return (false);
+		}
+	}
+	if (baseline && reps == false)
+		config.reps = 15; // a median of 5 runs is too noisy to fail a build on it
+	return (true);
 }
 
 /* trigger for a test */
@@ -38,31 +147,71 @@ int main(int argc, char **argv) // to test
 {
 	Colors			col;
 	
-	if (argc != 2)
+	if (argc < 2)
 	{
 		std::cout << col.bdRed() << "Wrong number of arguments !!!" << col.reset() << std::endl;
 		print_usage();
 		return (0);
 	}
+	if (parse_options(argc, argv, col) == false)
+	{
+		print_usage();
+		return (2);
+	}
+	Benchmark::separateOutput();
 	
 	std::string		arg(argv[1]);
 
 	if (!arg.compare("map"))
 	{
-		//map_verif_procedure(col);
-		// add map speedtest procedure
+		map_verif_procedure(col);
+		map_speedtest(col);
 	}
 	else if (!arg.compare("tree"))
 	{
 		tree_verification(col);
+		tree_speedtest(col);
 	}
 	else if (!arg.compare("vector")) 
 	{
 		vector_verif_procedure(col);
-		// add vector speedtest procedure
+		vector_speedtest(col);
+	}
+	else if (!arg.compare("deque"))
+	{
+		deque_verif_procedure(col);
+		deque_speedtest(col);
+	}
+	else if (!arg.compare("adapters"))
+	{
+		adapters_verif_procedure(col);
+		adapters_speedtest(col);
+		heap_speedtest(col);
+	}
+	else if (!arg.compare("sort"))
+		sort_speedtest(col, true);
+	else if (!arg.compare("arena"))
+		arena_speedtest(col);
+	else if (!arg.compare("ring"))
+		ring_speedtest(col);
+	else if (!arg.compare("parallel"))
+		parallel_speedtest(col);
+	else if (!arg.compare("bench"))
+	{
+		vector_speedtest(col);
+		sort_speedtest(col, false);
+		map_operations_speedtest(col);
 	}
 	else
 		std::cout << col.bdRed() << "Wrong type of argument" << col.reset() << std::endl;
 	std::cout << col.bdGreen() << "Testing procedure complete" << col.end() << std::endl;
+	if (Benchmark::compared() > 0)
+	{
+		std::cout << (Benchmark::regressions() ? col.bdRed() : col.bdGreen()) << Benchmark::compared()
+		<< " benchmark(s) compared to the baseline, " << Benchmark::regressions() << " regression(s)"
+		<< col.reset() << std::endl;
+		if (Benchmark::regressions() > 0)
+			return (1);
+	}
 	return (0);
 }
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_speedtests.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:03:53 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 08:56:28 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include "../test_utils/benchmark.hpp"
+#include <vector>
+#include <map>
+
+/* speedtests of ft::arena_allocator against std::allocator on a request shaped work : each request
+builds a few vectors and a map, reads them and throws them away. With the arena, the containers
+allocate by moving a pointer forward, free nothing, and the arena is reset at the end of the request */
+
+static const std::size_t	g_arena_requests = 20000;
+static const std::size_t	g_arena_vectors = 4; // vectors per request (listed in request_task)
+
+/* sizes of the vectors and the maps of each request, and the keys of the maps */
+struct	request_shapes
+{
+	std::vector<std::size_t>	vector_sizes;
+	std::vector<std::size_t>	map_sizes;
+	std::vector<int>			keys;
+
+	request_shapes(void)
+	{
+		unsigned long	seed = 42;
+
+		for (std::size_t r = 0; r < g_arena_requests; r++)
+		{
+			for (std::size_t v = 0; v < g_arena_vectors; v++)
+			{
+				seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+				this->vector_sizes.push_back(16 + (seed >> 33) % 497);
+			}
+			seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+			this->map_sizes.push_back(32 + (seed >> 33) % 225);
+		}
+		for (std::size_t k = 0; k < 256; k++)
+		{
+			seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+			this->keys.push_back(static_cast<int>((seed >> 33) % 100000));
+		}
+	}
+};
+
+/* the allocator given to the containers of a request : on the arena for an arena_allocator */
+template <class A>
+static A	request_allocator(ft::arena *arena, const A *)
+{
+	(void)arena;
+	return (A());
+}
+
+template <class T>
+static ft::arena_allocator<T>	request_allocator(ft::arena *arena, const ft::arena_allocator<T> *)
+{
+	return (ft::arena_allocator<T>(*arena));
+}
+
+/* benchmark task : g_arena_requests requests. arena is nullptr for the containers on std::allocator */
+template <class Vector, class Map>
+class request_task
+{
+	public:
+
+		typedef typename Vector::allocator_type		vector_allocator;
+		typedef typename Map::allocator_type		map_allocator;
+		typedef typename Map::value_type			map_value;
+
+		request_task(const request_shapes &shapes, ft::arena *arena) : _shapes(shapes), _arena(arena),
+		_checksum(0) {}
+
+		void	setUp(void) {}
+
+		void	operator()(void)
+		{
+			std::size_t		sum = 0;
+
+			for (std::size_t r = 0; r < g_arena_requests; r++)
+			{
+				{
+					vector_allocator	alloc(request_allocator(this->_arena, static_cast<const vector_allocator *>(nullptr)));
+					Vector				vectors[g_arena_vectors] = { Vector(alloc), Vector(alloc), Vector(alloc), Vector(alloc) };
+					Map					index(std::less<int>(),
+						request_allocator(this->_arena, static_cast<const map_allocator *>(nullptr)));
+
+					for (std::size_t v = 0; v < g_arena_vectors; v++)
+						for (std::size_t i = 0; i < this->_shapes.vector_sizes[r * g_arena_vectors + v]; i++)
+							vectors[v].push_back(static_cast<int>(i + r));
+					for (std::size_t i = 0; i < this->_shapes.map_sizes[r]; i++)
+						index.insert(map_value(this->_shapes.keys[i], static_cast<int>(i)));
+					for (std::size_t v = 0; v < g_arena_vectors; v++)
+						for (std::size_t i = 0; i < vectors[v].size(); i += 8)
+							sum += vectors[v][i];
+					for (std::size_t i = 0; i < this->_shapes.map_sizes[r]; i += 4)
+						sum += index.find(this->_shapes.keys[i])->second;
+					sum += index.size();
+				}
+				if (this->_arena)
+					this->_arena->reset();
+			}
+			this->_checksum += sum;
+			doNotOptimize(sum);
+		}
+
+		std::size_t	checksum(void) const { return (this->_checksum); }
+
+	private:
+
+		const request_shapes	&_shapes;
+		ft::arena				*_arena;
+		std::size_t				_checksum;
+};
+
+/* the same requests on std::allocator then on an arena, for one pair of containers */
+template <class Vector, class Map, class ArenaVector, class ArenaMap>
+static void	arena_compare(Colors &col, const std::string &name, const request_shapes &shapes)
+{
+	Benchmark								arena_bench(col, "ft::arena_allocator");
+	Benchmark								std_bench(col, "std::allocator");
+	ft::arena								arena;
+	request_task<ArenaVector, ArenaMap>		arena_task(shapes, &arena);
+	request_task<Vector, Map>				std_task(shapes, nullptr);
+
+	separator(col);
+	std::cout << "testing " << g_arena_requests << " requests of " << g_arena_vectors << " " << name
+	<< "..." << std::endl;
+	BenchmarkResult		arena_res = arena_bench.run(name + " requests", arena_task, g_arena_requests);
+	BenchmarkResult		std_res = std_bench.run(name + " requests", std_task, g_arena_requests);
+	arena_bench.compare(arena_res, std_res);
+	std::cout << "arena : " << arena.reserved() << " bytes of chunks kept between the requests" << std::endl;
+	if (arena_task.checksum() != std_task.checksum())
+		std::cout << col.bdRed() << "different results on the arena and on std::allocator" << col.reset()
+		<< std::endl;
+}
+
+void	arena_speedtest(Colors &col)
+{
+	request_shapes	shapes;
+
+	std::cout << col.bdYellow() << "Starting speedtest for arena allocators..." << col.reset() << std::endl;
+	arena_compare<ft::vector<int>, ft::map<int, int>,
+		ft::vector<int, ft::arena_allocator<int> >,
+		ft::map<int, int, std::less<int>, ft::arena_allocator<ft::pair<const int, int> > > >
+		(col, "ft::vector and an ft::map", shapes);
+	arena_compare<std::vector<int>, std::map<int, int>,
+		std::vector<int, ft::arena_allocator<int> >,
+		std::map<int, int, std::less<int>, ft::arena_allocator<std::pair<const int, int> > > >
+		(col, "std::vector and a std::map", shapes);
+	std::cout << col.bdYellow() << "End of speedtest for arena allocators" << col.reset() << std::endl;
+}
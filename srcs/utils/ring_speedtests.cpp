@@ -0,0 +1,297 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ring_speedtests.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:51:23 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 06:03:10 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include <deque>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/* multithreaded speedtests of the ring buffers against a std::deque behind a mutex (what the pipelines
+used before). Throughput : producers push items in batches, consumers pop them until every item went
+through, each thread pinned on its own CPU when there are enough of them (wall time, in millions of
+items per second). Latency : a ping-pong between two threads through two rings, half of each round trip
+in the histogram */
+
+static const std::size_t	g_ring_items = 4000000; // per producer
+static const std::size_t	g_ring_capacity = 1024;
+static const std::size_t	g_ping_pongs = 100000;
+
+/* the reference, with the interface of the rings */
+class	locked_deque
+{
+	public:
+
+		explicit locked_deque(std::size_t capacity) : _capacity(capacity) { pthread_mutex_init(&this->_lock, nullptr); }
+		~locked_deque() { pthread_mutex_destroy(&this->_lock); }
+
+		template <class InputIterator>
+		std::size_t	try_push_n(InputIterator first, std::size_t n)
+		{
+			pthread_mutex_lock(&this->_lock);
+			if (n > this->_capacity - this->_deque.size())
+				n = this->_capacity - this->_deque.size();
+			for (std::size_t i = 0; i < n; i++, ++first)
+				this->_deque.push_back(*first);
+			pthread_mutex_unlock(&this->_lock);
+			return (n);
+		}
+
+		template <class OutputIterator>
+		std::size_t	try_pop_n(OutputIterator out, std::size_t n)
+		{
+			pthread_mutex_lock(&this->_lock);
+			if (n > this->_deque.size())
+				n = this->_deque.size();
+			for (std::size_t i = 0; i < n; i++, ++out)
+			{
+				*out = this->_deque.front();
+				this->_deque.pop_front();
+			}
+			pthread_mutex_unlock(&this->_lock);
+			return (n);
+		}
+
+	private:
+
+		locked_deque(const locked_deque &original);
+		locked_deque&	operator=(const locked_deque &original);
+
+		pthread_mutex_t		_lock;
+		std::deque<long>	_deque;
+		std::size_t			_capacity;
+};
+
+/* what a thread has to do. The consumers share consumed, and stop when every item is popped */
+template <class Ring>
+struct	ring_job
+{
+	Ring				*ring;
+	std::size_t			batch;
+	std::size_t			total;
+	volatile std::size_t	*consumed;
+	long				sum;
+	int					cpu;
+};
+
+static double	ring_wall_time(void)
+{
+	struct timespec		ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/* one CPU per thread if there are enough, otherwise the scheduler decides. cpu -1 : every CPU again */
+static void	pin_thread(int cpu)
+{
+	long		cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	cpu_set_t	set;
+
+	if (cpus < 2)
+		return ;
+	CPU_ZERO(&set);
+	for (long i = 0; i < cpus; i++)
+		if (cpu < 0 || i == cpu % cpus)
+			CPU_SET(i, &set);
+	pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+template <class Ring>
+static void	*ring_producer(void *arg)
+{
+	ring_job<Ring>		*job = static_cast<ring_job<Ring>*>(arg);
+	std::vector<long>	items(job->batch);
+	std::size_t			pushed;
+	std::size_t			n;
+
+	pin_thread(job->cpu);
+	for (std::size_t i = 0; i < g_ring_items; i += job->batch)
+	{
+		for (std::size_t k = 0; k < job->batch; k++)
+			items[k] = static_cast<long>(i + k);
+		pushed = 0;
+		while (pushed < job->batch)
+		{
+			n = job->ring->try_push_n(items.begin() + pushed, job->batch - pushed);
+			if (n == 0)
+				sched_yield();
+			pushed += n;
+		}
+	}
+	return (nullptr);
+}
+
+template <class Ring>
+static void	*ring_consumer(void *arg)
+{
+	ring_job<Ring>		*job = static_cast<ring_job<Ring>*>(arg);
+	std::vector<long>	items(job->batch);
+	std::size_t			n;
+
+	pin_thread(job->cpu);
+	while (__atomic_load_n(job->consumed, __ATOMIC_RELAXED) < job->total)
+	{
+		n = job->ring->try_pop_n(items.begin(), job->batch);
+		if (n == 0)
+		{
+			sched_yield();
+			continue ;
+		}
+		for (std::size_t k = 0; k < n; k++)
+			job->sum += items[k];
+		__sync_fetch_and_add(job->consumed, n);
+	}
+	return (nullptr);
+}
+
+/* producers and consumers threads on a new ring, returns the throughput in millions of items per second.
+sum gets the sum of the items popped (it is checked : each item goes through once) */
+template <class Ring>
+static double	run_pipeline(int producers, int consumers, std::size_t batch, long &sum)
+{
+	Ring							ring(g_ring_capacity);
+	volatile std::size_t			consumed = 0;
+	std::vector<pthread_t>			ids(producers + consumers);
+	std::vector<ring_job<Ring> >	jobs(producers + consumers);
+	double							start;
+
+	for (int i = 0; i < producers + consumers; i++)
+	{
+		jobs[i].ring = &ring;
+		jobs[i].batch = batch;
+		jobs[i].total = g_ring_items * producers;
+		jobs[i].consumed = &consumed;
+		jobs[i].sum = 0;
+		jobs[i].cpu = i;
+	}
+	start = ring_wall_time();
+	for (int i = 0; i < producers + consumers; i++)
+		pthread_create(&ids[i], nullptr, (i < producers ? &ring_producer<Ring> : &ring_consumer<Ring>), &jobs[i]);
+	sum = 0;
+	for (int i = 0; i < producers + consumers; i++)
+	{
+		pthread_join(ids[i], nullptr);
+		sum += jobs[i].sum;
+	}
+	return ((double)g_ring_items * producers / (ring_wall_time() - start) / 1e6);
+}
+
+/* the ping-pong : the main thread sends a timestamp on there, the other thread sends it back */
+template <class Ring>
+struct	ping_pong
+{
+	Ring	there;
+	Ring	back;
+
+	ping_pong(void) : there(2), back(2) {}
+};
+
+template <class Ring>
+static void	*pong(void *arg)
+{
+	ping_pong<Ring>		*rings = static_cast<ping_pong<Ring>*>(arg);
+	long				val;
+
+	pin_thread(1);
+	for (std::size_t i = 0; i < g_ping_pongs; i++)
+	{
+		while (rings->there.try_pop_n(&val, 1) == 0)
+			sched_yield();
+		while (rings->back.try_push_n(&val, 1) == 0)
+			sched_yield();
+	}
+	return (nullptr);
+}
+
+template <class Ring>
+static void	run_ping_pong(LatencyHistogram &latency)
+{
+	ping_pong<Ring>		rings;
+	pthread_t			id;
+	long				val;
+	double				start;
+
+	pthread_create(&id, nullptr, &pong<Ring>, &rings);
+	pin_thread(0);
+	for (std::size_t i = 0; i < g_ping_pongs; i++)
+	{
+		val = static_cast<long>(i);
+		start = Benchmark::now();
+		while (rings.there.try_push_n(&val, 1) == 0)
+			sched_yield();
+		while (rings.back.try_pop_n(&val, 1) == 0)
+			sched_yield();
+		latency.record(static_cast<unsigned long long>((Benchmark::now() - start) / 2));
+	}
+	pthread_join(id, nullptr);
+	pin_thread(-1);
+}
+
+/* prints one line of throughput, compared to the deque behind a mutex */
+template <class Ring>
+static void	print_pipeline(Colors &col, const std::string &name, int producers, int consumers, std::size_t batch,
+	double reference)
+{
+	const long		expected = (long)producers * (long)(g_ring_items - 1) * (long)g_ring_items / 2;
+	long			sum;
+	double			rate = run_pipeline<Ring>(producers, consumers, batch, sum);
+
+	std::cout << col.bdYellow() << "    " << name << ", batches of " << batch << " : " << rate << " Mitems/s";
+	if (reference > 0)
+		std::cout << " (x" << rate / reference << ")";
+	std::cout << col.end() << (sum == expected ? "" : " WRONG SUM") << std::endl;
+}
+
+void	ring_speedtest(Colors &col)
+{
+	const int			shapes[2][2] = {{1, 1}, {2, 2}};
+	long				sum;
+
+	std::cout << col.bdYellow() << "Starting speedtest for ring buffers..." << col.reset() << std::endl;
+	for (int s = 0; s < 2; s++)
+	{
+		int			producers = shapes[s][0];
+		int			consumers = shapes[s][1];
+		double		reference = run_pipeline<locked_deque>(producers, consumers, 1, sum);
+
+		separator(col);
+		std::cout << producers << " producer(s), " << consumers << " consumer(s), " << g_ring_items
+		<< " items per producer, capacity " << g_ring_capacity << std::endl;
+		std::cout << col.bdYellow() << "    std::deque + mutex, batches of 1 : " << reference << " Mitems/s"
+		<< col.end() << std::endl;
+		print_pipeline<locked_deque>(col, "std::deque + mutex", producers, consumers, 64, reference);
+		if (producers == 1 && consumers == 1)
+		{
+			print_pipeline<ft::spsc_ring<long> >(col, "ft::spsc_ring", 1, 1, 1, reference);
+			print_pipeline<ft::spsc_ring<long> >(col, "ft::spsc_ring", 1, 1, 64, reference);
+		}
+		print_pipeline<ft::mpmc_ring<long> >(col, "ft::mpmc_ring", producers, consumers, 1, reference);
+		print_pipeline<ft::mpmc_ring<long> >(col, "ft::mpmc_ring", producers, consumers, 64, reference);
+	}
+	separator(col);
+	std::cout << "latency of one hop, ping-pong of " << g_ping_pongs << " items between two threads (ns)" << std::endl;
+	{
+		LatencyHistogram	locked;
+		LatencyHistogram	spsc;
+		LatencyHistogram	mpmc;
+
+		run_ping_pong<locked_deque>(locked);
+		run_ping_pong<ft::spsc_ring<long> >(spsc);
+		run_ping_pong<ft::mpmc_ring<long> >(mpmc);
+		locked.print(col, "std::deque + mutex");
+		spsc.print(col, "ft::spsc_ring");
+		mpmc.print(col, "ft::mpmc_ring");
+	}
+	std::cout << col.bdYellow() << "End of speedtest for ring buffers" << col.reset() << std::endl;
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_speedtests.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:15:10 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:26:09 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include "../test_utils/benchmark.hpp"
+#include <sstream>
+#include <unistd.h>
+
+/* scaling of the parallel algorithms on a ft::vector of 10M ints : each of them runs on a pool of 1
+thread (the sequential code, run inline), then 2, 4... up to the number of online CPUs, and the median
+is compared to the one of the single thread. The reduction checks that its result does not depend on
+the number of threads */
+
+enum e_parallel_feature
+{
+	PARALLEL_FOR,
+	PARALLEL_TRANSFORM,
+	PARALLEL_REDUCE,
+	PARALLEL_SCAN,
+	PARALLEL_SORT,
+	PARALLEL_FEATURES
+};
+
+static const char	*g_parallel_features[PARALLEL_FEATURES] = {
+	"parallel_for",
+	"parallel_transform",
+	"parallel_reduce",
+	"parallel_inclusive_scan",
+	"parallel_sort"
+};
+
+static const std::size_t	g_parallel_size = 10000000;
+
+/* a few instructions per element, not only a memory copy */
+struct scramble
+{
+	int		operator()(int x) const { return ((x ^ (x >> 7)) * 0x45d9f3b); }
+};
+
+struct scramble_in_place
+{
+	void	operator()(int &x) const { x = scramble()(x); }
+};
+
+struct sum_long
+{
+	long	operator()(long a, long b) const { return (a + b); }
+};
+
+/* benchmark task : setUp copies the values, operator() runs one algorithm on the pool */
+class parallel_task
+{
+	public:
+
+		parallel_task(const ft::vector<int> &values, ft::thread_pool &pool) : _values(values), _pool(pool),
+		_feature(PARALLEL_FOR), _sum(0) {}
+
+		void	feature(int f) { this->_feature = f; }
+		long	sum(void) const { return (this->_sum); }
+
+		void	setUp(void)
+		{
+			if (this->_feature == PARALLEL_FOR || this->_feature == PARALLEL_SORT)
+				this->_vect = this->_values;
+			else if (this->_out.size() != this->_values.size())
+				this->_out.assign(this->_values.size(), 0);
+		}
+
+		void	operator()(void)
+		{
+			switch (this->_feature)
+			{
+				case PARALLEL_FOR:
+					ft::parallel_for(this->_pool, this->_vect.begin(), this->_vect.end(), scramble_in_place());
+					doNotOptimize(this->_vect[this->_vect.size() / 2]);
+					break ;
+				case PARALLEL_TRANSFORM:
+					ft::parallel_transform(this->_pool, this->_values.cbegin(), this->_values.cend(),
+						this->_out.begin(), scramble());
+					doNotOptimize(this->_out[this->_out.size() / 2]);
+					break ;
+				case PARALLEL_REDUCE:
+					this->_sum = ft::parallel_reduce(this->_pool, this->_values.cbegin(), this->_values.cend(), 0L,
+						sum_long());
+					doNotOptimize(this->_sum);
+					break ;
+				case PARALLEL_SCAN:
+					ft::parallel_inclusive_scan(this->_pool, this->_values.cbegin(), this->_values.cend(),
+						this->_out.begin(), std::plus<int>());
+					doNotOptimize(this->_out[this->_out.size() - 1]);
+					break ;
+				case PARALLEL_SORT:
+					ft::parallel_sort(this->_pool, this->_vect.begin(), this->_vect.end());
+					doNotOptimize(this->_vect[this->_vect.size() / 2]);
+					break ;
+			}
+		}
+
+	private:
+
+		const ft::vector<int>	&_values;
+		ft::thread_pool			&_pool;
+		ft::vector<int>			_vect;
+		ft::vector<int>			_out;
+		int						_feature;
+		long					_sum;
+};
+
+void	parallel_speedtest(Colors &col)
+{
+	Workload							workload(Benchmark::config().workload, g_parallel_size, g_parallel_size,
+		Benchmark::config().mix);
+	ft::vector<int>						values(workload.keys().begin(), workload.keys().end());
+	std::vector<BenchmarkResult>		single(PARALLEL_FEATURES);
+	long								cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	long								reference_sum = 0;
+
+	std::cout << col.bdYellow() << "Starting scaling speedtest for parallel algorithms (" << values.size()
+	<< " ints, grain " << ft::parallel_grain << ")..." << col.reset() << std::endl;
+	if (values.empty())
+		return ;
+	if (cpus < 1)
+		cpus = 1;
+	for (long threads = 1; threads <= cpus; threads *= 2)
+	{
+		std::ostringstream	suite;
+
+		suite << "ft x" << threads;
+
+		ft::thread_pool		pool(threads);
+		Benchmark			bench(col, suite.str());
+		parallel_task		task(values, pool);
+
+		separator(col);
+		for (int f = 0; f < PARALLEL_FEATURES; f++)
+		{
+			std::cout << "testing " << g_parallel_features[f] << " on " << threads << " thread(s)..." << std::endl;
+			task.feature(f);
+			BenchmarkResult		res = bench.run(g_parallel_features[f], task, values.size());
+			if (threads == 1)
+				single[f] = res;
+			else
+				bench.compare(res, single[f]);
+		}
+		if (threads == 1)
+			reference_sum = task.sum();
+		else if (task.sum() != reference_sum)
+			std::cout << col.bdRed() << "parallel_reduce : " << task.sum() << " on " << threads
+			<< " threads, " << reference_sum << " on 1" << col.reset() << std::endl;
+		std::cout << "    work stolen " << pool.steals() << " time(s)" << std::endl;
+		if (threads * 2 > cpus && threads != cpus)
+			threads = cpus / 2; // the last round uses every CPU
+	}
+	separator(col);
+	std::cout << col.bdYellow() << "End of scaling speedtest for parallel algorithms" << col.reset() << std::endl;
+}
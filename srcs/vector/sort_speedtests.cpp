@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_speedtests.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:07:29 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:07:29 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include "../test_utils/benchmark.hpp"
+#include <algorithm>
+
+/* speedtests of ft::sort and ft::stable_sort against std::sort and std::stable_sort, on ints and on pairs
+(key, position) whose keys come from the distributions of the workload generator. Without comparator,
+ft sorts the ints and the pairs with a radix sort ; with one, it runs an introsort or a merge sort */
+
+enum e_sort_feature
+{
+	SORT,
+	SORT_COMPARATOR,
+	STABLE_SORT,
+	STABLE_SORT_COMPARATOR,
+	SORT_FEATURES
+};
+
+static const char	*g_sort_features[SORT_FEATURES] = {
+	"sort",
+	"sort (comparator)",
+	"stable_sort",
+	"stable_sort (comparator)"
+};
+
+static const std::size_t	g_sort_size = 1000000;
+
+/* compares the keys only : the stable sorts keep the positions of equal keys in order */
+struct key_less
+{
+	bool	operator()(int a, int b) const { return (a < b); }
+	bool	operator()(const ft::pair<int, int> &a, const ft::pair<int, int> &b) const { return (a.first < b.first); }
+};
+
+/* benchmark task : setUp copies the unsorted values, operator() sorts them with ft or std */
+template <class Value>
+class sort_task
+{
+	public:
+
+		sort_task(const std::vector<Value> &values, bool ft) : _values(values), _ft(ft), _feature(SORT) {}
+
+		void	feature(int f) { this->_feature = f; }
+
+		void	setUp(void) { this->_vect = this->_values; }
+
+		void	operator()(void)
+		{
+			typename std::vector<Value>::iterator	first = this->_vect.begin();
+			typename std::vector<Value>::iterator	last = this->_vect.end();
+
+			switch (this->_feature)
+			{
+				case SORT:
+					if (this->_ft)
+						ft::sort(first, last);
+					else
+						std::sort(first, last);
+					break ;
+				case SORT_COMPARATOR:
+					if (this->_ft)
+						ft::sort(first, last, key_less());
+					else
+						std::sort(first, last, key_less());
+					break ;
+				case STABLE_SORT:
+					if (this->_ft)
+						ft::stable_sort(first, last);
+					else
+						std::stable_sort(first, last);
+					break ;
+				case STABLE_SORT_COMPARATOR:
+					if (this->_ft)
+						ft::stable_sort(first, last, key_less());
+					else
+						std::stable_sort(first, last, key_less());
+					break ;
+			}
+			doNotOptimize(this->_vect[this->_vect.size() / 2]);
+		}
+
+	private:
+
+		const std::vector<Value>	&_values;
+		std::vector<Value>			_vect;
+		bool						_ft;
+		int							_feature;
+};
+
+template <class Value>
+static void	sort_suite(Benchmark &ft_bench, Benchmark &std_bench, const std::vector<Value> &values,
+	const std::string &suffix)
+{
+	sort_task<Value>	ft_task(values, true);
+	sort_task<Value>	std_task(values, false);
+
+	for (int f = 0; f < SORT_FEATURES; f++)
+	{
+		std::cout << "testing " << g_sort_features[f] << suffix << "..." << std::endl;
+		ft_task.feature(f);
+		std_task.feature(f);
+		BenchmarkResult		ft_res = ft_bench.run(g_sort_features[f] + suffix, ft_task, values.size());
+		BenchmarkResult		std_res = std_bench.run(g_sort_features[f] + suffix, std_task, values.size());
+		ft_bench.compare(ft_res, std_res);
+	}
+}
+
+static void	sort_distribution_speedtest(Colors &col, Benchmark &ft_bench, Benchmark &std_bench,
+	const std::string &name)
+{
+	Workload								workload(name, g_sort_size, g_sort_size, Benchmark::config().mix);
+	const std::vector<int>					&keys = workload.keys();
+	std::vector<ft::pair<int, int> >		pairs(keys.size());
+
+	for (std::size_t i = 0; i < keys.size(); i++)
+		pairs[i] = ft::make_pair(keys[i], static_cast<int>(i));
+	sort_suite(ft_bench, std_bench, keys, " <int> [" + workload.name() + "]");
+	sort_suite(ft_bench, std_bench, pairs, " <pair> [" + workload.name() + "]");
+	separator(col);
+}
+
+/* all_distributions : every generated distribution, otherwise the workload of Benchmark::config() only */
+void	sort_speedtest(Colors &col, bool all_distributions)
+{
+	Benchmark		ft_bench(col, "ft");
+	Benchmark		std_bench(col, "std");
+
+	std::cout << col.bdYellow() << "Starting speedtest for sorts..." << col.reset() << std::endl;
+	if (all_distributions == false)
+		sort_distribution_speedtest(col, ft_bench, std_bench, Benchmark::config().workload);
+	else
+		for (std::size_t i = 0; Workload::distribution(i) != nullptr; i++)
+			sort_distribution_speedtest(col, ft_bench, std_bench, Workload::distribution(i));
+	std::cout << col.bdYellow() << "End of speedtests for sorts" << col.reset() << std::endl;
+}
@@ -0,0 +1,185 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_bool_speedtests.cpp                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:29:54 by cjulienn          #+#    #+#             */
+/*   Updated: 2026/10/19 05:31:10 by cjulienn         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/test_includes.hpp"
+#include "../test_utils/benchmark.hpp"
+#include <algorithm>
+
+/* speedtests of the bit-packed ft::vector<bool> against std::vector<bool> (bit-packed too, scanned bit
+per bit by the STL algorithms) and std::vector<char> (one byte per flag) : memory used by the flags,
+then scans over 64M flags of which 1 in 64 is set (count, every set flag, and of two vectors) */
+
+enum e_flags_feature
+{
+	FLAGS_COUNT,
+	FLAGS_FIND_ALL,
+	FLAGS_AND,
+	FLAGS_FEATURES
+};
+
+static const char	*g_flags_features[FLAGS_FEATURES] = {
+	"count",
+	"find every set flag",
+	"and of two vectors"
+};
+
+static const std::size_t	g_flags_size = 64 * 1024 * 1024;
+
+/* the scans, for each type of vector */
+
+static std::size_t	flags_count(const ft::vector<bool> &flags) { return (flags.count()); }
+static std::size_t	flags_count(const std::vector<bool> &flags) { return (std::count(flags.begin(), flags.end(), true)); }
+static std::size_t	flags_count(const std::vector<char> &flags) { return (std::count(flags.begin(), flags.end(), 1)); }
+
+static std::size_t	flags_find_all(const ft::vector<bool> &flags)
+{
+	std::size_t		found = 0;
+
+	for (std::size_t pos = flags.find_first(); pos < flags.size(); pos = flags.find_next(pos))
+		found += pos;
+	return (found);
+}
+
+template <class Flags>
+static std::size_t	flags_find_all(const Flags &flags)
+{
+	std::size_t							found = 0;
+	typename Flags::const_iterator		it = std::find(flags.begin(), flags.end(), true);
+
+	while (it != flags.end())
+	{
+		found += it - flags.begin();
+		it = std::find(it + 1, flags.end(), true);
+	}
+	return (found);
+}
+
+static void	flags_and(ft::vector<bool> &flags, const ft::vector<bool> &other) { flags &= other; }
+
+static void	flags_and(std::vector<bool> &flags, const std::vector<bool> &other)
+{
+	for (std::size_t i = 0; i < flags.size(); i++)
+		flags[i] = flags[i] && other[i];
+}
+
+static void	flags_and(std::vector<char> &flags, const std::vector<char> &other)
+{
+	for (std::size_t i = 0; i < flags.size(); i++)
+		flags[i] &= other[i];
+}
+
+/* benchmark task : the flags are built once, operator() scans them (and modifies them for FLAGS_AND) */
+template <class Flags>
+class flags_task
+{
+	public:
+
+		flags_task(void) : _flags(g_flags_size), _other(g_flags_size), _feature(FLAGS_COUNT)
+		{
+			for (std::size_t i = 0; i < g_flags_size; i++)
+			{
+				this->_flags[i] = ((i * 2654435761u) % 64 == 0);
+				this->_other[i] = (i % 2 == 0);
+			}
+		}
+
+		void	feature(int f) { this->_feature = f; }
+
+		void	setUp(void) {}
+
+		void	operator()(void)
+		{
+			switch (this->_feature)
+			{
+				case FLAGS_COUNT:
+					doNotOptimize(flags_count(this->_flags));
+					break ;
+				case FLAGS_FIND_ALL:
+					doNotOptimize(flags_find_all(this->_flags));
+					break ;
+				case FLAGS_AND: // and with every other flag set : after a few runs, the flags are all 0
+					flags_and(this->_flags, this->_other);
+					clobberMemory();
+					break ;
+			}
+		}
+
+	private:
+
+		Flags	_flags;
+		Flags	_other;
+		int		_feature;
+};
+
+/* builds n flags with a counting allocator : Benchmark::memory prints the bytes per flag */
+template <class Flags>
+class flags_fill_task
+{
+	public:
+
+		void	setUp(void)
+		{
+			Flags	empty;
+
+			this->_flags.swap(empty);
+		}
+
+		void	operator()(void)
+		{
+			this->_flags.resize(g_flags_size, true);
+			doNotOptimize(this->_flags.size());
+		}
+
+	private:
+
+		Flags	_flags;
+};
+
+void	vector_bool_speedtest(Colors &col)
+{
+	Benchmark									ft_bench(col, "ft::vector<bool>");
+	Benchmark									bits_bench(col, "std::vector<bool>");
+	Benchmark									bytes_bench(col, "std::vector<char>");
+	flags_task<ft::vector<bool> >				ft_task;
+	flags_task<std::vector<bool> >				bits_task;
+	flags_task<std::vector<char> >				bytes_task;
+	const char									*kernel;
+
+	std::cout << col.bdYellow() << "Starting speedtest for vectors of bool..." << col.reset() << std::endl;
+	{
+		flags_fill_task<ft::vector<bool, ft::counting_allocator<bool> > >		ft_fill;
+		flags_fill_task<std::vector<char, ft::counting_allocator<char> > >		bytes_fill;
+
+		std::cout << "memory of " << g_flags_size << " flags, ft::vector<bool> then std::vector<char>..." << std::endl;
+		ft_bench.memory(ft_fill, g_flags_size, g_flags_size);
+		ft_fill.setUp(); // frees the flags : they would count in the peak of the next one
+		bytes_bench.memory(bytes_fill, g_flags_size, g_flags_size);
+	}
+	ft::select_count_bits(&kernel);
+	for (int f = 0; f < FLAGS_FEATURES; f++)
+	{
+		std::string		name = g_flags_features[f];
+
+		separator(col);
+		std::cout << "testing " << name << " on " << g_flags_size << " flags..." << std::endl;
+		ft_task.feature(f);
+		bits_task.feature(f);
+		bytes_task.feature(f);
+		BenchmarkResult		ft_res = ft_bench.run(name + (f == FLAGS_COUNT ? " [" + std::string(kernel) + "]" : ""),
+			ft_task, g_flags_size);
+		BenchmarkResult		bits_res = bits_bench.run(name, bits_task, g_flags_size);
+		BenchmarkResult		bytes_res = bytes_bench.run(name, bytes_task, g_flags_size);
+		ft_bench.compare(ft_res, bits_res);
+		ft_bench.compare(ft_res, bytes_res);
+	}
+	std::cout << col.bdYellow() << "End of speedtest for vectors of bool" << col.reset() << std::endl;
+}
@@ -6,35 +6,247 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/01 16:35:05 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/12 16:28:41 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 07:48:24 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "../includes/test_includes.hpp"
-#include <time.h>
+#include "../../includes/test_includes.hpp"
+#include "../test_utils/benchmark.hpp"
 
-/* includes some speedtests for basic operations in vector 
-It would be better to use std::chrono but it is C++11 (so forbidden by the subject, unfortunately) 
-use : the C style clock in the header <time.h> */
+/* includes some speedtests for basic operations in vector, ft::vector against std::vector, measured by the
+Benchmark harness (monotonic clock, warm-up, several runs : see test_utils/benchmark.hpp). The values
+stored come from the workload of Benchmark::config() */
 
-/* print the result of the test */
-static void	speedtest_result(Colors &col, std::string feature, double duration)
+/* features measured by vector_speedtest */
+enum	e_vector_feature
 {
-	std::cout << col.bdYellow() << "The time necessary for the " << feature << " feature is " 
-	<< duration << col.end() << std::endl;
+	PUSH_BACK,
+	POP_BACK,
+	INSERT_FILL,
+	INSERT_RANGE,
+	CLEAR,
+	ERASE_BEGIN,
+	ERASE_END,
+	ERASE_MIDDLE,
+	ERASE_RANGE,
+	ASSIGN_RANGE,
+	ASSIGN_FILL,
+	RESERVE,
+	RESIZE,
+	VECTOR_FEATURES
+};
+
+static const char	*g_vector_features[VECTOR_FEATURES] = {
+	"push_back",
+	"pop_back",
+	"insert (position, n, val)",
+	"insert (position, first, last)",
+	"clear",
+	"erase (position), at the beginning",
+	"erase (position), at the end",
+	"erase (position), in the middle",
+	"erase (first, last)",
+	"assign (first, last)",
+	"assign (n, val), 5 values",
+	"reserve (growing by one)",
+	"resize (growing by one)"
+};
+
+/* erase at the beginning or in the middle shifts the whole vector : quadratic, so it is measured on
+a smaller vector, like reserve and resize growing by one element (one reallocation per call) */
+static const std::size_t	g_linear_size = 1000000;
+static const std::size_t	g_quadratic_size = 20000;
+
+static std::size_t	feature_size(int feature)
+{
+	if (feature == ERASE_BEGIN || feature == ERASE_MIDDLE || feature == RESERVE || feature == RESIZE)
+		return (g_quadratic_size);
+	return (g_linear_size);
 }
 
-/* helps calc where to suppress when in the middle */
-static std::size_t	calc_middle(std::size_t	size)
+/* benchmark task : setUp prepares the vector for the feature, operator() does the measured work. Works
+with ft::vector and std::vector : only the common interface is used */
+template <class Vector>
+class vector_task
+{
+	public:
+
+		vector_task(const std::vector<int> &values) : _values(values), _feature(PUSH_BACK), _size(0) {}
+
+		void	feature(int f)
+		{
+			this->_feature = f;
+			this->_size = feature_size(f);
+		}
+
+		void	setUp(void)
+		{
+			Vector		empty;
+
+			this->_vect.swap(empty); // starts from a vector with no capacity
+			if (this->_feature == INSERT_FILL)
+				this->_vect.push_back(666);
+			else if (this->_feature != PUSH_BACK && this->_feature != INSERT_RANGE
+				&& this->_feature != RESERVE && this->_feature != RESIZE)
+				for (std::size_t i = 0; i < this->_size; i++)
+					this->_vect.push_back(this->_values[i]);
+		}
+
+		void	operator()(void)
+		{
+			switch (this->_feature)
+			{
+				case PUSH_BACK:
+					for (std::size_t i = 0; i < this->_size; i++)
+						this->_vect.push_back(this->_values[i]);
+					break ;
+				case POP_BACK:
+					for (std::size_t i = 0; i < this->_size; i++)
+						this->_vect.pop_back();
+					break ;
+				case INSERT_FILL:
+					this->_vect.insert(this->_vect.begin(), this->_size, 42);
+					break ;
+				case INSERT_RANGE:
+					this->_vect.insert(this->_vect.end(), this->_values.begin(), this->_values.begin() + this->_size);
+					break ;
+				case CLEAR:
+					this->_vect.clear();
+					break ;
+				case ERASE_BEGIN:
+					while (this->_vect.empty() == false)
+						this->_vect.erase(this->_vect.begin());
+					break ;
+				case ERASE_END:
+					while (this->_vect.empty() == false)
+						this->_vect.erase(this->_vect.end() - 1);
+					break ;
+				case ERASE_MIDDLE:
+					while (this->_vect.empty() == false)
+						this->_vect.erase(this->_vect.begin() + this->_vect.size() / 2);
+					break ;
+				case ERASE_RANGE:
+					this->_vect.erase(this->_vect.begin(), this->_vect.end());
+					break ;
+				case ASSIGN_RANGE:
+					this->_vect.assign(this->_values.begin(), this->_values.begin() + this->_size);
+					break ;
+				case ASSIGN_FILL:
+					for (std::size_t i = 0; i < this->_size; i++)
+						this->_vect.assign(5, 666);
+					break ;
+				case RESERVE:
+					for (std::size_t i = 1; i <= this->_size; i++)
+						this->_vect.reserve(i);
+					break ;
+				case RESIZE:
+					for (std::size_t i = 1; i <= this->_size; i++)
+						this->_vect.resize(i, 42);
+					break ;
+			}
+			doNotOptimize(this->_vect.size());
+			clobberMemory();
+		}
+
+	private:
+
+		const std::vector<int>	&_values;
+		Vector					_vect;
+		int						_feature;
+		std::size_t				_size;
+};
+
+/* latency of each push_back in an empty vector : the copies of the reallocations show in the tail */
+template <class Vector>
+static void	vector_latency_speedtest(Colors &col, const std::string &name, const std::vector<int> &values)
+{
+	Vector				vect;
+	LatencyHistogram	latency;
+	double				overhead = Benchmark::timerOverhead();
+	double				start;
+	double				duration;
+
+	std::cout << "testing the latency of " << name << " push_back with " << values.size() << " values..." << std::endl;
+	for (std::size_t i = 0; i < values.size(); i++)
+	{
+		start = Benchmark::now();
+		vect.push_back(values[i]);
+		duration = Benchmark::now() - start;
+		latency.record(duration > overhead ? duration - overhead : 0);
+	}
+	doNotOptimize(vect.size());
+	latency.print(col, name + " push_back");
+	separator(col);
+}
+
+/* ft::equal or ft::lexicographical_compare on two ranges differing only by their last element :
+both ranges are read entirely */
+template <class Iterator>
+class compare_task
+{
+	public:
+
+		compare_task(Iterator first1, Iterator last1, Iterator first2, Iterator last2, bool lexicographical)
+		: _first1(first1), _last1(last1), _first2(first2), _last2(last2), _lexicographical(lexicographical) {}
+
+		void	setUp(void) {}
+
+		void	operator()(void)
+		{
+			if (this->_lexicographical)
+				doNotOptimize(ft::lexicographical_compare(this->_first1, this->_last1, this->_first2, this->_last2));
+			else
+				doNotOptimize(ft::equal(this->_first1, this->_last1, this->_first2));
+		}
+
+	private:
+
+		Iterator	_first1;
+		Iterator	_last1;
+		Iterator	_first2;
+		Iterator	_last2;
+		bool		_lexicographical;
+};
+
+/* the generic loop (std::vector iterators) against the contiguous overloads (ft::vector iterators),
+on the same elements */
+template <class T>
+static void	compare_speedtest(Benchmark &generic_bench, Benchmark &contiguous_bench, const std::string &type,
+	const std::string &kernel)
 {
-	if (size == 1)
-		return 0;
-	else
-		return (size / 2);
+	typedef typename std::vector<T>::const_iterator		std_iterator;
+	typedef typename ft::vector<T>::const_iterator		ft_iterator;
+
+	std::vector<T>		a(g_linear_size);
+	std::vector<T>		b;
+	ft::vector<T>		ft_a;
+	ft::vector<T>		ft_b;
+
+	for (std::size_t i = 0; i < a.size(); i++)
+		a[i] = static_cast<T>(i * 7);
+	b = a;
+	b.back() = static_cast<T>(b.back() + 1);
+	ft_a.assign(a.begin(), a.end());
+	ft_b.assign(b.begin(), b.end());
+
+	const ft::vector<T>	&ca = ft_a;
+	const ft::vector<T>	&cb = ft_b;
+
+	for (int lexicographical = 0; lexicographical < 2; lexicographical++)
+	{
+		std::string					name = (lexicographical ? "lexicographical_compare <" : "equal <") + type + ">";
+		compare_task<std_iterator>	generic(a.begin(), a.end(), b.begin(), b.end(), lexicographical);
+		compare_task<ft_iterator>	contiguous(ca.begin(), ca.end(), cb.begin(), cb.end(), lexicographical);
+
+		std::cout << "testing " << name << " on " << a.size() << " elements..." << std::endl;
+		BenchmarkResult		generic_res = generic_bench.run(name, generic, a.size());
+		BenchmarkResult		contiguous_res = contiguous_bench.run(name + " [" + (lexicographical ? kernel : "memcmp")
+			+ "]", contiguous, a.size());
+		contiguous_bench.compare(contiguous_res, generic_res);
+	}
 }
 
-/* vector speedtest compares a large number of operations (using vector methods). 
-check especifically the methods of vector modification :
+/* vector speedtest measures the methods of vector modification :
 => push_back
 => pop_back
 => insert
@@ -43,167 +255,51 @@ check especifically the methods of vector modification :
 => clear
 => resize
 => reserve
+then ft::equal and ft::lexicographical_compare on vectors of 1M int and unsigned char, and the scans
+of ft::vector<bool>
 */
-static void	vector_speedtest(Colors &col)
+void	vector_speedtest(Colors &col)
 {
-	std::cout << col.bdYellow() << "Starting speedtest for vectors..." << col.reset() << std::endl;
-	
-	std::vector<int>	stl_int; // inititate an empty int vector
-	clock_t		t;	// init clock
-	double		exec_time;
-	
-	/* SPEEDTEST FOR PUSH_BACK */
-	std::cout << "testing push back method with 10.000.000 values..." << std::endl;
-	t = clock();
-	for (std::size_t i = 0; i < 10000000; i++) 
-		stl_int.push_back(i);
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "push_back", exec_time);
-	separator(col);
-	
-	/* SPEEDTEST FOR POP_BACK */
-	std::cout << "testing pop_back, suppressing the 10.000.000 values previously inserted..." << std::endl;
-	t = clock();
-	for (std::size_t i = 0; i < 10000000; i++)
-		stl_int.pop_back();
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "pop_back", exec_time);
-	separator(col);
-	
-	/* SPEEDTEST FOR INSERT */
-	stl_int.push_back(666);
-	std::cout << "testing the two versions of insert method with multiple values" << std::endl;
-
-	/* void insert (iterator position, size_type n, const value_type& val) */
-	std::cout << "testing with void insert (iterator position, size_type n, const value_type& val)" << std::endl;
-	t = clock();
-	stl_int.insert(stl_int.begin(), 10000000, 42);
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "void insert (iterator position, size_type n, const value_type& val)", exec_time);
-	separator(col);
-
-	/* testing with void insert (iterator position, InputIterator first, InputIterator last) */  
-	std::cout << "testing with void insert (iterator position, InputIterator first, InputIterator last);" << std::endl;
-	std::vector<int> 	other_vect(stl_int);
-	t = clock();
-	stl_int.insert(stl_int.end(), other_vect.begin(), other_vect.end()); // verify
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "void insert (iterator position, InputIterator first, InputIterator last)", exec_time);
-	separator(col);
-	
-	/* SPEEDTEST FOR CLEAR */
-	std::cout << "testing with clear..." << std::endl;
-	t = clock();
-	stl_int.clear();
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "clear", exec_time);
-	separator(col);
-
-	/* SPEEDTEST FOR ERASE */
-	std::cout << "testing with the two versions of erase..." << std::endl;
+	Workload							workload(Benchmark::config().workload, g_linear_size, g_linear_size,
+		Benchmark::config().mix);
+	std::vector<int>					values(g_linear_size);
+	Benchmark							ft_bench(col, "ft::vector");
+	Benchmark							std_bench(col, "std::vector");
+	vector_task<ft::vector<int> >		ft_task(values);
+	vector_task<std::vector<int> >		std_task(values);
+	vector_task<ft::vector<int, ft::counting_allocator<int> > >		ft_counted(values);
+	vector_task<std::vector<int, ft::counting_allocator<int> > >	std_counted(values);
+	std::string							suffix = " [" + workload.name() + "]";
 
-	for (std::size_t i = 0; i < 10000000; i++) // add value to the now empty vector
-		stl_int.push_back(i);
-
-	/* iterator erase (iterator position) */
-	std::cout << "testing iterator erase (iterator position), deleting values at the beginning" << std::endl;
-	t = clock();
-	for (std::size_t i = 0; i < stl_int.size(); i++)
-		stl_int.erase(stl_int.begin());
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "erase (iterator position), deleting vals at the beg", exec_time);
-	separator(col);
-
-	for (std::size_t i = 0; i < 10000000; i++) // add value to the now empty vector
-		stl_int.push_back(i);
-	std::cout << "testing iterator erase (iterator position), deleting values at the end" << std::endl;
-	t = clock();
-	for (std::size_t i = 0; i < stl_int.size(); i++)
-		stl_int.erase(stl_int.end() - 1); // verify that
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "erase (iterator position), deleting vals at the end", exec_time);
-	separator(col);
-
-	for (std::size_t i = 0; i < 10000000; i++) // add value to the now empty vector
-		stl_int.push_back(i);
-	std::cout << "testing iterator erase (iterator position), deleting values at the middle" << std::endl;
-	t = clock();
-	for (std::size_t i = 0; i < stl_int.size(); i++)
-		stl_int.erase(stl_int.begin() + (calc_middle(stl_int.size()))); // verify that
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "erase (iterator position), deleting vals at the middle", exec_time);
-	separator(col);
-
-	/* iterator erase (iterator first, iterator last) */
-	for (std::size_t i = 0; i < 10000000; i++) // add value to the now empty vector
-		stl_int.push_back(i);
-	std::cout << "testing ...iterator erase (iterator first, iterator last)" << std::endl;
-	t = clock();
-	stl_int.erase(stl_int.begin(), stl_int.end()); // to test
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "erase (iterator first, iterator last)", exec_time);
-	separator(col);
+	std::cout << col.bdYellow() << "Starting speedtest for vectors..." << col.reset() << std::endl;
+	for (std::size_t i = 0; i < values.size(); i++) // a replayed trace may be shorter : it is repeated
+		values[i] = (workload.keys().empty() ? i : workload.keys()[i % workload.keys().size()]);
+	for (int f = 0; f < VECTOR_FEATURES; f++)
+	{
+		std::cout << "testing " << g_vector_features[f] << " with " << feature_size(f) << " values..." << std::endl;
+		ft_task.feature(f);
+		std_task.feature(f);
+		BenchmarkResult		ft_res = ft_bench.run(g_vector_features[f] + suffix, ft_task, feature_size(f));
+		ft_counted.feature(f);
+		ft_bench.memory(ft_counted, feature_size(f), feature_size(f));
+		BenchmarkResult		std_res = std_bench.run(g_vector_features[f] + suffix, std_task, feature_size(f));
+		std_counted.feature(f);
+		std_bench.memory(std_counted, feature_size(f), feature_size(f));
+		ft_bench.compare(ft_res, std_res);
+		separator(col);
+	}
+	vector_latency_speedtest<ft::vector<int> >(col, "ft::vector", values);
+	vector_latency_speedtest<std::vector<int> >(col, "std::vector", values);
 
-	/* SPEEDTEST FOR ASSIGN */
-
-	for (std::size_t i = 0; i < 10000000; i++) // add value to the now empty vector
-		stl_int.push_back(i);
-	std::vector<int>			other_vect2;
-	for (std::size_t i = 0; i < 10000000; i++)
-		other_vect2.push_back(i);
-	/* void assign (InputIterator first, InputIterator last); */
-	std::cout << "assign 10.000.000 times other_vect_2 to test vector" << std::endl;
-	t = clock();
-	for (std::size_t i = 0; i < 10000000; i++)
-		stl_int.assign(other_vect2.begin(), other_vect2.end() - 1);
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "assign (InputIterator first, InputIterator last)", exec_time);
-	separator(col);
-	
-	/* void assign (size_type n, const value_type& val); */
-	std::cout << "assign 10.000.000 times 5 values (666)" << std::endl;
-	t = clock();
-	for (std::size_t i = 0; i < 10000000; i++)
-		stl_int.assign(5, 666);
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "assign (size_type n, const value_type& val)", exec_time);
-	separator(col);
+	Benchmark		generic_bench(col, "generic loop");
+	Benchmark		contiguous_bench(col, "contiguous");
+	const char		*kernel;
 
-	/* SPEEDTEST FOR RESERVE */
-	/* void reserve (size_type n); */
-	std::cout << "reserve 10.000.000 times memory" << std::endl;
-	t = clock();
-	for (std::size_t i = 0; i < 10000000; i++)
-		stl_int.reserve(666 + i);
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "reserve", exec_time);
+	ft::select_mismatch_bytes(&kernel);
+	compare_speedtest<int>(generic_bench, contiguous_bench, "int", kernel);
+	compare_speedtest<unsigned char>(generic_bench, contiguous_bench, "unsigned char", kernel);
 	separator(col);
-	
-	/* SPEEDTEST FOR RESIZE */
-	/* void resize (size_type n, value_type val = value_type()); */
-	std::cout << "resize 10.000.000 times" << std::endl;
-	t = clock();
-	for (std::size_t i = 0; i < 10000000; i++)
-		stl_int.resize(666 + i, 42);
-	t = clock() - t;
-	exec_time = ((double)t)/CLOCKS_PER_SEC;
-	speedtest_result(col, "resize", exec_time);
+	vector_bool_speedtest(col);
 	separator(col);
-
-	// ---------------------------------------------------------------------------------------- //
 	std::cout << col.bdYellow() << "End of speedtests for vectors" << col.reset() << std::endl;
-	std::cout << col.bdYellow() << "Please do not forget to compare the results with" 
-	<< " either ft or stl vector" << col.reset() << std::endl;
 }
@@ -6,11 +6,14 @@
 /*   By: cjulienn <cjulienn@student.s19.be>         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/12/01 15:42:21 by cjulienn          #+#    #+#             */
-/*   Updated: 2022/12/15 16:25:21 by cjulienn         ###   ########.fr       */
+/*   Updated: 2026/10/19 08:53:35 by cjulienn         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../includes/test_includes.hpp"
+#include <algorithm>
+#include <iterator>
+#include <sstream>
 
 /* These test are meant to compare the behaviour of the original std::vector and compares it to its ft::vector
 counterpart.
@@ -209,6 +212,10 @@ static void	test_constructors(Colors &col) // to test
 
 /* II - ITERATORS */
 
+/* true if the category of an iterator is random access */
+static bool	is_random_access(std::random_access_iterator_tag) { return (true); }
+static bool	is_random_access(std::input_iterator_tag) { return (false); }
+
 /*  should test the iterators functionnality and their behaviour */
 static void	test_iterator(Colors &col) // to test
 {
@@ -230,7 +237,7 @@ static void	test_iterator(Colors &col) // to test
 	std::vector<int>::iterator		last = test.end();
 
 	std::cout << "Check if we can print first and last (test.begin() and test.last() - 1)" << std::endl;
-	std::cout << "first is " << *first << " and last is " << (*last - 1) << std::endl;
+	std::cout << "first is " << *first << " and last is " << *(last - 1) << std::endl;
 	
 	std::cout << "Try to display all vector values with iterators..." << std::endl;
 	while (first != last)
@@ -272,12 +279,12 @@ static void	test_iterator(Colors &col) // to test
 	std::cout << col.yellow() << "Testing - operator..." << col.reset() << std::endl;
 	std::vector<int>::iterator		op_min = test.end();
 	std::cout << "Should print the last int stored in the vector" << std::endl;
-	std::cout << "Value printed is : " << *op_min - 1 << std::endl << std::endl;
+	std::cout << "Value printed is : " << *(op_min - 1) << std::endl << std::endl;
 
 	std::cout << col.yellow() << "Testing + operator..." << col.reset() << std::endl;
 	std::vector<int>::iterator		op_plus = test.begin();
 	std::cout << "Should print the second int stored in the vector" << std::endl;
-	std::cout << "Value printed is : " << *op_plus + 1 << std::endl << std::endl;
+	std::cout << "Value printed is : " << *(op_plus + 1) << std::endl << std::endl;
 
 	std::cout << col.yellow() << "Testing += operator..." << col.reset() << std::endl;
 	std::vector<int>::iterator		op_plusequal = test.begin();
@@ -287,7 +294,7 @@ static void	test_iterator(Colors &col) // to test
 
 	std::cout << col.yellow() << "Testing -= operator..." << col.reset() << std::endl;
 	std::vector<int>::iterator		op_minequal = test.end();
-	op_plusequal -= test.size() - 1;
+	op_minequal -= test.size();
 	std::cout << "Once dereferenced, value printed should be the first value of the vector..." << std::endl;
 	std::cout << "Value printed is " << *op_minequal << std::endl << std::endl;
 
@@ -333,6 +340,25 @@ static void	test_iterator(Colors &col) // to test
 	std::cout << "it1 <= it3 = " << std::boolalpha << (it1 <= it3) << std::endl;
 	std::cout << "it1 >= it3 = " << std::boolalpha << (it1 >= it3) << std::endl<< std::endl;
 	
+	std::cout << col.bdBlue() << "Testing ft::vectorIterator as a random access iterator..." << col.reset() << std::endl;
+	int								arr[5] = {5, 76, -4567, 0, -1};
+	ft::vectorIterator<int>			ft_first(arr);
+	ft::vectorIterator<int>			ft_last(arr + 5);
+	ft::vectorIterator<int, true>	ft_cfirst = ft_first; // iterator to const_iterator
+
+	std::cout << "random access = " << std::boolalpha
+	<< is_random_access(std::iterator_traits<ft::vectorIterator<int> >::iterator_category())
+	<< " (istream_iterator : " << is_random_access(std::iterator_traits<std::istream_iterator<int> >::iterator_category())
+	<< "), contiguous = " << ft::is_contiguous_iterator<ft::vectorIterator<int> >::value << std::endl;
+	std::cout << "2 + begin = " << *(2 + ft_first) << ", std::distance = " << std::distance(ft_first, ft_last) << std::endl;
+	std::cout << "const and non const mixed : cbegin == begin = " << (ft_cfirst == ft_first)
+	<< ", cbegin < end = " << (ft_cfirst < ft_last) << ", end - cbegin = " << (ft_last - ft_cfirst) << std::endl;
+	std::sort(ft_first, ft_last);
+	std::cout << "after std::sort :";
+	for (ft::vectorIterator<int, true> it = ft_cfirst; it != ft_last; ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl << std::endl;
+
 	separator(col);
 	std::cout << col.bdYellow() << "iterator tests over" << col.reset() << std::endl;
 	separator(col);
@@ -360,7 +386,7 @@ static void	test_reverse_iterator(Colors &col) // to test
 	std::vector<int>::reverse_iterator		last = test.rend();
 
 	std::cout << "Check if we can print first and last (test.begin() and test.last() - 1)" << std::endl;
-	std::cout << "first is " << *first << " and last is " << (*last - 1) << std::endl;
+	std::cout << "first is " << *first << " and last is " << *(last - 1) << std::endl;
 	
 	std::cout << "Try to display all vector values with iterators (reverse order)..." << std::endl;
 	while (first != last)
@@ -402,12 +428,12 @@ static void	test_reverse_iterator(Colors &col) // to test
 	std::cout << col.yellow() << "Testing - operator..." <<  col.reset() << std::endl;
 	std::vector<int>::reverse_iterator		op_min = test.rend();
 	std::cout << "Should print the first int stored in the vector" << std::endl;
-	std::cout << "Value printed is : " << *op_min - 1 << std::endl << std::endl;
+	std::cout << "Value printed is : " << *(op_min - 1) << std::endl << std::endl;
 
 	std::cout << col.yellow() << "Testing + operator..." << col.reset() << std::endl;
 	std::vector<int>::reverse_iterator		op_plus = test.rbegin();
 	std::cout << "Should print the penultimate int stored in the vector" << std::endl;
-	std::cout << "Value printed is : " << *op_plus + 1 << std::endl << std::endl;
+	std::cout << "Value printed is : " << *(op_plus + 1) << std::endl << std::endl;
 
 	std::cout << col.yellow() << "Testing += operator..." << col.reset() << std::endl;
 	std::vector<int>::reverse_iterator		op_plusequal = test.rbegin();
@@ -417,7 +443,7 @@ static void	test_reverse_iterator(Colors &col) // to test
 
 	std::cout << col.yellow() << "Testing -= operator..." << col.reset() << std::endl;
 	std::vector<int>::reverse_iterator		op_minequal = test.rend();
-	op_plusequal -= test.size() - 1;
+	op_minequal -= test.size();
 	std::cout << "Once dereferenced, value printed should be the last value of the vector..." << std::endl;
 	std::cout << "Value printed is " << *op_minequal << std::endl << std::endl;
 
@@ -848,7 +874,7 @@ static void test_pop_back(Colors &col) // to test
 
 	/* printing vector content (without using pop back) */
 	std::cout << "printing vector..." << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "Index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "size of vector is " << test.size() << std::endl;
 	std::cout << "capacity of vector is : " << test.capacity() << std::endl;
@@ -861,7 +887,7 @@ static void test_pop_back(Colors &col) // to test
 	std::cout << col.yellow() << "erase one value" << col.reset() <<  std::endl;
 	test.pop_back();
 	std::cout << "printing updated vector content" << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "Index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "size of the updated vector is : " << test.size() << std::endl;
 	std::cout << "capacity of the updated vector is : " << test.capacity() << std::endl << std::endl;
@@ -870,7 +896,7 @@ static void test_pop_back(Colors &col) // to test
 	std::cout << col.yellow() << "erase one value" << col.reset() << std::endl;
 	test.pop_back();
 	std::cout << "printing updated vector content" << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "Index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "size of the updated vector is : " << test.size() << std::endl;
 	std::cout << "capacity of the updated vector is : " << test.capacity() << std::endl << std::endl;
@@ -879,7 +905,7 @@ static void test_pop_back(Colors &col) // to test
 	std::cout << col.yellow() << "erase one value" << col.reset() << std::endl;
 	test.pop_back();
 	std::cout << "printing updated vector content" << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "Index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "size of the updated vector is : " << test.size() << std::endl;
 	std::cout << "capacity of the updated vector is : " << test.capacity() << std::endl << std::endl;
@@ -888,7 +914,7 @@ static void test_pop_back(Colors &col) // to test
 	std::cout << col.yellow() << "erase one value" << col.reset() << std::endl;
 	test.pop_back();
 	std::cout << "printing updated vector content" << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "Index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "size of the updated vector is : " << test.size() << std::endl;
 	std::cout << "capacity of the updated vector is : " << test.capacity() << std::endl << std::endl;
@@ -897,7 +923,7 @@ static void test_pop_back(Colors &col) // to test
 	std::cout << col.yellow() << "erase one value" << col.reset() << std::endl;
 	test.pop_back();
 	std::cout << "printing updated vector content" << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "Index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "size of the updated vector is : " << test.size() << std::endl;
 	std::cout << "capacity of the updated vector is : " << test.capacity() << std::endl << std::endl;
@@ -934,7 +960,7 @@ static void test_insertion(Colors &col) // to test
 	std::cout << col.yellow() <<"Insert a value (42) at the end" << col.reset() << std::endl;
 	test.insert(it_pos, 42);
 	std::cout << "Displaying the entire vector..." << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "checking changes in capacity and size" << std::endl;
 	std::cout << "test size = " << test.size() << " and test capacity = " << test.capacity() << std::endl;
@@ -943,7 +969,7 @@ static void test_insertion(Colors &col) // to test
 	std::cout << col.yellow() << "Insert a value (21) at the beginning" << col.reset() << std::endl;
 	test.insert(it_pos, 21);
 	std::cout << "Diplaying the entire vector..." << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "checking changes in capacity and size" << std::endl;
 	std::cout << "test size = " << test.size() << " and test capacity = " << test.capacity() << std::endl << std::endl;
@@ -956,7 +982,7 @@ static void test_insertion(Colors &col) // to test
 	std::cout << col.yellow() << "Inserting 5 values 72 at the end of the test vector" << col.reset() << std::endl;
 	test.insert(it_pos, 5, 72);
 	std::cout << "Diplaying the entire vector..." << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "checking changes in capacity and size" << std::endl;
 	std::cout << "test size = " << test.size() << " and test capacity = " << test.capacity() << std::endl << std::endl;
@@ -965,7 +991,7 @@ static void test_insertion(Colors &col) // to test
 	std::cout << col.yellow() << "Inserting 5 values 47 at the beginning of the test vector" << col.reset() << std::endl;
 	test.insert(it_pos, 5 ,47);
 	std::cout << "Diplaying the entire vector..." << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "checking changes in capacity and size" << std::endl;
 	std::cout << "test size = " << test.size() << " and test capacity = " << test.capacity() << std::endl << std::endl;
@@ -986,7 +1012,7 @@ static void test_insertion(Colors &col) // to test
 	std::cout << col.yellow() << "Add a range of values at the beginning of test" << col.reset() << std::endl;
 	test.insert(test.begin(), it_beg, it_end);
 	std::cout << "Diplaying the entire vector..." << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "checking changes in capacity and size" << std::endl;
 	std::cout << "test size = " << test.size() << " and test capacity = " << test.capacity() << std::endl << std::endl;
@@ -994,7 +1020,7 @@ static void test_insertion(Colors &col) // to test
 	std::cout << col.yellow() << "Add a range of values at the end of test " << col.reset() << std::endl;
 	test.insert(test.end(), it_beg, it_end);
 	std::cout << "Diplaying the entire vector..." << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "checking changes in capacity and size" << std::endl;
 	std::cout << "test size = " << test.size() << " and test capacity = " << test.capacity() << std::endl << std::endl;
@@ -1002,7 +1028,7 @@ static void test_insertion(Colors &col) // to test
 	std::cout << col.yellow() <<  "Add a range of values at the end of test" << col.reset() << std::endl;
 	test.insert(test.begin() + 2, it_beg, it_end);
 	std::cout << "Diplaying the entire vector..." << std::endl;
-	for (std::size_t i; i < test.size(); i++)
+	for (std::size_t i = 0; i < test.size(); i++)
 		std::cout << "index [" << i << "] = " << test[i] << std::endl;
 	std::cout << "checking changes in capacity and size" << std::endl;
 	std::cout << "test size = " << test.size() << " and test capacity = " << test.capacity() << std::endl << std::endl;
@@ -1188,6 +1214,129 @@ static void	test_equivalency_ops(Colors &col) // wip
 	separator(col);
 }
 
+/* ft::vector<bool> (one bit per flag) against std::vector<bool>, across the boundaries of the words */
+static void	test_vector_bool(Colors &col)
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing vector<bool>..." << col.reset() << std::endl;
+	separator(col);
+
+	ft::vector<bool>		flags;
+	std::vector<bool>		ref;
+	bool					same = true;
+
+	for (std::size_t i = 0; i < 200; i++)
+	{
+		flags.push_back(i % 3 == 0);
+		ref.push_back(i % 3 == 0);
+	}
+	flags.resize(300, true);
+	ref.resize(300, true);
+	flags[64].flip();
+	ref[64].flip();
+	flags.pop_back();
+	ref.pop_back();
+	for (std::size_t i = 0; i < ref.size(); i++)
+		same = same && (flags[i] == ref[i]);
+	std::cout << "size = " << flags.size() << ", capacity = " << flags.capacity() << ", words = "
+	<< flags.word_count() << std::endl;
+	std::cout << "same bits as std::vector<bool> = " << std::boolalpha << same << std::endl;
+	std::cout << "count = " << flags.count() << " (std::count = " << std::count(ref.begin(), ref.end(), true)
+	<< ")" << std::endl;
+	std::cout << "first set bits :";
+	for (std::size_t pos = flags.find_first(), n = 0; pos < flags.size() && n < 8; pos = flags.find_next(pos), n++)
+		std::cout << " " << pos;
+	std::cout << std::endl;
+
+	ft::vector<bool>		odd(flags.size(), false);
+
+	for (std::size_t i = 1; i < odd.size(); i += 2)
+		odd[i] = true;
+	std::cout << "(flags & odd).count = " << (flags & odd).count() << ", (flags | odd).count = "
+	<< (flags | odd).count() << ", (flags ^ odd).count = " << (flags ^ odd).count() << std::endl;
+	flags.flip();
+	std::cout << "after flip, count = " << flags.count() << std::endl;
+
+	ft::vector<bool>		reversed(flags.rbegin(), flags.rend());
+	ft::vector<bool>		twice(reversed.rbegin(), reversed.rend());
+
+	std::cout << "reversed twice == flags = " << std::boolalpha << (twice == flags) << ", reversed == flags = "
+	<< (reversed == flags) << std::endl;
+	try
+	{
+		flags &= ft::vector<bool>(3, true);
+	}
+	catch (const std::exception &e)
+	{
+		std::cout << "and of vectors of different sizes : " << e.what() << " exception thrown" << std::endl;
+	}
+
+	separator(col);
+	std::cout << col.bdYellow() << "End of vector<bool> tests" << col.reset() << std::endl;
+	separator(col);
+}
+
+/* push_back, insert and assign of an element of the vector itself : the value must be read before the
+reallocation frees it, or the shift moves it. Strings, so that a freed element shows */
+static void	test_self_insertion(Colors &col)
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing insertion of the vector's own elements..." << col.reset() << std::endl;
+	separator(col);
+
+	ft::vector<std::string>		test;
+	std::vector<std::string>	ref;
+	bool						same = true;
+
+	test.push_back("a string long enough to be allocated");
+	ref.push_back("a string long enough to be allocated");
+	for (int i = 0; i < 20; i++) // reallocates at every power of two
+	{
+		test.push_back(test[0]);
+		ref.push_back(ref[0]);
+	}
+	test.insert(test.begin(), 50, test.back());
+	ref.insert(ref.begin(), 50, ref.back());
+	test.reserve(test.size() + 10);
+	ref.reserve(ref.size() + 10);
+	test.front() = "the first element";
+	ref.front() = "the first element";
+	test.insert(test.begin() + 1, 3, test[1]); // no reallocation : the shift moves test[1]
+	ref.insert(ref.begin() + 1, 3, ref[1]);
+	test.assign(5, test[0]);
+	ref.assign(5, ref[0]);
+	same = (test.size() == ref.size());
+	for (std::size_t i = 0; same && i < ref.size(); i++)
+		same = (test[i] == ref[i]);
+	std::cout << "size = " << test.size() << " (std : " << ref.size() << "), same elements as std::vector = "
+	<< std::boolalpha << same << std::endl;
+}
+
+/* insert from an istream_iterator : a single pass range, that cannot be measured before being read */
+static void	test_single_pass_insertion(Colors &col)
+{
+	separator(col);
+	std::cout << col.bdYellow() << "Testing insertion of a single pass range..." << col.reset() << std::endl;
+	separator(col);
+
+	ft::vector<int>			test(3, 0);
+	std::vector<int>		ref(3, 0);
+	std::istringstream		test_stream("1 2 3 4 5 6 7 8 9 10");
+	std::istringstream		ref_stream("1 2 3 4 5 6 7 8 9 10");
+	bool					same;
+
+	test.insert(test.begin() + 1, std::istream_iterator<int>(test_stream), std::istream_iterator<int>());
+	ref.insert(ref.begin() + 1, std::istream_iterator<int>(ref_stream), std::istream_iterator<int>());
+	same = (test.size() == ref.size());
+	std::cout << "after insert (begin + 1, istream_iterator, end) :";
+	for (std::size_t i = 0; i < test.size(); i++)
+	{
+		std::cout << " " << test[i];
+		same = same && (test[i] == ref[i]);
+	}
+	std::cout << std::endl << "same elements as std::vector = " << std::boolalpha << same << std::endl;
+}
+
 /* all the tests to assess the viability of ft::vector */
 void	vector_verif_procedure(Colors &col) // wip
 {
@@ -1231,6 +1380,15 @@ void	vector_verif_procedure(Colors &col) // wip
 	/* equivalency */
 	std::cout << col.bdBlue() << "test equivalency operators" << col.reset() << std::endl;
 	test_equivalency_ops(col);
+	/* own elements */
+	std::cout << col.bdBlue() << "test insertion of own elements" << col.reset() << std::endl;
+	test_self_insertion(col);
+	/* single pass range */
+	std::cout << col.bdBlue() << "test insertion of a single pass range" << col.reset() << std::endl;
+	test_single_pass_insertion(col);
+	/* vector of bits */
+	std::cout << col.bdBlue() << "test vector<bool>" << col.reset() << std::endl;
+	test_vector_bool(col);
 
 	separator(col);
 	std::cout << col.bdYellow() << "End of vector tests" << col.reset() << std::endl;